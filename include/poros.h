@@ -32,6 +32,7 @@
 #define POROS_H
 
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -45,6 +46,12 @@ typedef uint32_t poros_wgt_type;
 typedef uint32_t poros_pid_type;
 
 
+/**
+ * @brief The maximum number of levels recorded in `poros_stats_struct`.
+ */
+#define POROS_MAX_STATISTICS_LEVELS 64
+
+
 /**
  * @brief Aggregation types.
  */
@@ -54,6 +61,15 @@ typedef enum {
 } aggregator_type;
 
 
+/**
+ * @brief Coarse vertex orderings.
+ */
+typedef enum {
+    NATURAL_ORDERING = 0,
+    BFS_ORDERING = 1
+} coarse_ordering_type;
+
+
 /**
  * @brief Bisector types.
  */
@@ -71,6 +87,181 @@ typedef enum {
 } two_way_refiner_type;
 
 
+/**
+ * @brief Sets of options trading partitioning time for cut quality.
+ */
+typedef enum {
+    /**
+     * @brief Fewer initial bisections and refinement passes, and coarsening
+     * that stops sooner, for up to half the time of the default at a cut a
+     * few percent higher.
+     */
+    FAST_PRESET,
+    /**
+     * @brief The options of `POROS_defaultOptions()`.
+     */
+    DEFAULT_PRESET,
+    /**
+     * @brief More initial bisections of larger coarsest graphs, more
+     * refinement passes, and several partitionings to keep the best of.
+     */
+    QUALITY_PRESET
+} preset_type;
+
+
+/**
+ * @brief The points at which progress is reported.
+ */
+typedef enum {
+    /**
+     * @brief A level of coarsening has been built.
+     */
+    COARSENING_PHASE,
+    /**
+     * @brief The coarsest graph of a bisection has been bisected.
+     */
+    INITIAL_PARTITIONING_PHASE,
+    /**
+     * @brief A bisection has been refined at a level.
+     */
+    REFINEMENT_PHASE,
+    /**
+     * @brief One of the partitionings of the whole graph has been made.
+     */
+    PARTITIONING_PHASE
+} progress_phase_type;
+
+
+/**
+ * @brief The progress of a partitioning, as passed to a
+ * `poros_progress_callback`.
+ */
+typedef struct {
+  /**
+   * @brief The point reached. Should be a member of the
+   * `progress_phase_type` enum.
+   */
+  int phase;
+
+  /**
+   * @brief The partitioning of the whole graph being made, from 0 (see
+   * `numGlobalCuts`).
+   */
+  int trial;
+
+  /**
+   * @brief The depth in the recursion of the bisection being made, from 0
+   * for the bisection of the whole graph.
+   */
+  int depth;
+
+  /**
+   * @brief The level of coarsening reached, from 0 for the graph being
+   * bisected.
+   */
+  int level;
+
+  /**
+   * @brief Non-zero once a partitioning of the whole graph has been made.
+   */
+  int hasBestCut;
+
+  /**
+   * @brief The total weight of cut edges of the best partitioning of the
+   * whole graph made so far (only valid if `hasBestCut` is non-zero).
+   */
+  poros_wgt_type bestCut;
+} poros_progress_struct;
+
+
+/**
+ * @brief A function to report progress to. Returning non-zero cancels the
+ * partitioning, which then returns 0 after freeing all it has allocated.
+ *
+ * @param progress The progress.
+ * @param data The `progressData` of the options.
+ *
+ * @return 0 to continue partitioning, or non-zero to cancel it.
+ */
+typedef int (*poros_progress_callback)(
+    poros_progress_struct const * progress,
+    void * data);
+
+
+/**
+ * @brief The statistics of one level of multilevel bisection, summed over
+ * every bisection which reaches it.
+ */
+typedef struct {
+  /**
+   * @brief The number of bisections which coarsened their graph down to this
+   * level.
+   */
+  uint64_t numBisections;
+
+  /**
+   * @brief The number of vertices in the graphs at this level.
+   */
+  uint64_t numVertices;
+
+  /**
+   * @brief The number of edges in the graphs at this level.
+   */
+  uint64_t numEdges;
+
+  /**
+   * @brief The total edge weight of the graphs at this level (the weight of
+   * edges not yet collapsed by coarsening).
+   */
+  uint64_t exposedEdgeWeight;
+
+  /**
+   * @brief The cut of the bisections projected to this level, before they are
+   * refined. At the coarsest level of a bisection, this is the cut of the
+   * initial bisection.
+   */
+  uint64_t initialCut;
+
+  /**
+   * @brief The cut of the bisections after refinement at this level.
+   */
+  uint64_t refinedCut;
+
+  /**
+   * @brief The number of refinement passes made at this level.
+   */
+  uint64_t numPasses;
+
+  /**
+   * @brief The number of vertex moves made while refining at this level,
+   * including those undone.
+   */
+  uint64_t numMoves;
+
+  /**
+   * @brief The number of vertex moves kept while refining at this level.
+   */
+  uint64_t numKeptMoves;
+} poros_level_stats_struct;
+
+
+/**
+ * @brief Statistics about each level of multilevel bisection.
+ */
+typedef struct {
+  /**
+   * @brief The number of levels recorded, from the finest (level 0) to the
+   * coarsest. Levels past `POROS_MAX_STATISTICS_LEVELS` are not recorded.
+   */
+  int numLevels;
+
+  /**
+   * @brief The statistics of each level.
+   */
+  poros_level_stats_struct levels[POROS_MAX_STATISTICS_LEVELS];
+} poros_stats_struct;
+
+
 typedef struct {
   /**
    * @brief The fraction of imbalance to accept (i.e., 0.03 allows for one
@@ -91,10 +282,10 @@ typedef struct {
   unsigned int randomSeed;
 
   /**
-   * @brief The maximum number of refinement iterations to perform. A value of
-   * -1 will result in there being no maximum (any other negative value will
-   * result in an error). A value of 0 will prevent refinement from being
-   * performed.
+   * @brief The maximum number of refinement passes to make at each level of
+   * each bisection. A value of -1 will result in there being no maximum (any
+   * other negative value will result in an error). A value of 0 will prevent
+   * refinement from being performed.
    */
   int refinementIterations;
 
@@ -112,12 +303,202 @@ typedef struct {
 
   /**
    * @brief The number of global partitions to make and keep the best one.
-   * This effectively run the whole partitioner numGlobalCuts times.
+   * This effectively run the whole partitioner numGlobalCuts times. It is
+   * ignored when `timeLimitSeconds` is set.
    */
   int numGlobalCuts;
+
+  /**
+   * @brief The order in which to number the vertices of each coarse graph.
+   * Should be a member of the `coarse_ordering_type` enum. Using
+   * `BFS_ORDERING` places neighboring coarse vertices close together in
+   * memory, at the cost of an extra pass over each graph during coarsening.
+   */
+  int coarseOrdering;
+
+  /**
+   * @brief The number of bytes the partitioner should aim to stay within. If
+   * the estimated peak memory usage exceeds this, a lower memory (but slower)
+   * configuration is used. A value of 0 means there is no limit.
+   */
+  uint64_t memoryBudget;
+
+  /**
+   * @brief The name of a file holding the coarsening hierarchy of the graph.
+   * If the file exists, the hierarchy is loaded from it and the graph is not
+   * coarsened again, which is much faster when partitioning the same graph
+   * repeatedly (e.g., with different numbers of partitions or seeds).
+   * Otherwise, the hierarchy built while partitioning is saved to it, unless
+   * the `memoryBudget` forces the lower memory configuration, as keeping the
+   * hierarchy would keep every coarse graph in memory. If this is null, no
+   * hierarchy is loaded or saved.
+   */
+  char const * hierarchyFile;
+
+  /**
+   * @brief Record the time spent in each node of the recursion, level of
+   * coarsening, and phase, as a tree. The tree is written to stdout along
+   * with the other times when `outputTimes` is set. Used for development and
+   * benchmarking purposes.
+   */
+  int timingTree;
+
+  /**
+   * @brief Count hardware events (cycles, instructions, last level cache
+   * misses, data TLB misses, and branch misses) during aggregation,
+   * contraction, initial partitioning, and refinement, using
+   * `perf_event_open()`. Only events on the calling thread are counted, and
+   * events the system does not allow to be counted are reported as zero. The
+   * counts are written to stdout along with the other times when
+   * `outputTimes` is set. Used for development and benchmarking purposes.
+   */
+  int hardwareCounters;
+
+  /**
+   * @brief The name of a file to write a timeline of partitioning to, in the
+   * Chrome trace event format (viewable with `chrome://tracing` or
+   * Perfetto). Each aggregation, contraction, initial bisection, projection,
+   * refinement pass, and subgraph extraction is an event, tagged with its
+   * level and the range of partitions of its recursion node. If this is
+   * null, no timeline is recorded.
+   */
+  char const * traceFile;
+
+  /**
+   * @brief Where to write statistics about each level of multilevel
+   * bisection (output), summed over all bisections made, including those of
+   * each of the `numGlobalCuts` partitionings. If this is null, no statistics
+   * are recorded.
+   */
+  poros_stats_struct * statistics;
+
+  /**
+   * @brief The number of seconds partitioning should take. If this is
+   * positive, new partitionings are made for as long as another is expected
+   * to finish in time (instead of `numGlobalCuts`), refinement stops early
+   * once the time is up, and the best balanced partitioning is kept. At
+   * least one partitioning is always made, so a limit too short for it will
+   * be exceeded. A value of 0 means there is no limit.
+   */
+  double timeLimitSeconds;
+
+  /**
+   * @brief A function to report progress to, after each level of coarsening
+   * is built, each initial bisection, each level of refinement, and each
+   * partitioning of the whole graph. It is called on the thread partitioning
+   * the graph, and may cancel the partitioning. If this is null, progress is
+   * not reported.
+   */
+  poros_progress_callback progressCallback;
+
+  /**
+   * @brief The data to pass to `progressCallback`.
+   */
+  void * progressData;
+
+  /**
+   * @brief The scheme used to bisect the coarsest graph of each bisection.
+   * Should be a member of the `bisector_type` enum.
+   */
+  int initialBisectionScheme;
+
+  /**
+   * @brief The number of initial bisections to make of the coarsest graph,
+   * keeping the best. Must be positive.
+   */
+  int numInitialBisections;
+
+  /**
+   * @brief The number of vertices to coarsen each graph down to before
+   * making its initial bisection. Must be positive.
+   */
+  poros_vtx_type coarsestNumVertices;
+
+  /**
+   * @brief Stop coarsening once a coarse graph has more than this fraction of
+   * the edges of its fine graph (i.e., coarsening has stopped shrinking it).
+   * Must be positive.
+   */
+  double coarseningEdgeRatio;
+
+  /**
+   * @brief The heaviest a coarse vertex may become, as a multiple of the
+   * average weight of a vertex of a graph of `coarsestNumVertices`. Must be
+   * positive.
+   */
+  double maxVertexWeightFactor;
 } poros_options_struct;
 
 
+/**
+ * @brief One graph of a batch to partition, and where to write its
+ * partitioning.
+ */
+typedef struct {
+  /**
+   * @brief The number of vertices in the graph.
+   */
+  poros_vtx_type numVertices;
+
+  /**
+   * @brief The prefixsum of the edge list (xadj or rowptr).
+   */
+  poros_adj_type const * edgePrefix;
+
+  /**
+   * @brief The list of edge endpoints (adjncy or rowind).
+   */
+  poros_vtx_type const * edgeList;
+
+  /**
+   * @brief The list of vertex weights (if null, every vertex will be
+   * assigned a weight of 1).
+   */
+  poros_wgt_type const * vertexWeights;
+
+  /**
+   * @brief The weight associated with each edge (if null, every edge will
+   * be assigned a weight of 1).
+   */
+  poros_wgt_type const * edgeWeights;
+
+  /**
+   * @brief The number of partitions to create.
+   */
+  poros_pid_type numPartitions;
+
+  /**
+   * @brief The total weight of cut edges (output).
+   */
+  poros_wgt_type totalCutEdgeWeight;
+
+  /**
+   * @brief The partition assignment of each vertex (output).
+   */
+  poros_pid_type * partitionAssignment;
+
+  /**
+   * @brief 1 if the graph was partitioned, 0 if an error occurred or the
+   * partitioning was cancelled (output).
+   */
+  int status;
+} poros_batch_graph_struct;
+
+
+/**
+ * @brief A graph being streamed in to poros, one block of vertices at a
+ * time (opaque).
+ */
+typedef struct poros_stream_struct poros_stream_struct;
+
+
+/**
+ * @brief The state kept between partitionings made with the same options
+ * (opaque).
+ */
+typedef struct poros_context_struct poros_context_struct;
+
+
 /**
  * @brief Generate the default options to execute Poros with.
  *
@@ -126,6 +507,18 @@ typedef struct {
 poros_options_struct POROS_defaultOptions(void);
 
 
+/**
+ * @brief Generate the options of a preset, any of which may then be changed.
+ *
+ * @param preset The preset. Should be a member of the `preset_type` enum
+ * (any other value gives the default options).
+ *
+ * @return The options.
+ */
+poros_options_struct POROS_presetOptions(
+    int preset);
+
+
 /**
  * @brief Partition a graph using recursive bisection.
  *
@@ -142,7 +535,8 @@ poros_options_struct POROS_defaultOptions(void);
  * @param totalCutEdgeWeight The total weight of cut edges (output).
  * @param partitionAssignment The partition assignment of each vertex.
  *
- * @return 1 on success, 0 if an error occurs.
+ * @return 1 on success, 0 if an error occurs or the partitioning is
+ * cancelled by the `progressCallback` of the options.
  */
 int POROS_PartGraphRecursive(
     poros_vtx_type numVertices,
@@ -156,6 +550,177 @@ int POROS_PartGraphRecursive(
     poros_pid_type * partitionAssignment);
 
 
+/**
+ * @brief Partition a batch of independent graphs using recursive bisection.
+ * The graphs are shared out between the OpenMP threads as they become free,
+ * and each thread re-uses its own partitioning components and working
+ * buffers for every graph it is given. This is meant for many graphs which
+ * are each too small to be worth partitioning in parallel. Each graph is
+ * partitioned exactly as by `POROS_PartGraphRecursive()` with the same
+ * options.
+ *
+ * @param graphs The graphs, each of which has its outputs set.
+ * @param numGraphs The number of graphs.
+ * @param options The list of options to use. These apply to every graph, so
+ * `hierarchyFile`, `traceFile`, and `statistics` must be null, and
+ * `outputTimes` is ignored. The `progressCallback` may be called by several
+ * threads at once, and cancels only the graph it is called for. As a graph
+ * is partitioned by each thread at once, each is given an equal share of the
+ * `memoryBudget`, and a graph which does not fit within its share is
+ * partitioned in the lower memory configuration.
+ *
+ * @return 1 if every graph was partitioned, 0 if any was not (or the options
+ * are invalid, in which case no graph is partitioned).
+ */
+int POROS_PartGraphBatch(
+    poros_batch_graph_struct * graphs,
+    size_t numGraphs,
+    poros_options_struct const * options);
+
+
+/**
+ * @brief Start streaming in a graph. The graph is assembled from blocks of
+ * consecutive vertices passed to `POROS_StreamAddVertices()`, so the caller
+ * only needs to hold one block at a time, and the first level of coarsening
+ * is performed as each block arrives.
+ *
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges in the graph (counted in each
+ * direction).
+ * @param hasVertexWeights Non-zero if vertex weights will be given.
+ * @param hasEdgeWeights Non-zero if edge weights will be given.
+ *
+ * @return The stream, which must be freed with `POROS_StreamFree()`, or null
+ * if there was not enough memory for a graph of this size.
+ */
+poros_stream_struct * POROS_StreamCreate(
+    poros_vtx_type numVertices,
+    poros_adj_type numEdges,
+    int hasVertexWeights,
+    int hasEdgeWeights);
+
+
+/**
+ * @brief Add the next block of vertices to a stream. Each edge must be given
+ * in both directions, as with `POROS_PartGraphRecursive()`, and the arrays
+ * may be re-used as soon as this returns.
+ *
+ * @param stream The stream.
+ * @param numVertices The number of vertices in the block.
+ * @param edgePrefix The prefixsum of the edge list of the block, starting at
+ * 0 (of length numVertices+1).
+ * @param edgeList The list of edge endpoints of the block (numbered
+ * globally).
+ * @param vertexWeights The weight of each vertex in the block (must be null
+ * if and only if the stream was created without vertex weights).
+ * @param edgeWeights The weight of each edge in the block (must be null if
+ * and only if the stream was created without edge weights).
+ *
+ * @return 1 on success, 0 if the block does not fit the graph or the stream
+ * has already been partitioned.
+ */
+int POROS_StreamAddVertices(
+    poros_stream_struct * stream,
+    poros_vtx_type numVertices,
+    poros_adj_type const * edgePrefix,
+    poros_vtx_type const * edgeList,
+    poros_wgt_type const * vertexWeights,
+    poros_wgt_type const * edgeWeights);
+
+
+/**
+ * @brief Partition a streamed graph using recursive bisection, once all of
+ * its vertices have been added. The stream may be partitioned any number of
+ * times, and later calls re-use the coarsening built by earlier ones. The
+ * first level of coarsening is the greedy heavy edge matching made while the
+ * vertices were added, so it does not depend on the `aggregationScheme`,
+ * `randomSeed`, or `coarseOrdering` of the options, and it is shared by all
+ * `numGlobalCuts` partitionings.
+ *
+ * @param stream The stream.
+ * @param numPartitions The number of partitions to create.
+ * @param options The list of options to use.
+ * @param totalCutEdgeWeight The total weight of cut edges (output).
+ * @param partitionAssignment The partition assignment of each vertex.
+ *
+ * @return 1 on success, 0 if an error occurs (including the graph being
+ * incomplete) or the partitioning is cancelled.
+ */
+int POROS_StreamPartGraphRecursive(
+    poros_stream_struct * stream,
+    poros_pid_type numPartitions,
+    poros_options_struct const * options,
+    poros_wgt_type * totalCutEdgeWeight,
+    poros_pid_type * partitionAssignment);
+
+
+/**
+ * @brief Free a stream and its graph.
+ *
+ * @param stream The stream (may be null).
+ */
+void POROS_StreamFree(
+    poros_stream_struct * stream);
+
+
+/**
+ * @brief Create a context for partitioning many graphs with the same options.
+ * The random engine, timers, partitioning components, and working buffers are
+ * created once and re-used by each call to `POROS_PartGraphWithContext()`,
+ * rather than being rebuilt for every graph. A context must not be used by
+ * more than one thread at a time.
+ *
+ * @param options The options to use. These are copied, but any files or
+ * statistics they point to must outlive the context.
+ *
+ * @return The context, which must be freed with `POROS_ContextDestroy()`, or
+ * null if the options are null.
+ */
+poros_context_struct * POROS_ContextCreate(
+    poros_options_struct const * options);
+
+
+/**
+ * @brief Partition a graph using recursive bisection and the options of a
+ * context. The result is the same as that of `POROS_PartGraphRecursive()`
+ * with those options.
+ *
+ * @param context The context.
+ * @param numVertices The number of vertices in the graph.
+ * @param edgePrefix The prefixsum of the edge list (xadj or rowptr).
+ * @param edgeList The list of edge endpoints (adjncy or rowind).
+ * @param vertexWeights The list of vertex weights (if null, every vertex will
+ * be assigned a weight of 1).
+ * @param edgeWeights The weight associated with each edge (if null, every
+ * edge will be assigned a weight of 1).
+ * @param numPartitions The number of partitions to create.
+ * @param totalCutEdgeWeight The total weight of cut edges (output).
+ * @param partitionAssignment The partition assignment of each vertex.
+ *
+ * @return 1 on success, 0 if an error occurs or the partitioning is
+ * cancelled. A cancelled context may be used again.
+ */
+int POROS_PartGraphWithContext(
+    poros_context_struct * context,
+    poros_vtx_type numVertices,
+    poros_adj_type const * edgePrefix,
+    poros_vtx_type const * edgeList,
+    poros_wgt_type const * vertexWeights,
+    poros_wgt_type const * edgeWeights,
+    poros_pid_type numPartitions,
+    poros_wgt_type * totalCutEdgeWeight,
+    poros_pid_type * partitionAssignment);
+
+
+/**
+ * @brief Free a context.
+ *
+ * @param context The context (may be null).
+ */
+void POROS_ContextDestroy(
+    poros_context_struct * context);
+
+
 
 #ifdef __cplusplus
 }
@@ -29,32 +29,211 @@
 #include "poros.h"
 
 #include "Base.hpp"
-#include "PorosParameters.hpp"
+#include "PorosPipeline.hpp"
 #include "graph/Graph.hpp"
 #include "partition/Partitioning.hpp"
-#include "partition/PartitionParameters.hpp"
-#include "partition/BisectorFactory.hpp"
-#include "partition/MultiBisector.hpp"
-#include "partition/TwoWayRefinerFactory.hpp"
-#include "aggregation/AggregatorFactory.hpp"
 #include "partition/MultilevelBisector.hpp"
-#include "partition/RecursiveBisectionPartitioner.hpp"
-#include "util/RandomEngineHandle.hpp"
-#include "util/TimeKeeper.hpp"
-
-#include "solidutils/Timer.hpp"
+#include "aggregation/ContractorFactory.hpp"
+#include "multilevel/CoarseningHierarchy.hpp"
+#include "graph/StreamingGraphBuilder.hpp"
+#include "aggregation/StreamingMatcher.hpp"
+#include "util/MemoryKeeper.hpp"
+#include "util/AllocationCounter.hpp"
+#include "util/PerfCounters.hpp"
+#include "util/MemoryPolicy.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 using namespace poros;
 
 
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+/**
+* @brief A graph being streamed in. The builder and matcher are released once
+* the graph is complete.
+*/
+struct poros_stream_struct
+{
+  std::unique_ptr<StreamingGraphBuilder> builder;
+  std::unique_ptr<StreamingMatcher> matcher;
+  std::unique_ptr<Graph> graph;
+  std::unique_ptr<CoarseningHierarchy> hierarchy;
+
+  poros_stream_struct() :
+    builder(),
+    matcher(),
+    graph(),
+    hierarchy()
+  {
+    // do nothing
+  }
+};
+
+
+/**
+* @brief A pipeline kept between partitionings, along with the options it was
+* created with.
+*/
+struct poros_context_struct
+{
+  poros_options_struct options;
+  std::unique_ptr<PorosPipeline> pipeline;
+
+  poros_context_struct(
+      poros_options_struct const & opts) :
+    options(opts),
+    pipeline(new PorosPipeline(options))
+  {
+    // do nothing
+  }
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief Copy the statistics of each level to the C API struct.
+*
+* @param statistics The statistics.
+* @param output The struct to write to (output).
+*/
+void outputStatistics(
+    LevelStatistics const * const statistics,
+    poros_stats_struct * const output)
+{
+  std::vector<LevelStatistics::level_struct> const & levels = \
+      statistics->levels();
+
+  size_t const numLevels = std::min(levels.size(), \
+      static_cast<size_t>(POROS_MAX_STATISTICS_LEVELS));
+  output->numLevels = static_cast<int>(numLevels);
+  for (size_t i = 0; i < numLevels; ++i) {
+    poros_level_stats_struct & level = output->levels[i];
+    level.numBisections = levels[i].numBisections;
+    level.numVertices = levels[i].numVertices;
+    level.numEdges = levels[i].numEdges;
+    level.exposedEdgeWeight = levels[i].exposedEdgeWeight;
+    level.initialCut = levels[i].initialCut;
+    level.refinedCut = levels[i].refinedCut;
+    level.numPasses = levels[i].refinement.numPasses();
+    level.numMoves = levels[i].refinement.numMoves();
+    level.numKeptMoves = levels[i].refinement.numKeptMoves();
+  }
+}
+
+
+/**
+* @brief Partition a graph using recursive bisection.
+*
+* @param pipeline The pipeline to partition with.
+* @param baseGraph The graph.
+* @param numPartitions The number of partitions to create.
+* @param options The options the pipeline was created with.
+* @param baseHierarchy The coarsening hierarchy of the graph built so far
+* (may be null).
+* @param totalCutEdgeWeight The total weight of cut edges (output).
+* @param partitionAssignment The partition assignment of each vertex.
+*
+* @return 1 on success, 0 if an error occurs.
+*/
+int partitionGraph(
+    PorosPipeline * const pipeline,
+    Graph const * const baseGraph,
+    pid_type const numPartitions,
+    poros_options_struct const * const options,
+    CoarseningHierarchy * const baseHierarchy,
+    wgt_type * const totalCutEdgeWeight,
+    pid_type * const partitionAssignment)
+{
+  try {
+    Partitioning part = pipeline->execute(baseGraph, numPartitions, \
+        baseHierarchy);
+    part.output(totalCutEdgeWeight, partitionAssignment);
+    if (options->traceFile != nullptr) {
+      pipeline->writeTrace(options->traceFile);
+    }
+  } catch (std::exception const &) {
+    // nothing may be thrown across the C API, including std::bad_alloc
+    return 0;
+  }
+
+  if (options->statistics != nullptr) {
+    outputStatistics(pipeline->statistics(), options->statistics);
+  }
+
+  if (options->outputTimes) {
+    for (std::pair<std::string, double> const & pair : \
+        pipeline->timeKeeper()->times()) {
+      std::cout << pair.first << ": " << pair.second << std::endl;
+    }
+    if (options->timingTree) {
+      pipeline->timeKeeper()->writeTree(&std::cout);
+    }
+    if (options->hardwareCounters) {
+      for (std::pair<std::string, PerfCounters::sample_type> const & pair : \
+          pipeline->timeKeeper()->counts()) {
+        for (uint32_t i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+          if (PerfCounters::local().isAvailable(i) && pair.second[i] > 0) {
+            std::cout << pair.first << " " << PerfCounters::name(i) << \
+                ": " << pair.second[i] << std::endl;
+          }
+        }
+      }
+    }
+    if (AllocationCounter::isEnabled()) {
+      for (std::pair<std::string, AllocationCounter::sample_struct> const & \
+          pair : pipeline->timeKeeper()->allocations()) {
+        std::cout << pair.first << " allocations: " << pair.second.count << \
+            " (" << pair.second.bytes << " bytes)" << std::endl;
+      }
+    }
+    for (MemoryKeeper::usage_struct const & usage : \
+        pipeline->memoryKeeper()->usage()) {
+      std::cout << usage.name << " allocated: " << usage.allocated << \
+          " bytes, peak: " << usage.peak << " bytes" << std::endl;
+    }
+    if (pipeline->lowMemory()) {
+      std::cout << "Using low memory mode to fit budget of " << \
+          options->memoryBudget << " bytes" << std::endl;
+    }
+  }
+
+  return 1;
+}
+
+}
+
+
+
 /******************************************************************************
 * PUBLIC FUNCTIONS ************************************************************
 ******************************************************************************/
 
 poros_options_struct POROS_defaultOptions()
+{
+  return POROS_presetOptions(DEFAULT_PRESET);
+}
+
+poros_options_struct POROS_presetOptions(
+    int const preset)
 {
   poros_options_struct opts{
     0.03,
@@ -63,9 +242,37 @@ poros_options_struct POROS_defaultOptions()
     8,
     SORTED_HEAVY_EDGE_MATCHING,
     false,
-    1
+    1,
+    NATURAL_ORDERING,
+    0,
+    nullptr,
+    false,
+    false,
+    nullptr,
+    nullptr,
+    0.0,
+    nullptr,
+    nullptr,
+    BFS_BISECTION,
+    8,
+    20,
+    0.95,
+    1.5
   };
 
+  // coarsening takes most of the time, so the fast preset stops it once it
+  // has slowed, and saves what it can of initial partitioning and refinement
+  if (preset == FAST_PRESET) {
+    opts.refinementIterations = 2;
+    opts.numInitialBisections = 2;
+    opts.coarseningEdgeRatio = 0.75;
+  } else if (preset == QUALITY_PRESET) {
+    opts.refinementIterations = 16;
+    opts.numInitialBisections = 16;
+    opts.coarsestNumVertices = 40;
+    opts.numGlobalCuts = 4;
+  }
+
   return opts;
 }
 
@@ -85,60 +292,244 @@ int POROS_PartGraphRecursive(
     return 0;
   }
 
-  sl::Timer totalTimer;
-  totalTimer.start();
+  // assemble a new graph
+  Graph baseGraph(numVertices, edgePrefix[numVertices], edgePrefix, \
+      edgeList, vertexWeights, edgeWeights);
+
+  // the edge arrays of the input graph are accessed randomly by every level
+  // of refinement
+  MemoryPolicy::adviseHugePages(edgeList, \
+      edgePrefix[numVertices]*sizeof(vtx_type));
+  MemoryPolicy::adviseHugePages(edgeWeights, \
+      edgePrefix[numVertices]*sizeof(wgt_type));
+
+  PorosPipeline pipeline(*options);
+  return partitionGraph(&pipeline, &baseGraph, numPartitions, options, \
+      nullptr, totalCutEdgeWeight, partitionAssignment);
+}
+
+int POROS_PartGraphBatch(
+    poros_batch_graph_struct * const graphs,
+    size_t const numGraphs,
+    poros_options_struct const * const options)
+{
+  if (options == nullptr || (graphs == nullptr && numGraphs > 0) || \
+      options->hierarchyFile != nullptr || options->traceFile != nullptr || \
+      options->statistics != nullptr) {
+    // the options must not refer to any single graph
+    return 0;
+  }
+
+  poros_options_struct batchOptions = *options;
+  batchOptions.outputTimes = 0;
 
-  std::shared_ptr<TimeKeeper> timeKeeper(new TimeKeeper);
+  size_t numFailed = 0;
+  #ifdef _OPENMP
+  #pragma omp parallel reduction(+:numFailed)
+  #endif
+  {
+    // the threads' pipelines all run at once, so they share the memory
+    // budget evenly
+    poros_options_struct threadOptions = batchOptions;
+    #ifdef _OPENMP
+    if (threadOptions.memoryBudget > 0) {
+      threadOptions.memoryBudget = std::max(static_cast<uint64_t>(1), \
+          threadOptions.memoryBudget / \
+          static_cast<uint64_t>(omp_get_num_threads()));
+    }
+    #endif
 
-  PorosParameters globalParams(*options);
+    // each thread keeps its own pipeline, and with it its own working
+    // buffers, for all of the graphs it partitions
+    std::unique_ptr<PorosPipeline> pipeline;
+    try {
+      pipeline.reset(new PorosPipeline(threadOptions));
+    } catch (std::exception const &) {
+      // nothing may be thrown out of the parallel region, so each graph
+      // given to this thread fails instead
+    }
 
-  // create a parameters object
-  RandomEngineHandle randEngine = globalParams.randomEngine();
+    // the graphs may differ greatly in size, so hand them out one at a time
+    #ifdef _OPENMP
+    #pragma omp for schedule(dynamic, 1)
+    #endif
+    for (size_t i = 0; i < numGraphs; ++i) {
+      poros_batch_graph_struct & desc = graphs[i];
+      desc.status = 0;
+      if (pipeline) {
+        try {
+          Graph const graph(desc.numVertices, \
+              desc.edgePrefix[desc.numVertices], desc.edgePrefix, \
+              desc.edgeList, desc.vertexWeights, desc.edgeWeights);
+          desc.status = partitionGraph(pipeline.get(), &graph, \
+              desc.numPartitions, &threadOptions, nullptr, \
+              &desc.totalCutEdgeWeight, desc.partitionAssignment);
+        } catch (std::exception const &) {
+          // nothing may be thrown out of the parallel region
+          desc.status = 0;
+        }
+      }
+      if (desc.status == 0) {
+        ++numFailed;
+      }
+    }
+  }
 
-  // assemble a new graph
-  Graph baseGraph(numVertices, edgePrefix[numVertices], edgePrefix, \
-      edgeList, vertexWeights, edgeWeights);
+  return numFailed == 0 ? 1 : 0;
+}
 
-  // setup paramters for the partition
-  PartitionParameters params(numPartitions);
+poros_stream_struct * POROS_StreamCreate(
+    vtx_type const numVertices,
+    adj_type const numEdges,
+    int const hasVertexWeights,
+    int const hasEdgeWeights)
+{
+  std::unique_ptr<poros_stream_struct> stream;
+  try {
+    stream.reset(new poros_stream_struct);
+    stream->builder.reset(new StreamingGraphBuilder(numVertices, numEdges, \
+        hasVertexWeights != 0, hasEdgeWeights != 0));
+    stream->matcher.reset(new StreamingMatcher(numVertices));
+  } catch (std::bad_alloc const &) {
+    // the graph is too large to allocate
+    return nullptr;
+  }
 
-  // partition the graph
-  std::unique_ptr<IAggregator> agg = AggregatorFactory::make(
-      globalParams.aggregationScheme(), randEngine, timeKeeper);
+  return stream.release();
+}
 
-  std::unique_ptr<IBisector> bisector = \
-      BisectorFactory::make(BFS_BISECTION, randEngine, 8, timeKeeper);
-  std::unique_ptr<ITwoWayRefiner> refiner = \
-      TwoWayRefinerFactory::make(FM_TWOWAY_REFINEMENT, timeKeeper);
+int POROS_StreamAddVertices(
+    poros_stream_struct * const stream,
+    vtx_type const numVertices,
+    adj_type const * const edgePrefix,
+    vtx_type const * const edgeList,
+    wgt_type const * const vertexWeights,
+    wgt_type const * const edgeWeights)
+{
+  if (stream == nullptr || !stream->builder) {
+    // the stream must not be complete
+    return 0;
+  }
 
-  MultilevelBisector ml(std::move(agg), std::move(bisector), \
-      std::move(refiner), timeKeeper);
+  StreamingGraphBuilder * const builder = stream->builder.get();
+  vtx_type const start = builder->numAddedVertices();
+  try {
+    builder->addVertices(numVertices, edgePrefix, edgeList, vertexWeights, \
+        edgeWeights);
+  } catch (std::runtime_error const &) {
+    return 0;
+  }
 
-  RecursiveBisectionPartitioner partitioner(&ml);
+  // start the first level of coarsening while later blocks are produced
+  stream->matcher->match(start, builder->numAddedVertices(), \
+      builder->getEdgePrefix(), builder->getEdgeList(), \
+      builder->getEdgeWeight());
 
-  TargetPartitioning target(params.numPartitions(), \
-      baseGraph.getTotalVertexWeight(), params.getImbalanceTolerance(), \
-      params.getTargetPartitionFractions());
+  return 1;
+}
 
-  wgt_type bestCut;
-  for (int i = 0; i < options->numGlobalCuts; ++i) {
-    Partitioning part = partitioner.execute(&target, &baseGraph);
+int POROS_StreamPartGraphRecursive(
+    poros_stream_struct * const stream,
+    pid_type const numPartitions,
+    poros_options_struct const * const options,
+    wgt_type * const totalCutEdgeWeight,
+    pid_type * const partitionAssignment)
+{
+  if (stream == nullptr || options == nullptr) {
+    // neither the stream nor the options may be null
+    return 0;
+  }
 
-    if (i == 0 || part.getCutEdgeWeight() < bestCut) {
-      bestCut = part.getCutEdgeWeight();
-      // output data
-      part.output(totalCutEdgeWeight, partitionAssignment);
+  if (!stream->graph) {
+    if (options->coarsestNumVertices <= 0 || \
+        !(options->maxVertexWeightFactor > 0)) {
+      // the first level of coarsening cannot be made with these options
+      return 0;
     }
-  }
 
-  totalTimer.stop();
-  timeKeeper->reportTime(TimeKeeper::TOTAL, totalTimer.poll());
+    try {
+      stream->graph.reset(new Graph(stream->builder->finish()));
+      stream->builder.reset();
 
-  if (options->outputTimes) {
-    for (std::pair<std::string, double> const & pair : timeKeeper->times()) {
-      std::cout << pair.first << ": " << pair.second << std::endl;
+      // the matching made while streaming is the first level of coarsening
+      Graph const * const graph = stream->graph.get();
+      Aggregation agg = stream->matcher->build( \
+          MultilevelBisector::aggregationParameters(graph, \
+          options->coarsestNumVertices, options->maxVertexWeightFactor), \
+          graph);
+      stream->matcher.reset();
+
+      sl::Array<vtx_type> coarseMap(graph->numVertices());
+      agg.fillCoarseMap(coarseMap.data());
+
+      stream->hierarchy.reset(new CoarseningHierarchy(graph));
+      stream->hierarchy->addLevel( \
+          ContractorFactory::make(true)->contract(graph, &agg), \
+          std::move(coarseMap));
+    } catch (std::exception const &) {
+      // nothing may be thrown across the C API, and without a complete first
+      // level, later calls coarsen the graph from scratch
+      stream->hierarchy.reset();
+      if (stream->graph) {
+        stream->matcher.reset();
+      }
+      return 0;
     }
   }
 
-  return 1;
+  PorosPipeline pipeline(*options);
+  return partitionGraph(&pipeline, stream->graph.get(), numPartitions, \
+      options, stream->hierarchy.get(), totalCutEdgeWeight, \
+      partitionAssignment);
+}
+
+void POROS_StreamFree(
+    poros_stream_struct * const stream)
+{
+  delete stream;
+}
+
+poros_context_struct * POROS_ContextCreate(
+    poros_options_struct const * const options)
+{
+  if (options == nullptr) {
+    // options must not be null
+    return nullptr;
+  }
+
+  return new poros_context_struct(*options);
+}
+
+int POROS_PartGraphWithContext(
+    poros_context_struct * const context,
+    vtx_type const numVertices,
+    adj_type const * const edgePrefix,
+    vtx_type const * const edgeList,
+    wgt_type const * const vertexWeights,
+    wgt_type const * const edgeWeights,
+    pid_type const numPartitions,
+    wgt_type * const totalCutEdgeWeight,
+    pid_type * const partitionAssignment)
+{
+  if (context == nullptr) {
+    // the context must not be null
+    return 0;
+  }
+
+  Graph baseGraph(numVertices, edgePrefix[numVertices], edgePrefix, \
+      edgeList, vertexWeights, edgeWeights);
+
+  MemoryPolicy::adviseHugePages(edgeList, \
+      edgePrefix[numVertices]*sizeof(vtx_type));
+  MemoryPolicy::adviseHugePages(edgeWeights, \
+      edgePrefix[numVertices]*sizeof(wgt_type));
+
+  return partitionGraph(context->pipeline.get(), &baseGraph, numPartitions, \
+      &context->options, nullptr, totalCutEdgeWeight, partitionAssignment);
+}
+
+void POROS_ContextDestroy(
+    poros_context_struct * const context)
+{
+  delete context;
 }
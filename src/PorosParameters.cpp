@@ -41,7 +41,16 @@ namespace poros
 PorosParameters::PorosParameters(
     poros_options_struct const options) :
   m_randomEngine(RandomEngineFactory::make(options.randomSeed)),
-  m_aggregationScheme(options.aggregationScheme)
+  m_aggregationScheme(options.aggregationScheme),
+  m_coarseOrdering(options.coarseOrdering),
+  m_memoryBudget(options.memoryBudget),
+  m_hierarchyFile(options.hierarchyFile ? options.hierarchyFile : ""),
+  m_refinementIterations(options.refinementIterations),
+  m_initialBisectionScheme(options.initialBisectionScheme),
+  m_numInitialBisections(options.numInitialBisections),
+  m_coarsestNumVertices(options.coarsestNumVertices),
+  m_coarseningEdgeRatio(options.coarseningEdgeRatio),
+  m_maxVertexWeightFactor(options.maxVertexWeightFactor)
 {
   // do nothing
 }
@@ -62,5 +71,50 @@ int PorosParameters::aggregationScheme() const
   return m_aggregationScheme;
 }
 
+int PorosParameters::coarseOrdering() const
+{
+  return m_coarseOrdering;
+}
+
+uint64_t PorosParameters::memoryBudget() const
+{
+  return m_memoryBudget;
+}
+
+std::string const & PorosParameters::hierarchyFile() const
+{
+  return m_hierarchyFile;
+}
+
+int PorosParameters::refinementIterations() const
+{
+  return m_refinementIterations;
+}
+
+int PorosParameters::initialBisectionScheme() const
+{
+  return m_initialBisectionScheme;
+}
+
+int PorosParameters::numInitialBisections() const
+{
+  return m_numInitialBisections;
+}
+
+vtx_type PorosParameters::coarsestNumVertices() const
+{
+  return m_coarsestNumVertices;
+}
+
+double PorosParameters::coarseningEdgeRatio() const
+{
+  return m_coarseningEdgeRatio;
+}
+
+double PorosParameters::maxVertexWeightFactor() const
+{
+  return m_maxVertexWeightFactor;
+}
+
 
 }
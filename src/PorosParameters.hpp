@@ -31,8 +31,11 @@
 #define POROS_SRC_POROSPARAMETERS_HPP
 
 #include "poros.h"
+#include "Base.hpp"
 #include "util/RandomEngineHandle.hpp"
 
+#include <string>
+
 namespace poros
 {
 
@@ -62,9 +65,85 @@ class PorosParameters
      */
     int aggregationScheme() const;
 
+    /**
+     * @brief Get the ordering of coarse vertices to use.
+     *
+     * @return The coarse vertex ordering.
+     */
+    int coarseOrdering() const;
+
+    /**
+     * @brief Get the memory budget in bytes (0 if there is none).
+     *
+     * @return The memory budget.
+     */
+    uint64_t memoryBudget() const;
+
+    /**
+     * @brief Get the file to load or save the coarsening hierarchy from (empty
+     * if there is none).
+     *
+     * @return The name of the file.
+     */
+    std::string const & hierarchyFile() const;
+
+    /**
+     * @brief Get the maximum number of refinement passes to make at each
+     * level (-1 if there is no maximum).
+     *
+     * @return The number of passes.
+     */
+    int refinementIterations() const;
+
+    /**
+     * @brief Get the scheme to make initial bisections with.
+     *
+     * @return The bisection scheme.
+     */
+    int initialBisectionScheme() const;
+
+    /**
+     * @brief Get the number of initial bisections to make.
+     *
+     * @return The number of bisections.
+     */
+    int numInitialBisections() const;
+
+    /**
+     * @brief Get the number of vertices to coarsen down to.
+     *
+     * @return The number of vertices.
+     */
+    vtx_type coarsestNumVertices() const;
+
+    /**
+     * @brief Get the ratio of coarse to fine edges at which to stop
+     * coarsening.
+     *
+     * @return The ratio.
+     */
+    double coarseningEdgeRatio() const;
+
+    /**
+     * @brief Get the maximum weight of a coarse vertex, relative to the
+     * average weight of a vertex of the coarsest graph.
+     *
+     * @return The factor.
+     */
+    double maxVertexWeightFactor() const;
+
   private:
     RandomEngineHandle m_randomEngine;
     int m_aggregationScheme;
+    int m_coarseOrdering;
+    uint64_t m_memoryBudget;
+    std::string m_hierarchyFile;
+    int m_refinementIterations;
+    int m_initialBisectionScheme;
+    int m_numInitialBisections;
+    vtx_type m_coarsestNumVertices;
+    double m_coarseningEdgeRatio;
+    double m_maxVertexWeightFactor;
 };
 
 }
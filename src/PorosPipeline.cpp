@@ -0,0 +1,379 @@
+/**
+* @file PorosPipeline.cpp
+* @brief Implementation of the PorosPipeline class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "PorosPipeline.hpp"
+#include "PorosParameters.hpp"
+#include "partition/PartitionParameters.hpp"
+#include "partition/TargetPartitioning.hpp"
+#include "partition/PartitioningAnalyzer.hpp"
+#include "partition/BisectorFactory.hpp"
+#include "partition/TwoWayRefinerFactory.hpp"
+#include "partition/MultilevelBisector.hpp"
+#include "partition/RecursiveBisectionPartitioner.hpp"
+#include "aggregation/AggregatorFactory.hpp"
+#include "aggregation/ContractorFactory.hpp"
+#include "util/RandomEngineHandle.hpp"
+#include "util/MemoryScope.hpp"
+#include "util/TimeScope.hpp"
+
+#include "solidutils/Timer.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief Estimate the peak number of bytes needed to partition a graph. The
+* coarsening hierarchy is bounded by roughly twice the size of the input
+* graph, and the finest level additionally needs a partitioning, its
+* connectivity, and the border set. In-place recursion adds two working
+* copies of the graph.
+*
+* @param graph The graph.
+*
+* @return The estimated number of bytes.
+*/
+size_t estimatePeakMemory(
+    Graph const * const graph)
+{
+  size_t const perVertex = sizeof(pid_type) + 2*sizeof(wgt_type) + \
+      2*sizeof(vtx_type);
+  return 5*graph->getMemoryUsage() + graph->numVertices()*perVertex;
+}
+
+
+/**
+* @brief Check whether a partitioning is better than the best so far. Balanced
+* partitionings are better than unbalanced ones, and are compared by their
+* cut, while unbalanced ones are compared by their imbalance.
+*
+* @param part The partitioning.
+* @param best The best partitioning so far.
+* @param target The target partitioning.
+*
+* @return True if the partitioning is better.
+*/
+bool isBetter(
+    Partitioning const * const part,
+    Partitioning const * const best,
+    TargetPartitioning const * const target)
+{
+  PartitioningAnalyzer const partAnalyzer(part, target);
+  PartitioningAnalyzer const bestAnalyzer(best, target);
+
+  if (partAnalyzer.isBalanced() != bestAnalyzer.isBalanced()) {
+    return partAnalyzer.isBalanced();
+  } else if (!partAnalyzer.isBalanced()) {
+    return partAnalyzer.calcMaxImbalance() < \
+        bestAnalyzer.calcMaxImbalance();
+  }
+
+  return part->getCutEdgeWeight() < best->getCutEdgeWeight();
+}
+
+
+/**
+* @brief Check that the parameters of partitioning are usable.
+*
+* @param parameters The parameters.
+*
+* @throw std::runtime_error If any of them is out of range.
+*/
+void checkParameters(
+    PorosParameters const & parameters)
+{
+  if (parameters.refinementIterations() < -1) {
+    throw std::runtime_error("The number of refinement iterations must be " \
+        "non-negative or -1: " + \
+        std::to_string(parameters.refinementIterations()));
+  }
+  if (parameters.numInitialBisections() <= 0) {
+    throw std::runtime_error("The number of initial bisections must be " \
+        "positive: " + std::to_string(parameters.numInitialBisections()));
+  }
+  if (parameters.coarsestNumVertices() <= 0) {
+    throw std::runtime_error("The number of coarsest vertices must be " \
+        "positive: " + std::to_string(parameters.coarsestNumVertices()));
+  }
+  if (!(parameters.coarseningEdgeRatio() > 0)) {
+    throw std::runtime_error("The coarsening edge ratio must be " \
+        "positive: " + std::to_string(parameters.coarseningEdgeRatio()));
+  }
+  if (!(parameters.maxVertexWeightFactor() > 0)) {
+    throw std::runtime_error("The maximum vertex weight factor must be " \
+        "positive: " + std::to_string(parameters.maxVertexWeightFactor()));
+  }
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+PorosPipeline::PorosPipeline(
+    poros_options_struct const & options) :
+  m_options(options),
+  m_parameters(options),
+  m_lowMemory(false),
+  m_timeKeeper(new TimeKeeper),
+  m_memoryKeeper(new MemoryKeeper),
+  m_statistics(),
+  m_deadline(),
+  m_progress(options.progressCallback, options.progressData),
+  m_numTrials(0),
+  m_bisector(),
+  m_partitioner()
+{
+  // do nothing
+}
+
+
+PorosPipeline::~PorosPipeline()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+Partitioning PorosPipeline::execute(
+    Graph const * const graph,
+    pid_type const numPartitions,
+    CoarseningHierarchy * const baseHierarchy)
+{
+  checkParameters(m_parameters);
+
+  sl::Timer totalTimer;
+  totalTimer.start();
+  m_deadline.restart(m_options.timeLimitSeconds);
+
+  // start from empty keepers and a freshly seeded engine, so that executing
+  // a re-used pipeline gives the same results as executing a new one
+  m_timeKeeper->clear();
+  m_memoryKeeper->clear();
+  m_statistics.clear();
+  m_progress.clear();
+  m_parameters.randomEngine().setSeed(m_options.randomSeed);
+
+  MemoryScope memoryScope(m_memoryKeeper, MemoryKeeper::TOTAL);
+
+  m_timeKeeper->enableTree(m_options.timingTree != 0);
+  m_timeKeeper->enableCounters(m_options.hardwareCounters != 0);
+  m_timeKeeper->enableTrace(m_options.traceFile != nullptr);
+  TimeScope timeScope(m_timeKeeper);
+
+  // setup paramters for the partition
+  PartitionParameters params(numPartitions);
+
+  // if the graph is too large to partition within the memory budget, switch
+  // to random matching, which needs no sorted vertex order, and extract the
+  // halves of each bisection one at a time
+  uint64_t const memoryBudget = m_parameters.memoryBudget();
+  bool const lowMemory = memoryBudget > 0 && \
+      estimatePeakMemory(graph) > memoryBudget;
+  buildPartitioner(lowMemory);
+
+  // re-use a saved coarsening hierarchy of the graph, or save the one built
+  // by the first bisection (unless short of memory, as the hierarchy keeps
+  // every coarse graph it holds alive)
+  CoarseningHierarchy * hierarchy = baseHierarchy;
+  std::unique_ptr<CoarseningHierarchy> fileHierarchy;
+  std::string const & hierarchyFile = m_parameters.hierarchyFile();
+  bool const loadHierarchy = !hierarchyFile.empty() && \
+      std::ifstream(hierarchyFile).good();
+  bool const saveHierarchy = !hierarchyFile.empty() && !loadHierarchy && \
+      !lowMemory;
+  if (loadHierarchy) {
+    fileHierarchy = CoarseningHierarchy::load(hierarchyFile);
+    if (!fileHierarchy->isOf(graph)) {
+      throw std::runtime_error("The hierarchy in '" + hierarchyFile + \
+          "' is of a different graph.");
+    }
+    hierarchy = fileHierarchy.get();
+  } else if (saveHierarchy && hierarchy == nullptr) {
+    fileHierarchy.reset(new CoarseningHierarchy(graph));
+    hierarchy = fileHierarchy.get();
+  }
+  m_bisector->setHierarchy(hierarchy);
+
+  TargetPartitioning target(params.numPartitions(), \
+      graph->getTotalVertexWeight(), params.getImbalanceTolerance(), \
+      params.getTargetPartitionFractions());
+
+  // with a time limit, keep making partitionings for as long as the time
+  // left is more than the average taken by those so far
+  m_progress.startTrial(0);
+  Partitioning best = m_partitioner->execute(&target, graph);
+  m_numTrials = 1;
+  m_progress.reportTrial(best.getCutEdgeWeight());
+  while (m_deadline.isSet() ? \
+      m_deadline.remaining() > m_deadline.elapsed() / m_numTrials : \
+      m_numTrials < m_options.numGlobalCuts) {
+    m_progress.startTrial(m_numTrials);
+    Partitioning part = m_partitioner->execute(&target, graph);
+    ++m_numTrials;
+    if (isBetter(&part, &best, &target)) {
+      best = std::move(part);
+    }
+    m_progress.reportTrial(best.getCutEdgeWeight());
+  }
+
+  if (saveHierarchy) {
+    hierarchy->save(hierarchyFile);
+  }
+
+  // the hierarchy does not outlive this execution
+  m_bisector->setHierarchy(nullptr);
+
+  totalTimer.stop();
+  m_timeKeeper->reportTime(TimeKeeper::TOTAL, totalTimer.poll());
+
+  return best;
+}
+
+void PorosPipeline::writeTrace(
+    std::string const & filename) const
+{
+  TraceSink const * const trace = m_timeKeeper->trace();
+  if (trace == nullptr) {
+    throw std::runtime_error("No trace was recorded.");
+  }
+
+  std::ofstream stream(filename);
+  if (!stream.good()) {
+    throw std::runtime_error("Failed to open '" + filename + \
+        "' for writing.");
+  }
+  trace->write(&stream);
+  if (!stream.good()) {
+    throw std::runtime_error("Failed to write '" + filename + "'.");
+  }
+}
+
+bool PorosPipeline::lowMemory() const noexcept
+{
+  return m_lowMemory;
+}
+
+int PorosPipeline::numTrials() const noexcept
+{
+  return m_numTrials;
+}
+
+TimeKeeper const * PorosPipeline::timeKeeper() const noexcept
+{
+  return m_timeKeeper.get();
+}
+
+MemoryKeeper const * PorosPipeline::memoryKeeper() const noexcept
+{
+  return m_memoryKeeper.get();
+}
+
+LevelStatistics const * PorosPipeline::statistics() const noexcept
+{
+  return &m_statistics;
+}
+
+
+
+/******************************************************************************
+* PRIVATE METHODS *************************************************************
+******************************************************************************/
+
+void PorosPipeline::buildPartitioner(
+    bool const lowMemory)
+{
+  if (m_partitioner && lowMemory == m_lowMemory) {
+    return;
+  }
+
+  // the partitioner refers to the bisector, so it must go first
+  m_partitioner.reset();
+  m_bisector.reset();
+  m_lowMemory = lowMemory;
+
+  RandomEngineHandle randEngine = m_parameters.randomEngine();
+  int const aggregationScheme = m_lowMemory ? RANDOM_MATCHING : \
+      m_parameters.aggregationScheme();
+
+  std::unique_ptr<IAggregator> agg = AggregatorFactory::make(
+      aggregationScheme, m_parameters.coarseOrdering(), randEngine, \
+      m_timeKeeper);
+
+  std::unique_ptr<IBisector> bisector = BisectorFactory::make( \
+      m_parameters.initialBisectionScheme(), randEngine, \
+      m_parameters.numInitialBisections(), m_timeKeeper);
+  std::unique_ptr<ITwoWayRefiner> refiner = TwoWayRefinerFactory::make( \
+      FM_TWOWAY_REFINEMENT, m_parameters.refinementIterations(), \
+      m_timeKeeper, &m_deadline);
+
+  // count coarse edges before contracting, so that each coarse graph is
+  // allocated at its exact size rather than that of its parent
+  std::unique_ptr<IContractor> contractor = ContractorFactory::make(true);
+
+  m_bisector.reset(new MultilevelBisector(std::move(agg), \
+      std::move(contractor), std::move(bisector), std::move(refiner), \
+      m_timeKeeper));
+  m_bisector->setStatistics(&m_statistics);
+  m_bisector->setCoarsening(m_parameters.coarsestNumVertices(), \
+      m_parameters.coarseningEdgeRatio(), \
+      m_parameters.maxVertexWeightFactor());
+  if (m_progress.isEnabled()) {
+    m_bisector->setProgress(&m_progress);
+  }
+
+  // permuting the halves of each bisection into a pair of working buffers
+  // avoids allocating new subgraphs at each level, but the buffers are twice
+  // the size of the graph
+  m_partitioner.reset(new RecursiveBisectionPartitioner(m_bisector.get(), \
+      m_lowMemory ? RecursiveBisectionPartitioner::EXTRACT_SEQUENTIALLY : \
+      RecursiveBisectionPartitioner::EXTRACT_IN_PLACE));
+  if (m_progress.isEnabled()) {
+    m_partitioner->setProgress(&m_progress);
+  }
+}
+
+
+}
@@ -0,0 +1,194 @@
+/**
+* @file PorosPipeline.hpp
+* @brief The PorosPipeline class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_POROSPIPELINE_HPP
+#define POROS_SRC_POROSPIPELINE_HPP
+
+#include "poros.h"
+#include "Base.hpp"
+#include "PorosParameters.hpp"
+#include "graph/Graph.hpp"
+#include "partition/Partitioning.hpp"
+#include "partition/MultilevelBisector.hpp"
+#include "partition/RecursiveBisectionPartitioner.hpp"
+#include "multilevel/CoarseningHierarchy.hpp"
+#include "multilevel/LevelStatistics.hpp"
+#include "util/Deadline.hpp"
+#include "util/ProgressMonitor.hpp"
+#include "util/TimeKeeper.hpp"
+#include "util/MemoryKeeper.hpp"
+
+#include <memory>
+#include <string>
+
+namespace poros
+{
+
+
+/**
+* @brief The full partitioning process, from a graph and a set of options to
+* the best partitioning found. This is shared by the C API and the benchmark
+* driver, so that the latter measures exactly what users run. A pipeline may
+* execute any number of times, re-using the components and working buffers
+* built by earlier executions.
+*/
+class PorosPipeline
+{
+  public:
+    /**
+    * @brief Create a new pipeline.
+    *
+    * @param options The options to partition with.
+    */
+    PorosPipeline(
+        poros_options_struct const & options);
+
+    /**
+    * @brief Deleted copy constructor.
+    *
+    * @param rhs The pipeline to copy.
+    */
+    PorosPipeline(
+        PorosPipeline const & rhs) = delete;
+
+    /**
+    * @brief Destructor.
+    */
+    ~PorosPipeline();
+
+    /**
+    * @brief Deleted copy-assignment operator.
+    *
+    * @param rhs The pipeline to copy.
+    *
+    * @return This pipeline.
+    */
+    PorosPipeline & operator=(
+        PorosPipeline const & rhs) = delete;
+
+    /**
+    * @brief Partition a graph using recursive bisection, keeping the best of
+    * `numGlobalCuts` partitionings (or of as many as fit in
+    * `timeLimitSeconds`, if it is set). The times, memory usage, and statistics
+    * of any earlier execution are replaced by those of this one, and the
+    * random engine is re-seeded, so the partitioning is the same as that of
+    * a new pipeline. Progress is reported to the `progressCallback` of the
+    * options, which may cancel the execution.
+    *
+    * @param graph The graph.
+    * @param numPartitions The number of partitions to create.
+    * @param baseHierarchy The coarsening hierarchy of the graph built so far
+    * (may be null).
+    *
+    * @return The partitioning.
+    *
+    * @throws std::runtime_error If the hierarchy file cannot be read or
+    * written, or is of a different graph, or the execution is cancelled.
+    */
+    Partitioning execute(
+        Graph const * graph,
+        pid_type numPartitions,
+        CoarseningHierarchy * baseHierarchy);
+
+    /**
+    * @brief Write the timeline traced by the last execution (if
+    * `traceFile` was set in the options) as a Chrome trace.
+    *
+    * @param filename The file to write to.
+    *
+    * @throws std::runtime_error If the file cannot be written or nothing was
+    * traced.
+    */
+    void writeTrace(
+        std::string const & filename) const;
+
+    /**
+    * @brief Check whether the last execution switched to the low memory
+    * configuration to fit the memory budget.
+    *
+    * @return True if it did.
+    */
+    bool lowMemory() const noexcept;
+
+    /**
+    * @brief Get the number of partitionings made by the last execution.
+    *
+    * @return The number of partitionings.
+    */
+    int numTrials() const noexcept;
+
+    /**
+    * @brief Get the times recorded by this pipeline.
+    *
+    * @return The time keeper.
+    */
+    TimeKeeper const * timeKeeper() const noexcept;
+
+    /**
+    * @brief Get the memory usage recorded by this pipeline.
+    *
+    * @return The memory keeper.
+    */
+    MemoryKeeper const * memoryKeeper() const noexcept;
+
+    /**
+    * @brief Get the statistics of each level of bisection recorded by this
+    * pipeline.
+    *
+    * @return The statistics.
+    */
+    LevelStatistics const * statistics() const noexcept;
+
+  private:
+    poros_options_struct m_options;
+    PorosParameters m_parameters;
+    bool m_lowMemory;
+    std::shared_ptr<TimeKeeper> m_timeKeeper;
+    std::shared_ptr<MemoryKeeper> m_memoryKeeper;
+    LevelStatistics m_statistics;
+    Deadline m_deadline;
+    ProgressMonitor m_progress;
+    int m_numTrials;
+    std::unique_ptr<MultilevelBisector> m_bisector;
+    std::unique_ptr<RecursiveBisectionPartitioner> m_partitioner;
+
+    /**
+    * @brief Build the multilevel bisector and the recursive partitioner,
+    * unless those of an earlier execution have the same configuration.
+    *
+    * @param lowMemory Whether to use the low memory configuration.
+    */
+    void buildPartitioner(
+        bool lowMemory);
+};
+
+
+}
+
+
+#endif
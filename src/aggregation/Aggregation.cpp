@@ -45,7 +45,8 @@ Aggregation::Aggregation(
   m_numCoarseVertices(numCoarseVertices),
   m_coarseMap(std::move(coarseMap)),
   m_finePrefix(numCoarseVertices+1, 0),
-  m_fineMap(m_numFineVertices)
+  m_fineMap(m_numFineVertices),
+  m_memory(sizeof(vtx_type)*(2*m_numFineVertices + numCoarseVertices + 1))
 {
   // build prefix and fine map
   for (vtx_type v = 0; v < m_numFineVertices; ++v) {
@@ -65,7 +66,8 @@ Aggregation::Aggregation(
   m_numCoarseVertices(rhs.m_numCoarseVertices),
   m_coarseMap(std::move(rhs.m_coarseMap)),
   m_finePrefix(std::move(rhs.m_finePrefix)),
-  m_fineMap(std::move(rhs.m_fineMap))
+  m_fineMap(std::move(rhs.m_fineMap)),
+  m_memory(std::move(rhs.m_memory))
 {
   rhs.m_numCoarseVertices = 0;
 }
@@ -80,6 +82,7 @@ Aggregation& Aggregation::operator=(
   m_coarseMap = std::move(rhs.m_coarseMap);
   m_finePrefix = std::move(rhs.m_finePrefix);
   m_fineMap = std::move(rhs.m_fineMap);
+  m_memory = std::move(rhs.m_memory);
 
   return *this;
 }
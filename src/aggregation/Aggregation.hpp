@@ -32,6 +32,7 @@
 
 #include "Base.hpp"
 #include "aggregation/VertexGrouping.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/Debug.hpp"
 #include "solidutils/Array.hpp"
 
@@ -154,6 +155,7 @@ class Aggregation
     sl::Array<vtx_type> m_coarseMap;
     sl::Array<vtx_type> m_finePrefix;
     sl::Array<vtx_type> m_fineMap;
+    TrackedMemory m_memory;
 
 };
 
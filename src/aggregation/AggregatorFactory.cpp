@@ -26,6 +26,7 @@
  */
 
 #include "AggregatorFactory.hpp"
+#include "BFSOrderedAggregator.hpp"
 #include "RandomMatchingAggregator.hpp"
 #include "SHEMRMAggregator.hpp"
 #include "TimedAggregator.hpp"
@@ -70,4 +71,37 @@ std::unique_ptr<IAggregator> AggregatorFactory::make(
 
   return ptr;
 }
+
+
+std::unique_ptr<IAggregator> AggregatorFactory::make(
+    int const scheme,
+    int const ordering,
+    RandomEngineHandle rng)
+{
+  std::unique_ptr<IAggregator> ptr = make(scheme, rng);
+  if (ordering == BFS_ORDERING) {
+    ptr.reset(new BFSOrderedAggregator(std::move(ptr)));
+  } else if (ordering != NATURAL_ORDERING) {
+    throw std::runtime_error("Unknown coarse ordering: " +
+        std::to_string(ordering));
+  }
+
+  return ptr;
+}
+
+
+std::unique_ptr<IAggregator> AggregatorFactory::make(
+    int const scheme,
+    int const ordering,
+    RandomEngineHandle rng,
+    std::shared_ptr<TimeKeeper> timeKeeper)
+{
+  std::unique_ptr<TimedAggregator> ptr(new TimedAggregator( \
+      make(scheme, ordering, rng)));
+  ptr->setTimeKeeper(timeKeeper);
+
+  return ptr;
+}
+
+
 }
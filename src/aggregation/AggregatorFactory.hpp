@@ -66,7 +66,39 @@ class AggregatorFactory
       int scheme,
       RandomEngineHandle rng,
       std::shared_ptr<TimeKeeper> timeKeeper);
-  
+
+  /**
+  * @brief Create a new aggregator, which numbers the coarse vertices it
+  * produces in the given order.
+  *
+  * @param scheme The scheme for aggregation to use.
+  * @param ordering The ordering of coarse vertices to use.
+  * @param rng The random number engine.
+  *
+  * @return The instantiated aggregator.
+  */
+  static std::unique_ptr<IAggregator> make(
+      int scheme,
+      int ordering,
+      RandomEngineHandle rng);
+
+  /**
+  * @brief Create a new aggregator, which numbers the coarse vertices it
+  * produces in the given order.
+  *
+  * @param scheme The scheme for aggregation to use.
+  * @param ordering The ordering of coarse vertices to use.
+  * @param rng The random number engine.
+  * @param timeKeeper The time keeper to report times to.
+  *
+  * @return The instantiated aggregator.
+  */
+  static std::unique_ptr<IAggregator> make(
+      int scheme,
+      int ordering,
+      RandomEngineHandle rng,
+      std::shared_ptr<TimeKeeper> timeKeeper);
+
 
 };
 
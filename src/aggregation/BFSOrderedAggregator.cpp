@@ -0,0 +1,127 @@
+/**
+* @file BFSOrderedAggregator.cpp
+* @brief Implementation of the BFSOrderedAggregator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-05
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BFSOrderedAggregator.hpp"
+
+#include "solidutils/Array.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+BFSOrderedAggregator::BFSOrderedAggregator(
+    std::unique_ptr<IAggregator> aggregator) :
+  m_aggregator(std::move(aggregator))
+{
+  // do nothing
+}
+
+
+BFSOrderedAggregator::~BFSOrderedAggregator()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+Aggregation BFSOrderedAggregator::aggregate(
+    AggregationParameters const params,
+    Graph const * const graph)
+{
+  Aggregation agg = m_aggregator->aggregate(params, graph);
+
+  return renumber(&agg, graph);
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+Aggregation BFSOrderedAggregator::renumber(
+    Aggregation const * const aggregation,
+    Graph const * const graph)
+{
+  vtx_type const numCoarseVertices = aggregation->getNumCoarseVertices();
+  vtx_type const * const finePrefix = aggregation->finePrefix();
+  vtx_type const * const fineMap = aggregation->fineMap();
+
+  // the queue doubles as the new order of the coarse vertices, and the label
+  // as the new number of each old coarse vertex
+  sl::Array<vtx_type> queue(numCoarseVertices);
+  sl::Array<vtx_type> label(numCoarseVertices, NULL_VTX);
+
+  vtx_type numQueued = 0;
+  vtx_type front = 0;
+  for (vtx_type seed = 0; seed < numCoarseVertices; ++seed) {
+    if (label[seed] != NULL_VTX) {
+      continue;
+    }
+
+    // start a new connected component
+    label[seed] = numQueued;
+    queue[numQueued++] = seed;
+
+    while (front < numQueued) {
+      vtx_type const c = queue[front++];
+
+      // traverse the coarse vertex's edges via its fine vertices
+      for (vtx_type i = finePrefix[c]; i < finePrefix[c+1]; ++i) {
+        Vertex const vertex = Vertex::make(fineMap[i]);
+        for (Edge const edge : graph->edgesOf(vertex)) {
+          vtx_type const u = aggregation->getCoarseVertexNumber( \
+              graph->destinationOf(edge).index);
+          if (label[u] == NULL_VTX) {
+            label[u] = numQueued;
+            queue[numQueued++] = u;
+          }
+        }
+      }
+    }
+  }
+  ASSERT_EQUAL(numQueued, numCoarseVertices);
+
+  vtx_type const numFineVertices = graph->numVertices();
+  sl::Array<vtx_type> coarseMap(numFineVertices);
+  for (vtx_type v = 0; v < numFineVertices; ++v) {
+    coarseMap[v] = label[aggregation->getCoarseVertexNumber(v)];
+  }
+
+  return Aggregation(std::move(coarseMap), numCoarseVertices);
+}
+
+
+}
@@ -0,0 +1,124 @@
+/**
+* @file BFSOrderedAggregator.hpp
+* @brief The BFSOrderedAggregator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-05
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+
+#ifndef POROS_SRC_BFSORDEREDAGGREGATOR_HPP
+#define POROS_SRC_BFSORDEREDAGGREGATOR_HPP
+
+
+#include "aggregation/IAggregator.hpp"
+
+#include <memory>
+
+
+namespace poros
+{
+
+
+/**
+* @brief An aggregator which wraps another aggregator and renumbers the coarse
+* vertices it produces in breadth-first order. As the coarse map is
+* renumbered before contraction, the coarse graph and the projection of
+* partitionings back to the fine graph both follow the new numbering, and
+* neighboring coarse vertices end up close together in memory.
+*/
+class BFSOrderedAggregator : public IAggregator
+{
+  public:
+    /**
+    * @brief Create a new BFS ordered aggregator.
+    *
+    * @param aggregator The aggregator to wrap.
+    */
+    BFSOrderedAggregator(
+        std::unique_ptr<IAggregator> aggregator);
+
+
+    /**
+    * @brief Deleted copy constructor.
+    *
+    * @param rhs The aggregator to copy.
+    */
+    BFSOrderedAggregator(
+        BFSOrderedAggregator const & rhs) = delete;
+
+
+    /**
+    * @brief Deleted assignment operator.
+    *
+    * @param rhs The aggregator to copy from.
+    *
+    * @return This aggregator.
+    */
+    BFSOrderedAggregator& operator=(
+        BFSOrderedAggregator const & rhs) = delete;
+
+
+    /**
+    * @brief Virtual destructor.
+    */
+    virtual ~BFSOrderedAggregator();
+
+
+    /**
+    * @brief Generate an aggregation of the graph, with the coarse vertices
+    * numbered in breadth-first order.
+    *
+    * @param params The aggregation parameters.
+    * @param graph The graph to aggregate.
+    *
+    * @return The aggregation.
+    */
+    Aggregation aggregate(
+        AggregationParameters params,
+        Graph const * graph) override;
+
+
+    /**
+    * @brief Renumber the coarse vertices of an aggregation in breadth-first
+    * order of the coarse graph it induces.
+    *
+    * @param aggregation The aggregation to renumber.
+    * @param graph The fine graph.
+    *
+    * @return The renumbered aggregation.
+    */
+    static Aggregation renumber(
+        Aggregation const * aggregation,
+        Graph const * graph);
+
+
+  private:
+    std::unique_ptr<IAggregator> m_aggregator;
+};
+
+
+}
+
+#endif
@@ -54,5 +54,22 @@ std::unique_ptr<IContractor> ContractorFactory::make(
   return ptr;
 }
 
+std::unique_ptr<IContractor> ContractorFactory::make(
+    bool const exactSize)
+{
+  return std::unique_ptr<IContractor>(new SummationContractor(exactSize));
+}
+
+std::unique_ptr<IContractor> ContractorFactory::make(
+    bool const exactSize,
+    std::shared_ptr<TimeKeeper> timeKeeper)
+{
+  std::unique_ptr<TimedContractor> ptr(new TimedContractor(make(exactSize)));
+
+  ptr->setTimeKeeper(timeKeeper);
+
+  return ptr;
+}
+
 
 }
@@ -58,7 +58,31 @@ class ContractorFactory
   */
   static std::unique_ptr<IContractor> make(
       std::shared_ptr<TimeKeeper> timeKeeper);
-  
+
+  /**
+  * @brief Create a new contractor.
+  *
+  * @param exactSize Whether or not to allocate coarse graphs at their exact
+  * size (at the cost of an extra pass over the fine graph).
+  *
+  * @return The instantiated contractor.
+  */
+  static std::unique_ptr<IContractor> make(
+      bool exactSize);
+
+  /**
+  * @brief Create a new contractor.
+  *
+  * @param exactSize Whether or not to allocate coarse graphs at their exact
+  * size (at the cost of an extra pass over the fine graph).
+  * @param timeKeeper The time keeper to report times to.
+  *
+  * @return The instantiated contractor.
+  */
+  static std::unique_ptr<IContractor> make(
+      bool exactSize,
+      std::shared_ptr<TimeKeeper> timeKeeper);
+
 
 };
 
@@ -0,0 +1,135 @@
+/**
+* @file StreamingMatcher.cpp
+* @brief Implementation of the StreamingMatcher class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "StreamingMatcher.hpp"
+#include "aggregation/MatchedAggregationBuilder.hpp"
+#include "solidutils/Debug.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+template<bool HAS_VERTEX_WEIGHTS>
+void keepAllowedMatches(
+    AggregationParameters const params,
+    Graph const * const graph,
+    vtx_type const * const match,
+    MatchedAggregationBuilder * const matcher)
+{
+  for (Vertex const vertex : graph->vertices()) {
+    vtx_type const v = vertex.index;
+    vtx_type const u = match[v];
+    if (u != NULL_VTX && v < u) {
+      wgt_type const coarseWeight = \
+          graph->weightOf<HAS_VERTEX_WEIGHTS>(vertex) + \
+          graph->weightOf<HAS_VERTEX_WEIGHTS>(Vertex::make(u));
+      if (params.isAllowedVertexWeight(coarseWeight)) {
+        matcher->match(v, u);
+      }
+    }
+  }
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+StreamingMatcher::StreamingMatcher(
+    vtx_type const numVertices) :
+  m_match(numVertices, NULL_VTX)
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void StreamingMatcher::match(
+    vtx_type const begin,
+    vtx_type const end,
+    adj_type const * const edgePrefix,
+    vtx_type const * const edgeList,
+    wgt_type const * const edgeWeight)
+{
+  ASSERT_LESSEQUAL(end, m_match.size());
+
+  for (vtx_type v = begin; v < end; ++v) {
+    if (m_match[v] == NULL_VTX) {
+      // we'll choose our arrived neighbor with the heaviest edge
+      vtx_type max = NULL_VTX;
+      wgt_type maxPriority = 0;
+      for (adj_type j = edgePrefix[v]; j < edgePrefix[v+1]; ++j) {
+        vtx_type const u = edgeList[j];
+        if (u < end && u != v && m_match[u] == NULL_VTX) {
+          wgt_type const priority = edgeWeight ? edgeWeight[j] : 1;
+          if (max == NULL_VTX || maxPriority < priority) {
+            maxPriority = priority;
+            max = u;
+          }
+        }
+      }
+      if (max != NULL_VTX) {
+        m_match[v] = max;
+        m_match[max] = v;
+      }
+    }
+  }
+}
+
+
+Aggregation StreamingMatcher::build(
+    AggregationParameters const params,
+    Graph const * const graph) const
+{
+  ASSERT_EQUAL(graph->numVertices(), m_match.size());
+
+  MatchedAggregationBuilder matcher(graph->numVertices());
+  if (graph->hasUnitVertexWeight()) {
+    keepAllowedMatches<false>(params, graph, m_match.data(), &matcher);
+  } else {
+    keepAllowedMatches<true>(params, graph, m_match.data(), &matcher);
+  }
+
+  return matcher.build();
+}
+
+
+}
@@ -0,0 +1,105 @@
+/**
+* @file StreamingMatcher.hpp
+* @brief The StreamingMatcher class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_STREAMINGMATCHER_HPP
+#define POROS_SRC_STREAMINGMATCHER_HPP
+
+
+#include "Base.hpp"
+#include "aggregation/Aggregation.hpp"
+#include "aggregation/AggregationParameters.hpp"
+#include "graph/Graph.hpp"
+
+#include <vector>
+
+
+namespace poros
+{
+
+/**
+* @brief Builds a heavy edge matching of a graph while its vertices are still
+* arriving, so that the first level of coarsening overlaps with ingestion.
+* Each new vertex is matched to its heaviest unmatched neighbor among the
+* vertices which have arrived. As edges are given in both directions, an edge
+* to a vertex which has not yet arrived is considered when that vertex does.
+*/
+class StreamingMatcher
+{
+  public:
+    /**
+    * @brief Create a new streaming matcher.
+    *
+    * @param numVertices The number of vertices in the graph.
+    */
+    StreamingMatcher(
+        vtx_type numVertices);
+
+
+    /**
+    * @brief Match a newly arrived range of vertices. All vertices before the
+    * range must have already arrived.
+    *
+    * @param begin The first vertex of the range.
+    * @param end One past the last vertex of the range.
+    * @param edgePrefix The edge prefix of the graph (valid up to end+1).
+    * @param edgeList The edge list of the graph.
+    * @param edgeWeight The edge weights of the graph (may be null for unit
+    * weights).
+    */
+    void match(
+        vtx_type begin,
+        vtx_type end,
+        adj_type const * edgePrefix,
+        vtx_type const * edgeList,
+        wgt_type const * edgeWeight);
+
+
+    /**
+    * @brief Build the aggregation of the completed graph. Vertex weights are
+    * not known until the graph is complete, so pairs whose combined weight is
+    * not allowed are left unmatched here.
+    *
+    * @param params The aggregation parameters.
+    * @param graph The completed graph.
+    *
+    * @return The aggregation.
+    */
+    Aggregation build(
+        AggregationParameters params,
+        Graph const * graph) const;
+
+
+  private:
+    std::vector<vtx_type> m_match;
+};
+
+
+}
+
+
+#endif
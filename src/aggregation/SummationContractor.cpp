@@ -32,8 +32,7 @@
 #include "graph/OneStepGraphBuilder.hpp"
 
 
-#include "solidutils/Timer.hpp"
-#include <iostream>
+#include <vector>
 
 
 namespace poros
@@ -48,12 +47,56 @@ namespace poros
 namespace
 {
 
+/**
+* @brief Count the number of edges the coarse graph will have.
+*
+* @param graph The graph to be contracted.
+* @param aggregation The aggregation of the graph.
+*
+* @return The number of coarse edges.
+*/
+adj_type countCoarseEdges(
+    Graph const * const graph,
+    Aggregation const * const aggregation)
+{
+  // mark each coarse neighbor with the coarse vertex which last saw it
+  std::vector<vtx_type> marker(aggregation->getNumCoarseVertices(), NULL_VTX);
+
+  adj_type numEdges = 0;
+  vtx_type coarseVertex = 0;
+  for (VertexGroup const group : aggregation->coarseVertices()) {
+    // don't count self loops
+    marker[coarseVertex] = coarseVertex;
+
+    for (Vertex const vertex : group) {
+      for (Edge const edge : graph->edgesOf(vertex)) {
+        vtx_type const coarseNeighbor = aggregation->getCoarseVertexNumber(
+            graph->destinationOf(edge).index);
+        if (marker[coarseNeighbor] != coarseVertex) {
+          marker[coarseNeighbor] = coarseVertex;
+          ++numEdges;
+        }
+      }
+    }
+
+    ++coarseVertex;
+  }
+
+  return numEdges;
+}
+
+
 template<bool HAS_VERTEX_WEIGHTS, bool HAS_EDGE_WEIGHTS>
 GraphHandle contractGraph(
     Graph const * const graph,
-    Aggregation const * const aggregation)
+    Aggregation const * const aggregation,
+    bool const exactSize)
 {
-  OneStepGraphBuilder builder(aggregation->getNumCoarseVertices(), graph->numEdges());
+  adj_type const maxNumEdges = exactSize ? \
+      countCoarseEdges(graph, aggregation) : graph->numEdges();
+
+  OneStepGraphBuilder builder(aggregation->getNumCoarseVertices(), \
+      maxNumEdges);
 
   // go over each fine vertex
   vtx_type coarseVertex = 0;
@@ -90,7 +133,16 @@ GraphHandle contractGraph(
 ******************************************************************************/
 
 
-SummationContractor::SummationContractor()
+SummationContractor::SummationContractor() :
+  SummationContractor(false)
+{
+  // do nothing
+}
+
+
+SummationContractor::SummationContractor(
+    bool const exactSize) :
+  m_exactSize(exactSize)
 {
   // do nothing
 }
@@ -109,15 +161,15 @@ GraphHandle SummationContractor::contract(
 {
   if (graph->hasUnitVertexWeight()) {
     if (graph->hasUnitEdgeWeight()) {
-      return contractGraph<false, false>(graph, aggregation);
+      return contractGraph<false, false>(graph, aggregation, m_exactSize);
     } else {
-      return contractGraph<false, true>(graph, aggregation);
+      return contractGraph<false, true>(graph, aggregation, m_exactSize);
     }
   } else {
     if (graph->hasUnitEdgeWeight()) {
-      return contractGraph<true, false>(graph, aggregation);
+      return contractGraph<true, false>(graph, aggregation, m_exactSize);
     } else {
-      return contractGraph<true, true>(graph, aggregation);
+      return contractGraph<true, true>(graph, aggregation, m_exactSize);
     }
   }
 }
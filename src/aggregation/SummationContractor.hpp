@@ -47,6 +47,19 @@ class SummationContractor : public IContractor
     SummationContractor();
 
 
+    /**
+    * @brief Create a new summation contractor.
+    *
+    * @param exactSize Whether or not to count the edges of the coarse graph
+    * before contracting it, so that its edge arrays are allocated at their
+    * exact size rather than at the size of the fine graph's. This requires an
+    * extra pass over the fine graph, but bounds the peak memory usage of
+    * contraction.
+    */
+    SummationContractor(
+        bool exactSize);
+
+
     /**
     * @brief Contract a graph, dropping contracted edge weights, summing
     * combined vertex weights, and summing combined edge weights. 
@@ -60,6 +73,9 @@ class SummationContractor : public IContractor
     GraphHandle contract(
         Graph const * graph,
         Aggregation const * aggregation) override;
+
+  private:
+    bool m_exactSize;
 };
 
 
@@ -27,6 +27,8 @@
 
 #include "TimedAggregator.hpp"
 
+#include "util/TimeScope.hpp"
+
 #include "solidutils/Timer.hpp"
 
 namespace poros
@@ -53,6 +55,10 @@ Aggregation TimedAggregator::aggregate(
     AggregationParameters const params,
     Graph const * const graph)
 {
+  TimeScope scope(TimeKeeper::AGGREGATION);
+
+  PerfCounters::sample_type const counts = startCounting();
+
   sl::Timer tmr;
   tmr.start();
 
@@ -61,6 +67,7 @@ Aggregation TimedAggregator::aggregate(
   tmr.stop();
 
   reportTime(TimeKeeper::AGGREGATION, tmr.poll());
+  reportCounts(TimeKeeper::AGGREGATION, counts);
 
   return agg;
 }
@@ -27,6 +27,8 @@
 
 
 #include "TimedContractor.hpp"
+#include "util/TimeScope.hpp"
+
 #include  "solidutils/Timer.hpp"
 
 namespace poros
@@ -53,6 +55,10 @@ GraphHandle TimedContractor::contract(
     Graph const * const graph,
     Aggregation const * const aggregation)
 {
+  TimeScope scope(TimeKeeper::CONTRACTION);
+
+  PerfCounters::sample_type const counts = startCounting();
+
   sl::Timer tmr;
   tmr.start();
 
@@ -60,6 +66,7 @@ GraphHandle TimedContractor::contract(
 
   tmr.stop();
   reportTime(TimeKeeper::CONTRACTION, tmr.poll());
+  reportCounts(TimeKeeper::CONTRACTION, counts);
 
   return coarse;
 }
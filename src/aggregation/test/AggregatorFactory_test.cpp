@@ -26,6 +26,7 @@
 */
 
 #include "AggregatorFactory.hpp"
+#include "BFSOrderedAggregator.hpp"
 #include "RandomMatchingAggregator.hpp"
 #include "SHEMRMAggregator.hpp"
 #include "TimedAggregator.hpp"
@@ -77,4 +78,17 @@ UNITTEST(AggregatorFactory, TimedAggregatorTest)
   testTrue(rmPtr != nullptr);
 }
 
+UNITTEST(AggregatorFactory, BFSOrderedAggregatorTest)
+{
+  RandomEngineHandle rand = RandomEngineFactory::make(0);
+
+  std::unique_ptr<IAggregator> ptr = AggregatorFactory::make( \
+      SORTED_HEAVY_EDGE_MATCHING, BFS_ORDERING, rand);
+
+  BFSOrderedAggregator const * const rmPtr = \
+      dynamic_cast<BFSOrderedAggregator*>(ptr.get());
+
+  testTrue(rmPtr != nullptr);
+}
+
 }
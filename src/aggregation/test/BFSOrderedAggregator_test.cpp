@@ -0,0 +1,111 @@
+/**
+* @file BFSOrderedAggregator_test.cpp
+* @brief Unit tests for the BFSOrderedAggregator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-05
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "aggregation/BFSOrderedAggregator.hpp"
+#include "aggregation/RandomMatchingAggregator.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "util/RandomEngineFactory.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <vector>
+
+
+namespace poros
+{
+
+
+UNITTEST(BFSOrderedAggregator, SameGrouping)
+{
+  GridGraphGenerator gen(20,30,10);
+  Graph graph = gen.generate();
+
+  RandomMatchingAggregator aggregator(RandomEngineFactory::make(0));
+
+  AggregationParameters params;
+  Aggregation natural = aggregator.aggregate(params, &graph);
+  Aggregation ordered = BFSOrderedAggregator::renumber(&natural, &graph);
+
+  testEqual(ordered.getNumCoarseVertices(), natural.getNumCoarseVertices());
+
+  // the new numbering must be a permutation of the old one
+  std::vector<vtx_type> newNumber(natural.getNumCoarseVertices(), NULL_VTX);
+  for (Vertex const vertex : graph.vertices()) {
+    vtx_type const oldCoarse = natural.getCoarseVertexNumber(vertex.index);
+    vtx_type const newCoarse = ordered.getCoarseVertexNumber(vertex.index);
+    if (newNumber[oldCoarse] == NULL_VTX) {
+      newNumber[oldCoarse] = newCoarse;
+    }
+    testEqual(newNumber[oldCoarse], newCoarse);
+  }
+
+  std::vector<bool> used(natural.getNumCoarseVertices(), false);
+  for (vtx_type const c : newNumber) {
+    testFalse(used[c]);
+    used[c] = true;
+  }
+}
+
+
+UNITTEST(BFSOrderedAggregator, BreadthFirstOrder)
+{
+  GridGraphGenerator gen(20,30,10);
+  Graph graph = gen.generate();
+
+  std::unique_ptr<IAggregator> inner(new RandomMatchingAggregator( \
+      RandomEngineFactory::make(0)));
+  BFSOrderedAggregator aggregator(std::move(inner));
+
+  AggregationParameters params;
+  Aggregation agg = aggregator.aggregate(params, &graph);
+
+  // in a connected graph, every coarse vertex other than the first must have
+  // been discovered from a coarse vertex numbered before it
+  std::vector<vtx_type> minNeighbor(agg.getNumCoarseVertices(), NULL_VTX);
+  for (Vertex const vertex : graph.vertices()) {
+    vtx_type const c = agg.getCoarseVertexNumber(vertex.index);
+    for (Edge const edge : graph.edgesOf(vertex)) {
+      vtx_type const u = agg.getCoarseVertexNumber( \
+          graph.destinationOf(edge).index);
+      if (u != c && (minNeighbor[c] == NULL_VTX || u < minNeighbor[c])) {
+        minNeighbor[c] = u;
+      }
+    }
+  }
+
+  for (vtx_type c = 1; c < agg.getNumCoarseVertices(); ++c) {
+    testLess(minNeighbor[c], c);
+  }
+
+  // and discovery order must not decrease
+  for (vtx_type c = 2; c < agg.getNumCoarseVertices(); ++c) {
+    testLessOrEqual(minNeighbor[c-1], minNeighbor[c]);
+  }
+}
+
+
+}
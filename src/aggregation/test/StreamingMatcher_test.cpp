@@ -0,0 +1,113 @@
+/**
+* @file StreamingMatcher_test.cpp
+* @brief Unit tests for the StreamingMatcher class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "aggregation/StreamingMatcher.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace poros
+{
+
+
+UNITTEST(StreamingMatcher, MatchInBlocks)
+{
+  GridGraphGenerator gen(20, 30, 10);
+  gen.setRandomEdgeWeight(1, 3);
+  Graph graph = gen.generate();
+
+  StreamingMatcher matcher(graph.numVertices());
+
+  vtx_type const blockSize = 517;
+  for (vtx_type start = 0; start < graph.numVertices(); start += blockSize) {
+    vtx_type const end = std::min(start + blockSize, graph.numVertices());
+    matcher.match(start, end, graph.getEdgePrefix(), graph.getEdgeList(), \
+        graph.getEdgeWeight());
+  }
+
+  AggregationParameters params;
+  Aggregation agg = matcher.build(params, &graph);
+
+  testGreaterOrEqual(agg.getNumCoarseVertices(), graph.numVertices() / 2);
+  testLess(agg.getNumCoarseVertices(), \
+      static_cast<vtx_type>(graph.numVertices() * 0.6));
+
+  // verify each coarse vertex is one vertex or a pair of neighbors
+  std::vector<vtx_type> first(agg.getNumCoarseVertices(), NULL_VTX);
+  std::vector<int> matchCount(agg.getNumCoarseVertices(), 0);
+  for (Vertex const vertex : graph.vertices()) {
+    vtx_type const coarse = agg.getCoarseVertexNumber(vertex.index);
+    ++matchCount[coarse];
+    if (first[coarse] == NULL_VTX) {
+      first[coarse] = vertex.index;
+    } else {
+      bool connected = false;
+      for (Edge const edge : graph.edgesOf(vertex)) {
+        connected = connected || \
+            graph.destinationOf(edge).index == first[coarse];
+      }
+      testTrue(connected);
+    }
+  }
+
+  for (int const count : matchCount) {
+    testGreaterOrEqual(count, 1);
+    testLessOrEqual(count, 2);
+  }
+}
+
+
+UNITTEST(StreamingMatcher, MaxVertexWeight)
+{
+  GridGraphGenerator gen(10, 10, 1);
+  gen.setRandomVertexWeight(1, 3);
+  Graph graph = gen.generate();
+
+  StreamingMatcher matcher(graph.numVertices());
+  matcher.match(0, graph.numVertices(), graph.getEdgePrefix(), \
+      graph.getEdgeList(), nullptr);
+
+  AggregationParameters params;
+  params.setMaxVertexWeight(4);
+  Aggregation agg = matcher.build(params, &graph);
+
+  std::vector<wgt_type> coarseWeight(agg.getNumCoarseVertices(), 0);
+  for (Vertex const vertex : graph.vertices()) {
+    coarseWeight[agg.getCoarseVertexNumber(vertex.index)] += \
+        graph.getVertexWeight()[vertex.index];
+  }
+  for (wgt_type const weight : coarseWeight) {
+    testLessOrEqual(weight, 4u);
+  }
+}
+
+
+}
@@ -154,7 +154,44 @@ UNITTEST(SummationContractor, ContractCubeSquare)
   }
 }
 
+UNITTEST(SummationContractor, ContractExactSize)
+{
+  GridGraphGenerator gen(10,12,14);
+  gen.setRandomEdgeWeight(1,5);
+  gen.setRandomVertexWeight(1,3);
+  Graph graph = gen.generate();
+
+  sl::Array<vtx_type> cmap(graph.numVertices());
+  for (vtx_type i = 0; i < graph.numVertices(); ++i) {
+    cmap[i] = static_cast<vtx_type>(i/3);
+  }
+  vtx_type const numCoarse = (graph.numVertices()+2)/3;
+
+  Aggregation agg(std::move(cmap), numCoarse);
+
+  SummationContractor contractor;
+  SummationContractor exactContractor(true);
+
+  GraphHandle out = contractor.contract(&graph, &agg);
+  GraphHandle exact = exactContractor.contract(&graph, &agg);
+
+  // both modes must produce the same graph
+  testEqual(exact->numVertices(), out->numVertices());
+  testEqual(exact->numEdges(), out->numEdges());
+  testEqual(exact->getTotalVertexWeight(), out->getTotalVertexWeight());
+  testEqual(exact->getTotalEdgeWeight(), out->getTotalEdgeWeight());
 
+  for (Vertex const vertex : out->vertices()) {
+    testEqual(exact->degreeOf(vertex), out->degreeOf(vertex));
+    testEqual(exact->weightOf<true>(vertex), out->weightOf<true>(vertex));
+  }
+
+  for (Edge const edge : out->edges()) {
+    testEqual(exact->destinationOf(edge).index, \
+        out->destinationOf(edge).index);
+    testEqual(exact->weightOf<true>(edge), out->weightOf<true>(edge));
+  }
+}
 
 
 }
@@ -0,0 +1,222 @@
+/**
+* @file BenchCommon.cpp
+* @brief Implementation of the helper functions shared by the benchmark drivers.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-28
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BenchCommon.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "graph/RMatGraphGenerator.hpp"
+#include "graph/GeometricGraphGenerator.hpp"
+#include "graph/BarabasiAlbertGraphGenerator.hpp"
+#include "graph/StochasticBlockGraphGenerator.hpp"
+#include "graph/MeshGraphGenerator.hpp"
+#include "graph/MetisGraphReader.hpp"
+#include "graph/MatrixMarketReader.hpp"
+#include "graph/BinaryGraphFile.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+unsigned int const GENERATOR_SEED = 0;
+
+}
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+bool endsWith(
+    std::string const & str,
+    std::string const & suffix)
+{
+  return str.size() >= suffix.size() && \
+      str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+
+/**
+* @brief Generate a graph from a specification of the form
+* '<generator>:<arg>,<arg>,...' (or 'grid:<x>x<y>x<z>').
+*
+* @param spec The specification.
+*
+* @return The graph, or nullptr if the specification names no generator.
+*/
+std::unique_ptr<Graph> generateGraph(
+    std::string const & spec)
+{
+  size_t const split = spec.find(':');
+  if (split == std::string::npos) {
+    return nullptr;
+  }
+  std::string const kind = spec.substr(0, split);
+  std::string args = spec.substr(split+1);
+  if (kind == "grid") {
+    std::replace(args.begin(), args.end(), 'x', ',');
+  }
+  std::vector<std::string> const values = splitList(args);
+
+  auto checkArgs = [&](size_t const num, char const * const usage) {
+    if (values.size() != num) {
+      throw std::runtime_error("Expected '" + kind + ":" + usage + \
+          "', not '" + spec + "'.");
+    }
+  };
+
+  std::unique_ptr<RandomGraphGenerator> gen;
+  if (kind == "grid") {
+    checkArgs(3, "<x>x<y>x<z>");
+    GridGraphGenerator grid(parseValue<vtx_type>(values[0]), \
+        parseValue<vtx_type>(values[1]), parseValue<vtx_type>(values[2]));
+    return std::unique_ptr<Graph>(new Graph(grid.generate()));
+  } else if (kind == "rmat") {
+    checkArgs(2, "<scale>,<edge factor>");
+    gen.reset(new RMatGraphGenerator(parseValue<unsigned int>(values[0]), \
+        parseValue<unsigned int>(values[1]), GENERATOR_SEED));
+  } else if (kind == "geometric") {
+    checkArgs(3, "<vertices>,<degree>,<dimensions>");
+    gen.reset(new GeometricGraphGenerator(parseValue<vtx_type>(values[0]), \
+        parseValue<double>(values[1]), parseValue<unsigned int>(values[2]), \
+        GENERATOR_SEED));
+  } else if (kind == "ba") {
+    checkArgs(2, "<vertices>,<edges per vertex>");
+    gen.reset(new BarabasiAlbertGraphGenerator( \
+        parseValue<vtx_type>(values[0]), parseValue<vtx_type>(values[1]), \
+        GENERATOR_SEED));
+  } else if (kind == "sbm") {
+    checkArgs(4, "<vertices>,<blocks>,<intra probability>," \
+        "<inter probability>");
+    gen.reset(new StochasticBlockGraphGenerator( \
+        parseValue<vtx_type>(values[0]), parseValue<vtx_type>(values[1]), \
+        parseValue<double>(values[2]), parseValue<double>(values[3]), \
+        GENERATOR_SEED));
+  } else if (kind == "mesh") {
+    checkArgs(4, "<x>,<y>,<holes>,<hole radius>");
+    gen.reset(new MeshGraphGenerator(parseValue<vtx_type>(values[0]), \
+        parseValue<vtx_type>(values[1]), parseValue<vtx_type>(values[2]), \
+        parseValue<double>(values[3]), GENERATOR_SEED));
+  } else {
+    return nullptr;
+  }
+
+  return std::unique_ptr<Graph>(new Graph(gen->generate()));
+}
+
+}
+
+
+/******************************************************************************
+* PUBLIC FUNCTIONS ************************************************************
+******************************************************************************/
+
+std::vector<std::string> splitList(
+    std::string const & str)
+{
+  std::vector<std::string> items;
+  size_t start = 0;
+  while (true) {
+    size_t const end = str.find(',', start);
+    items.emplace_back(str.substr(start, end - start));
+    if (end == std::string::npos) {
+      break;
+    }
+    start = end + 1;
+  }
+  return items;
+}
+
+
+Graph loadGraph(
+    std::string const & name)
+{
+  std::unique_ptr<Graph> generated = generateGraph(name);
+  if (generated) {
+    return std::move(*generated);
+  } else if (endsWith(name, ".mtx")) {
+    MatrixMarketReader reader(name);
+    return reader.read();
+  } else if (endsWith(name, ".bin")) {
+    return BinaryGraphFile::load(name);
+  } else {
+    MetisGraphReader reader(name);
+    return reader.read();
+  }
+}
+
+
+std::string quote(
+    std::string const & str)
+{
+  std::string out("\"");
+  for (char const c : str) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out += ' ';
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
+  return out;
+}
+
+
+void showGraphHelp()
+{
+  std::cerr << "Each graph is either a file (METIS '.graph', Matrix Market " \
+      "'.mtx', or" << std::endl;
+  std::cerr << "binary '.bin'), or one of the following to generate it:" << \
+      std::endl;
+  std::cerr << "  grid:<x>x<y>x<z>" << std::endl;
+  std::cerr << "  rmat:<scale>,<edge factor>" << std::endl;
+  std::cerr << "  geometric:<vertices>,<degree>,<dimensions>" << std::endl;
+  std::cerr << "  ba:<vertices>,<edges per vertex>" << std::endl;
+  std::cerr << "  sbm:<vertices>,<blocks>,<intra probability>," \
+      "<inter probability>" << std::endl;
+  std::cerr << "  mesh:<x>,<y>,<holes>,<hole radius>" << std::endl;
+}
+
+
+}
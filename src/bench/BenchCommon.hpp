@@ -0,0 +1,133 @@
+/**
+* @file BenchCommon.hpp
+* @brief Helper functions shared by the benchmark drivers.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-28
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_BENCH_BENCHCOMMON_HPP
+#define POROS_SRC_BENCH_BENCHCOMMON_HPP
+
+
+#include "graph/Graph.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace poros
+{
+
+
+/**
+* @brief Parse a single value from a command line argument.
+*
+* @tparam T The type of value.
+* @param str The string to parse.
+*
+* @return The value.
+*
+* @throw std::runtime_error If the string is not a valid value.
+*/
+template<typename T>
+T parseValue(
+    std::string const & str)
+{
+  std::istringstream stream(str);
+  T value;
+  stream >> value;
+  if (stream.fail() || !stream.eof()) {
+    throw std::runtime_error("Invalid value '" + str + "'.");
+  }
+  return value;
+}
+
+/**
+* @brief Split a comma separated list.
+*
+* @param str The list.
+*
+* @return The items of the list.
+*/
+std::vector<std::string> splitList(
+    std::string const & str);
+
+
+/**
+* @brief Parse a comma separated list of values.
+*
+* @tparam T The type of value.
+* @param str The list.
+*
+* @return The values.
+*
+* @throw std::runtime_error If an item is not a valid value.
+*/
+template<typename T>
+std::vector<T> parseList(
+    std::string const & str)
+{
+  std::vector<T> values;
+  for (std::string const & item : splitList(str)) {
+    values.emplace_back(parseValue<T>(item));
+  }
+  return values;
+}
+
+/**
+* @brief Load a graph from a file (METIS '.graph', Matrix Market '.mtx', or
+* binary '.bin'), or generate it from a specification of the form
+* '<generator>:<arg>,<arg>,...'.
+*
+* @param name The file name or specification.
+*
+* @return The graph.
+*/
+Graph loadGraph(
+    std::string const & name);
+
+
+/**
+* @brief Quote a string for inclusion in JSON output.
+*
+* @param str The string.
+*
+* @return The quoted string.
+*/
+std::string quote(
+    std::string const & str);
+
+
+/**
+* @brief Print the accepted graph names and specifications to stderr.
+*/
+void showGraphHelp();
+
+
+}
+
+
+#endif
@@ -0,0 +1,608 @@
+/**
+* @file PorosBench.cpp
+* @brief Benchmark driver sweeping partitioning parameters and writing the time of each phase as JSON.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BenchCommon.hpp"
+#include "PorosPipeline.hpp"
+#include "graph/Graph.hpp"
+#include "partition/Partitioning.hpp"
+#include "partition/TargetPartitioning.hpp"
+#include "partition/PartitioningAnalyzer.hpp"
+#include "multilevel/LevelStatistics.hpp"
+#include "util/AllocationCounter.hpp"
+#include "util/MemoryKeeper.hpp"
+#include "util/PerfCounters.hpp"
+#include "util/TimeKeeper.hpp"
+
+#include "solidutils/Timer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+using namespace poros;
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+struct aggregation_struct
+{
+  char const * name;
+  int scheme;
+};
+
+struct preset_struct
+{
+  char const * name;
+  int preset;
+};
+
+struct settings_struct
+{
+  std::vector<std::string> graphs;
+  std::vector<pid_type> numPartitions;
+  std::vector<int> numThreads;
+  std::vector<int> presets;
+  std::vector<int> aggregationSchemes;
+  std::vector<unsigned int> seeds;
+  double imbalanceTolerance;
+  double timeLimitSeconds;
+  bool timingTree;
+  bool hardwareCounters;
+  std::string tracePrefix;
+  std::string outputFile;
+
+  settings_struct() :
+    graphs(),
+    numPartitions{2, 8, 64},
+    numThreads{1},
+    presets{DEFAULT_PRESET},
+    aggregationSchemes(),
+    seeds{0},
+    imbalanceTolerance(0.03),
+    timeLimitSeconds(0.0),
+    timingTree(false),
+    hardwareCounters(false),
+    tracePrefix(),
+    outputFile()
+  {
+    // do nothing
+  }
+};
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+aggregation_struct const AGGREGATION_SCHEMES[] = {
+  {"random", RANDOM_MATCHING},
+  {"shem", SORTED_HEAVY_EDGE_MATCHING}
+};
+
+preset_struct const PRESETS[] = {
+  {"fast", FAST_PRESET},
+  {"default", DEFAULT_PRESET},
+  {"quality", QUALITY_PRESET}
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+void showHelp(
+    char const * const name)
+{
+  std::cerr << "USAGE: " << name << " [options] <graph> [<graph> ...]" << \
+      std::endl;
+  std::cerr << std::endl;
+  showGraphHelp();
+  std::cerr << std::endl;
+  std::cerr << "OPTIONS:" << std::endl;
+  std::cerr << "  --k=<k>[,<k>...]" << std::endl;
+  std::cerr << "    The numbers of partitions (default 2,8,64)." << std::endl;
+  std::cerr << "  --threads=<t>[,<t>...]" << std::endl;
+  std::cerr << "    The numbers of threads (default 1)." << std::endl;
+  std::cerr << "  --presets={fast|default|quality}[,...]" << std::endl;
+  std::cerr << "    The presets of options (default default)." << std::endl;
+  std::cerr << "  --aggregation={random|shem}[,...]" << std::endl;
+  std::cerr << "    The aggregation schemes (default that of each preset)." \
+      << std::endl;
+  std::cerr << "  --seeds=<s>[,<s>...]" << std::endl;
+  std::cerr << "    The random seeds (default 0)." << std::endl;
+  std::cerr << "  --imbalance=<tolerance>" << std::endl;
+  std::cerr << "    The imbalance tolerance (default 0.03)." << std::endl;
+  std::cerr << "  --time-limit=<seconds>" << std::endl;
+  std::cerr << "    Make partitionings until the time is up and keep the " \
+      "best, instead" << std::endl;
+  std::cerr << "    of making one (default no limit)." << std::endl;
+  std::cerr << "  --tree" << std::endl;
+  std::cerr << "    Record the time of each recursion node, level, and " \
+      "phase as a tree." << std::endl;
+  std::cerr << "  --counters" << std::endl;
+  std::cerr << "    Count hardware events (cycles, instructions, cache, TLB " \
+      "and branch" << std::endl;
+  std::cerr << "    misses) in each phase." << std::endl;
+  std::cerr << "  --trace=<prefix>" << std::endl;
+  std::cerr << "    Write a Chrome trace of each run to " \
+      "'<prefix>.<run>.json'." << std::endl;
+  std::cerr << "  --output=<file>" << std::endl;
+  std::cerr << "    Write the JSON results to a file instead of stdout." << \
+      std::endl;
+}
+
+
+int parseAggregation(
+    std::string const & name)
+{
+  for (aggregation_struct const & agg : AGGREGATION_SCHEMES) {
+    if (name == agg.name) {
+      return agg.scheme;
+    }
+  }
+  throw std::runtime_error("Unknown aggregation scheme '" + name + "'.");
+}
+
+
+char const * aggregationName(
+    int const scheme)
+{
+  for (aggregation_struct const & agg : AGGREGATION_SCHEMES) {
+    if (scheme == agg.scheme) {
+      return agg.name;
+    }
+  }
+  return "unknown";
+}
+
+
+int parsePreset(
+    std::string const & name)
+{
+  for (preset_struct const & preset : PRESETS) {
+    if (name == preset.name) {
+      return preset.preset;
+    }
+  }
+  throw std::runtime_error("Unknown preset '" + name + "'.");
+}
+
+
+char const * presetName(
+    int const preset)
+{
+  for (preset_struct const & p : PRESETS) {
+    if (preset == p.preset) {
+      return p.name;
+    }
+  }
+  return "unknown";
+}
+
+
+settings_struct parseArguments(
+    int const argc,
+    char ** const argv)
+{
+  settings_struct settings;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string const arg(argv[i]);
+    size_t const split = arg.find('=');
+    std::string const key = arg.substr(0, split);
+    std::string const value = split == std::string::npos ? "" : \
+        arg.substr(split+1);
+
+    if (key == "--k") {
+      settings.numPartitions = parseList<pid_type>(value);
+    } else if (key == "--threads") {
+      settings.numThreads = parseList<int>(value);
+    } else if (key == "--presets") {
+      settings.presets.clear();
+      for (std::string const & name : splitList(value)) {
+        settings.presets.emplace_back(parsePreset(name));
+      }
+    } else if (key == "--aggregation") {
+      settings.aggregationSchemes.clear();
+      for (std::string const & name : splitList(value)) {
+        settings.aggregationSchemes.emplace_back(parseAggregation(name));
+      }
+    } else if (key == "--seeds") {
+      settings.seeds = parseList<unsigned int>(value);
+    } else if (key == "--imbalance") {
+      settings.imbalanceTolerance = parseValue<double>(value);
+    } else if (key == "--time-limit") {
+      settings.timeLimitSeconds = parseValue<double>(value);
+    } else if (key == "--tree") {
+      settings.timingTree = true;
+    } else if (key == "--counters") {
+      settings.hardwareCounters = true;
+    } else if (key == "--trace") {
+      settings.tracePrefix = value;
+    } else if (key == "--output") {
+      settings.outputFile = value;
+    } else if (arg.compare(0, 2, "--") == 0) {
+      throw std::runtime_error("Unknown option '" + arg + "'.");
+    } else {
+      settings.graphs.emplace_back(arg);
+    }
+  }
+
+  for (int const threads : settings.numThreads) {
+    if (threads < 1) {
+      throw std::runtime_error("The number of threads must be positive.");
+    }
+    #ifndef _OPENMP
+    if (threads > 1) {
+      throw std::runtime_error("Built without OpenMP, so only one thread " \
+          "can be used.");
+    }
+    #endif
+  }
+
+  return settings;
+}
+
+
+void setNumThreads(
+    int const numThreads)
+{
+  #ifdef _OPENMP
+  omp_set_num_threads(numThreads);
+  #endif
+}
+
+
+/**
+* @brief Write a node of the timing tree and its children as a JSON object.
+*
+* @param nodes The nodes of the tree.
+* @param children The children of each node.
+* @param node The node to write.
+* @param indent The number of spaces to indent by.
+* @param out The stream to write to.
+*/
+void writeTreeNode(
+    std::vector<TimeKeeper::node_struct> const & nodes,
+    std::vector<std::vector<size_t>> const & children,
+    size_t const node,
+    size_t const indent,
+    std::ostream & out)
+{
+  std::string const pad(indent, ' ');
+  out << "{\"name\": " << quote(nodes[node].name) << ", \"seconds\": " << \
+      nodes[node].seconds << ", \"calls\": " << nodes[node].calls << \
+      ", \"children\": [";
+  for (size_t i = 0; i < children[node].size(); ++i) {
+    out << (i == 0 ? "" : ",") << std::endl << pad << "  ";
+    writeTreeNode(nodes, children, children[node][i], indent+2, out);
+  }
+  if (!children[node].empty()) {
+    out << std::endl << pad;
+  }
+  out << "]}";
+}
+
+
+/**
+* @brief Write a record of refinement as a JSON object.
+*
+* @param stats The record.
+* @param out The stream to write to.
+*/
+void writeRefinement(
+    RefinementStatistics const & stats,
+    std::ostream & out)
+{
+  out << "{\"passes\": " << stats.numPasses() << ", \"moves\": " << \
+      stats.numMoves() << ", \"kept\": " << stats.numKeptMoves() << \
+      ", \"max_rollback\": " << stats.maxRollback() << \
+      ", \"limited_passes\": " << stats.numLimitedPasses() << \
+      ", \"border_vertices\": " << stats.borderVertices() << \
+      ", \"max_border\": " << stats.maxBorderSize() << ", \"gains\": {";
+  for (size_t i = 0; i < RefinementStatistics::NUM_GAIN_BUCKETS; ++i) {
+    out << (i == 0 ? "" : ", ") << \
+        quote(RefinementStatistics::gainBucketName(i)) << ": " << \
+        stats.numGains(i);
+  }
+  out << "}, \"stops\": {";
+  for (int i = 0; i < RefinementStatistics::NUM_STOP_REASONS; ++i) {
+    out << (i == 0 ? "" : ", ") << \
+        quote(RefinementStatistics::stopReasonName(i)) << ": " << \
+        stats.numStops(i);
+  }
+  out << "}}";
+}
+
+
+/**
+* @brief Partition a graph with one combination of parameters, and write the
+* results as a JSON object.
+*
+* @param name The name of the graph.
+* @param graph The graph.
+* @param preset The preset the options are based on.
+* @param options The options to partition with.
+* @param numPartitions The number of partitions.
+* @param numThreads The number of threads.
+* @param out The stream to write to.
+*/
+void runOne(
+    std::string const & name,
+    Graph const * const graph,
+    int const preset,
+    poros_options_struct const & options,
+    pid_type const numPartitions,
+    int const numThreads,
+    std::ostream & out)
+{
+  setNumThreads(numThreads);
+
+  PorosPipeline pipeline(options);
+  Partitioning part = pipeline.execute(graph, numPartitions, nullptr);
+  if (options.traceFile != nullptr) {
+    pipeline.writeTrace(options.traceFile);
+  }
+
+  TargetPartitioning target(numPartitions, graph->getTotalVertexWeight(), \
+      options.imbalanceTolerance);
+  PartitioningAnalyzer analyzer(&part, &target);
+
+  out << "    {" << std::endl;
+  out << "      \"graph\": " << quote(name) << "," << std::endl;
+  out << "      \"k\": " << numPartitions << "," << std::endl;
+  out << "      \"threads\": " << numThreads << "," << std::endl;
+  out << "      \"preset\": " << quote(presetName(preset)) << "," << \
+      std::endl;
+  out << "      \"aggregation\": " << \
+      quote(aggregationName(options.aggregationScheme)) << "," << std::endl;
+  out << "      \"seed\": " << options.randomSeed << "," << std::endl;
+  if (options.traceFile != nullptr) {
+    out << "      \"trace\": " << quote(options.traceFile) << "," << \
+        std::endl;
+  }
+  out << "      \"trials\": " << pipeline.numTrials() << "," << std::endl;
+  out << "      \"cut\": " << part.getCutEdgeWeight() << "," << std::endl;
+  out << "      \"imbalance\": " << analyzer.calcMaxImbalance() << "," << \
+      std::endl;
+  out << "      \"low_memory\": " << \
+      (pipeline.lowMemory() ? "true" : "false") << "," << std::endl;
+
+  out << "      \"times\": {";
+  bool first = true;
+  for (std::pair<std::string, double> const & pair : \
+      pipeline.timeKeeper()->times()) {
+    out << (first ? "" : ",") << std::endl;
+    out << "        " << quote(pair.first) << ": " << pair.second;
+    first = false;
+  }
+  out << std::endl << "      }," << std::endl;
+
+  out << "      \"peak_bytes\": {";
+  first = true;
+  for (MemoryKeeper::usage_struct const & usage : \
+      pipeline.memoryKeeper()->usage()) {
+    out << (first ? "" : ",") << std::endl;
+    out << "        " << quote(usage.name) << ": " << usage.peak;
+    first = false;
+  }
+  out << std::endl << "      }," << std::endl;
+
+  out << "      \"levels\": [";
+  first = true;
+  for (LevelStatistics::level_struct const & level : \
+      pipeline.statistics()->levels()) {
+    out << (first ? "" : ",") << std::endl;
+    out << "        {\"bisections\": " << level.numBisections << \
+        ", \"vertices\": " << level.numVertices << ", \"edges\": " << \
+        level.numEdges << ", \"exposed_weight\": " << \
+        level.exposedEdgeWeight << ", \"initial_cut\": " << \
+        level.initialCut << ", \"refined_cut\": " << level.refinedCut << \
+        ", \"refinement\": ";
+    writeRefinement(level.refinement, out);
+    out << "}";
+    first = false;
+  }
+  out << std::endl << "      ]";
+
+  if (options.hardwareCounters) {
+    // counters which could not be opened are left out
+    out << "," << std::endl << "      \"counters\": {";
+    first = true;
+    for (std::pair<std::string, PerfCounters::sample_type> const & pair : \
+        pipeline.timeKeeper()->counts()) {
+      out << (first ? "" : ",") << std::endl;
+      out << "        " << quote(pair.first) << ": {";
+      bool firstCounter = true;
+      for (uint32_t i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+        if (PerfCounters::local().isAvailable(i)) {
+          out << (firstCounter ? "" : ", ") << \
+              quote(PerfCounters::name(i)) << ": " << pair.second[i];
+          firstCounter = false;
+        }
+      }
+      out << "}";
+      first = false;
+    }
+    out << std::endl << "      }";
+  }
+
+  if (AllocationCounter::isEnabled()) {
+    out << "," << std::endl << "      \"allocations\": {";
+    first = true;
+    for (std::pair<std::string, AllocationCounter::sample_struct> const & \
+        pair : pipeline.timeKeeper()->allocations()) {
+      out << (first ? "" : ",") << std::endl;
+      out << "        " << quote(pair.first) << ": {\"count\": " << \
+          pair.second.count << ", \"bytes\": " << pair.second.bytes << "}";
+      first = false;
+    }
+    out << std::endl << "      }";
+  }
+
+  if (options.timingTree) {
+    std::vector<TimeKeeper::node_struct> const nodes = \
+        pipeline.timeKeeper()->tree();
+    std::vector<std::vector<size_t>> children(nodes.size());
+    for (size_t node = TimeKeeper::ROOT_NODE+1; node < nodes.size(); ++node) {
+      children[nodes[node].parent].emplace_back(node);
+    }
+    out << "," << std::endl << "      \"tree\": ";
+    writeTreeNode(nodes, children, TimeKeeper::ROOT_NODE, 6, out);
+  }
+
+  out << std::endl << "    }";
+}
+
+
+void runAll(
+    settings_struct const & settings,
+    std::ostream & out)
+{
+  out << std::setprecision(9);
+  out << "{" << std::endl;
+  out << "  \"runs\": [";
+
+  std::ostringstream graphs;
+  graphs << std::setprecision(9);
+
+  bool first = true;
+  size_t run = 0;
+  for (size_t g = 0; g < settings.graphs.size(); ++g) {
+    std::string const & name = settings.graphs[g];
+
+    sl::Timer loadTimer;
+    loadTimer.start();
+    Graph const graph = loadGraph(name);
+    loadTimer.stop();
+
+    graphs << (g == 0 ? "" : ",") << std::endl;
+    graphs << "    {\"graph\": " << quote(name) << ", \"vertices\": " << \
+        graph.numVertices() << ", \"edges\": " << graph.numEdges() << \
+        ", \"load_seconds\": " << loadTimer.poll() << "}";
+
+    for (int const preset : settings.presets) {
+      // without any given, use the aggregation scheme of the preset
+      std::vector<int> const schemes = settings.aggregationSchemes.empty() ? \
+          std::vector<int>{POROS_presetOptions(preset).aggregationScheme} : \
+          settings.aggregationSchemes;
+      for (int const scheme : schemes) {
+        for (pid_type const k : settings.numPartitions) {
+          for (int const threads : settings.numThreads) {
+            for (unsigned int const seed : settings.seeds) {
+              poros_options_struct options = POROS_presetOptions(preset);
+              options.aggregationScheme = scheme;
+              options.randomSeed = seed;
+              options.imbalanceTolerance = settings.imbalanceTolerance;
+              options.timeLimitSeconds = settings.timeLimitSeconds;
+              options.timingTree = settings.timingTree;
+              options.hardwareCounters = settings.hardwareCounters;
+
+              std::string const traceFile = settings.tracePrefix + "." + \
+                  std::to_string(run) + ".json";
+              if (!settings.tracePrefix.empty()) {
+                options.traceFile = traceFile.c_str();
+              }
+
+              out << (first ? "" : ",") << std::endl;
+              runOne(name, &graph, preset, options, k, threads, out);
+              first = false;
+              ++run;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  out << std::endl << "  ]," << std::endl;
+  out << "  \"graphs\": [" << graphs.str() << std::endl << "  ]" << \
+      std::endl;
+  out << "}" << std::endl;
+}
+
+}
+
+
+/******************************************************************************
+* MAIN ************************************************************************
+******************************************************************************/
+
+int main(
+    int argc,
+    char ** argv)
+{
+  settings_struct settings;
+  try {
+    settings = parseArguments(argc, argv);
+  } catch (std::runtime_error const & e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    showHelp(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (settings.graphs.empty()) {
+    showHelp(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  try {
+    if (settings.outputFile.empty()) {
+      runAll(settings, std::cout);
+    } else {
+      std::ofstream file(settings.outputFile);
+      if (!file.good()) {
+        throw std::runtime_error("Failed to open '" + settings.outputFile + \
+            "' for writing.");
+      }
+      runAll(settings, file);
+    }
+  } catch (std::runtime_error const & e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
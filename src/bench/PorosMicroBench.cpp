@@ -0,0 +1,657 @@
+/**
+* @file PorosMicroBench.cpp
+* @brief Microbenchmarks of the kernels on the hot paths of partitioning.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-28
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BenchCommon.hpp"
+#include "graph/Graph.hpp"
+#include "graph/OneStepGraphBuilder.hpp"
+#include "graph/DegreeSortedVertexSet.hpp"
+#include "graph/RandomOrderVertexSet.hpp"
+#include "partition/Partitioning.hpp"
+#include "partition/TwoWayConnectivity.hpp"
+#include "util/PerfCounters.hpp"
+#include "util/RandomEngineFactory.hpp"
+#include "util/VertexQueue.hpp"
+
+#include "solidutils/Timer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+using namespace poros;
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief The inputs of the kernels derived from a graph, generated before
+* anything is measured.
+*/
+struct input_struct
+{
+  Graph const * graph;
+  // the side of a bisection placing the first half of the vertices on side 0
+  std::vector<pid_type> side;
+  // the gain of moving each vertex to the other side of the bisection
+  std::vector<wgt_diff_type> gains;
+  // the vertices in a random order
+  std::vector<Vertex> order;
+};
+
+
+/**
+* @brief The time and hardware events of the repetitions of a kernel.
+*/
+class KernelSampler
+{
+  public:
+    /**
+    * @brief Create a new sampler without any repetitions.
+    */
+    KernelSampler() :
+      m_numOps(0),
+      m_numReps(0),
+      m_bestSeconds(std::numeric_limits<double>::max()),
+      m_totalSeconds(0),
+      m_counts()
+    {
+      // do nothing
+    }
+
+
+    /**
+    * @brief Measure one repetition of a kernel. Each repetition must perform
+    * the same number of operations.
+    *
+    * @tparam F The type of kernel.
+    * @param numOps The number of operations the kernel performs.
+    * @param kernel The kernel.
+    */
+    template<typename F>
+    void measure(
+        size_t const numOps,
+        F kernel)
+    {
+      PerfCounters const & counters = PerfCounters::local();
+
+      PerfCounters::sample_type const start = counters.read();
+      sl::Timer timer;
+      timer.start();
+      kernel();
+      timer.stop();
+      PerfCounters::sample_type const end = counters.read();
+
+      m_numOps = numOps;
+      ++m_numReps;
+      m_bestSeconds = std::min(m_bestSeconds, timer.poll());
+      m_totalSeconds += timer.poll();
+      for (size_t i = 0; i < m_counts.size(); ++i) {
+        m_counts[i] += end[i] - start[i];
+      }
+    }
+
+
+    /**
+    * @brief Get the number of operations in each repetition.
+    *
+    * @return The number of operations.
+    */
+    size_t numOps() const noexcept
+    {
+      return m_numOps;
+    }
+
+
+    /**
+    * @brief Get the time per operation of the fastest repetition.
+    *
+    * @return The time in nanoseconds.
+    */
+    double bestNanoseconds() const noexcept
+    {
+      return m_numOps > 0 ? m_bestSeconds * 1e9 / m_numOps : 0;
+    }
+
+
+    /**
+    * @brief Get the mean time per operation over all repetitions.
+    *
+    * @return The time in nanoseconds.
+    */
+    double meanNanoseconds() const noexcept
+    {
+      return m_numOps > 0 ? \
+          m_totalSeconds * 1e9 / (static_cast<double>(m_numOps) * m_numReps) \
+          : 0;
+    }
+
+
+    /**
+    * @brief Get the mean count of an event per operation over all
+    * repetitions.
+    *
+    * @param counter The event counter.
+    *
+    * @return The count.
+    */
+    double countPerOp(
+        size_t const counter) const noexcept
+    {
+      return m_numOps > 0 ? static_cast<double>(m_counts[counter]) / \
+          (static_cast<double>(m_numOps) * m_numReps) : 0;
+    }
+
+
+  private:
+    size_t m_numOps;
+    size_t m_numReps;
+    double m_bestSeconds;
+    double m_totalSeconds;
+    PerfCounters::sample_type m_counts;
+};
+
+
+struct kernel_struct
+{
+  char const * name;
+  void (*run)(input_struct const & input, KernelSampler * sampler);
+};
+
+
+struct settings_struct
+{
+  std::vector<std::string> graphs;
+  std::vector<kernel_struct> kernels;
+  unsigned int numReps;
+  unsigned int seed;
+  std::string outputFile;
+
+  settings_struct() :
+    graphs(),
+    kernels(),
+    numReps(5),
+    seed(0),
+    outputFile()
+  {
+    // do nothing
+  }
+};
+
+
+/******************************************************************************
+* KERNELS *********************************************************************
+******************************************************************************/
+
+void vertexQueueAdd(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  VertexQueue queue(input.graph->numVertices());
+
+  sampler->measure(input.order.size(), [&]() {
+    for (Vertex const v : input.order) {
+      queue.add(input.gains[v.index], v);
+    }
+  });
+}
+
+
+void vertexQueueUpdate(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  VertexQueue queue(input.graph->numVertices());
+  for (Vertex const v : input.order) {
+    queue.add(input.gains[v.index], v);
+  }
+
+  // the gain of a vertex is negated by moving it, as in refinement
+  sampler->measure(input.order.size(), [&]() {
+    for (Vertex const v : input.order) {
+      queue.update(-input.gains[v.index], v);
+    }
+  });
+}
+
+
+void vertexQueuePop(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  VertexQueue queue(input.graph->numVertices());
+  for (Vertex const v : input.order) {
+    queue.add(input.gains[v.index], v);
+  }
+
+  volatile vtx_type sink = 0;
+  sampler->measure(input.order.size(), [&]() {
+    while (queue.size() > 0) {
+      sink = queue.pop().index;
+    }
+  });
+}
+
+
+template<bool HAS_EDGE_WEIGHTS>
+void buildGraph(
+    Graph const * const graph,
+    OneStepGraphBuilder * const builder)
+{
+  for (Vertex const vertex : graph->vertices()) {
+    for (Edge const edge : graph->edgesOf(vertex)) {
+      builder->addEdge(graph->destinationOf(edge).index, \
+          graph->weightOf<HAS_EDGE_WEIGHTS>(edge));
+    }
+    builder->finishVertex(graph->hasUnitVertexWeight() ? \
+        graph->weightOf<false>(vertex) : graph->weightOf<true>(vertex));
+  }
+}
+
+
+void graphBuilder(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  Graph const * const graph = input.graph;
+  OneStepGraphBuilder builder(graph->numVertices(), graph->numEdges());
+
+  // each operation is an added edge, including the bookkeeping of finishing
+  // its vertex
+  sampler->measure(graph->numEdges(), [&]() {
+    if (graph->hasUnitEdgeWeight()) {
+      buildGraph<false>(graph, &builder);
+    } else {
+      buildGraph<true>(graph, &builder);
+    }
+  });
+
+  builder.finish();
+}
+
+
+template<bool HAS_EDGE_WEIGHTS>
+void moveAll(
+    input_struct const & input,
+    std::vector<pid_type> * const side,
+    TwoWayConnectivity * const connectivity)
+{
+  Graph const * const graph = input.graph;
+  for (Vertex const vertex : input.order) {
+    pid_type const to = (*side)[vertex.index] ^ 1;
+    connectivity->move(vertex);
+    (*side)[vertex.index] = to;
+
+    for (Edge const edge : graph->edgesOf(vertex)) {
+      Vertex const u = graph->destinationOf(edge);
+      connectivity->updateNeighbor(u.index, \
+          graph->weightOf<HAS_EDGE_WEIGHTS>(edge), \
+          TwoWayConnectivity::getDirection(to, (*side)[u.index]));
+    }
+  }
+}
+
+
+void connectivityUpdate(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  Graph const * const graph = input.graph;
+
+  sl::Array<pid_type> labels(input.side.size());
+  std::copy(input.side.begin(), input.side.end(), labels.data());
+  Partitioning part(2, graph, std::move(labels));
+  TwoWayConnectivity connectivity = \
+      TwoWayConnectivity::fromPartitioning(graph, &part);
+  std::vector<pid_type> side(input.side);
+
+  // each operation is the update of a neighbor of a moved vertex
+  sampler->measure(graph->numEdges(), [&]() {
+    if (graph->hasUnitEdgeWeight()) {
+      moveAll<false>(input, &side, &connectivity);
+    } else {
+      moveAll<true>(input, &side, &connectivity);
+    }
+  });
+}
+
+
+void partitioningMove(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  sl::Array<pid_type> labels(input.side.size());
+  std::copy(input.side.begin(), input.side.end(), labels.data());
+  Partitioning part(2, input.graph, std::move(labels));
+
+  sampler->measure(input.order.size(), [&]() {
+    for (Vertex const v : input.order) {
+      part.move(v, input.side[v.index] ^ 1);
+    }
+  });
+}
+
+
+void degreeSort(
+    input_struct const & input,
+    KernelSampler * const sampler)
+{
+  Graph const * const graph = input.graph;
+  RandomEngineHandle engine = RandomEngineFactory::make(0);
+
+  volatile vtx_type sink = 0;
+  sampler->measure(graph->numVertices(), [&]() {
+    PermutedVertexSet const set = DegreeSortedVertexSet::ascendingRandom( \
+        graph->vertices(), graph, engine.get());
+    sink = set.size();
+  });
+}
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+kernel_struct const KERNELS[] = {
+  {"vertex_queue_add", vertexQueueAdd},
+  {"vertex_queue_update", vertexQueueUpdate},
+  {"vertex_queue_pop", vertexQueuePop},
+  {"graph_builder", graphBuilder},
+  {"connectivity_update", connectivityUpdate},
+  {"partitioning_move", partitioningMove},
+  {"degree_sort", degreeSort}
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+void showHelp(
+    char const * const name)
+{
+  std::cerr << "USAGE: " << name << " [options] <graph> [<graph> ...]" << \
+      std::endl;
+  std::cerr << std::endl;
+  showGraphHelp();
+  std::cerr << std::endl;
+  std::cerr << "OPTIONS:" << std::endl;
+  std::cerr << "  --kernels=<kernel>[,<kernel>...]" << std::endl;
+  std::cerr << "    The kernels to measure (default all):" << std::endl;
+  for (kernel_struct const & kernel : KERNELS) {
+    std::cerr << "      " << kernel.name << std::endl;
+  }
+  std::cerr << "  --reps=<n>" << std::endl;
+  std::cerr << "    The number of repetitions of each kernel (default 5)." << \
+      std::endl;
+  std::cerr << "  --seed=<s>" << std::endl;
+  std::cerr << "    The random seed for the order of the vertices " \
+      "(default 0)." << std::endl;
+  std::cerr << "  --output=<file>" << std::endl;
+  std::cerr << "    Write the JSON results to a file instead of stdout." << \
+      std::endl;
+}
+
+
+kernel_struct parseKernel(
+    std::string const & name)
+{
+  for (kernel_struct const & kernel : KERNELS) {
+    if (name == kernel.name) {
+      return kernel;
+    }
+  }
+  throw std::runtime_error("Unknown kernel '" + name + "'.");
+}
+
+
+settings_struct parseArguments(
+    int const argc,
+    char ** const argv)
+{
+  settings_struct settings;
+  settings.kernels.assign(std::begin(KERNELS), std::end(KERNELS));
+
+  for (int i = 1; i < argc; ++i) {
+    std::string const arg(argv[i]);
+    size_t const split = arg.find('=');
+    std::string const key = arg.substr(0, split);
+    std::string const value = split == std::string::npos ? "" : \
+        arg.substr(split+1);
+
+    if (key == "--kernels") {
+      settings.kernels.clear();
+      for (std::string const & name : splitList(value)) {
+        settings.kernels.emplace_back(parseKernel(name));
+      }
+    } else if (key == "--reps") {
+      settings.numReps = parseValue<unsigned int>(value);
+    } else if (key == "--seed") {
+      settings.seed = parseValue<unsigned int>(value);
+    } else if (key == "--output") {
+      settings.outputFile = value;
+    } else if (arg.compare(0, 2, "--") == 0) {
+      throw std::runtime_error("Unknown option '" + arg + "'.");
+    } else {
+      settings.graphs.emplace_back(arg);
+    }
+  }
+
+  if (settings.numReps < 1) {
+    throw std::runtime_error("The number of repetitions must be positive.");
+  }
+
+  return settings;
+}
+
+
+/**
+* @brief Generate the inputs of the kernels for a graph.
+*
+* @param graph The graph.
+* @param seed The random seed for the order of the vertices.
+*
+* @return The inputs.
+*/
+input_struct makeInput(
+    Graph const * const graph,
+    unsigned int const seed)
+{
+  vtx_type const numVertices = graph->numVertices();
+
+  input_struct input{graph, {}, {}, {}};
+
+  input.side.resize(numVertices);
+  for (Vertex const v : graph->vertices()) {
+    input.side[v.index] = v.index < numVertices / 2 ? 0 : 1;
+  }
+
+  input.gains.resize(numVertices);
+  for (Vertex const v : graph->vertices()) {
+    wgt_diff_type gain = 0;
+    for (Edge const edge : graph->edgesOf(v)) {
+      wgt_diff_type const weight = graph->hasUnitEdgeWeight() ? \
+          graph->weightOf<false>(edge) : graph->weightOf<true>(edge);
+      if (input.side[graph->destinationOf(edge).index] == \
+          input.side[v.index]) {
+        gain -= weight;
+      } else {
+        gain += weight;
+      }
+    }
+    input.gains[v.index] = gain;
+  }
+
+  RandomEngineHandle engine = RandomEngineFactory::make(seed);
+  PermutedVertexSet const order = RandomOrderVertexSet::generate( \
+      graph->vertices(), engine.get());
+  input.order.reserve(numVertices);
+  for (Vertex const v : order) {
+    input.order.emplace_back(v);
+  }
+
+  return input;
+}
+
+
+/**
+* @brief Measure a kernel on a graph, and write the results as a JSON object.
+*
+* @param name The name of the graph.
+* @param input The inputs of the kernel.
+* @param kernel The kernel.
+* @param numReps The number of repetitions.
+* @param out The stream to write to.
+*/
+void runOne(
+    std::string const & name,
+    input_struct const & input,
+    kernel_struct const & kernel,
+    unsigned int const numReps,
+    std::ostream & out)
+{
+  KernelSampler sampler;
+  for (unsigned int rep = 0; rep < numReps; ++rep) {
+    kernel.run(input, &sampler);
+  }
+
+  out << "    {" << std::endl;
+  out << "      \"graph\": " << quote(name) << "," << std::endl;
+  out << "      \"kernel\": " << quote(kernel.name) << "," << std::endl;
+  out << "      \"ops\": " << sampler.numOps() << "," << std::endl;
+  out << "      \"reps\": " << numReps << "," << std::endl;
+  out << "      \"ns_per_op\": " << sampler.bestNanoseconds() << "," << \
+      std::endl;
+  out << "      \"mean_ns_per_op\": " << sampler.meanNanoseconds() << "," << \
+      std::endl;
+
+  // counters which could not be opened are left out
+  out << "      \"counters_per_op\": {";
+  bool first = true;
+  for (uint32_t i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+    if (PerfCounters::local().isAvailable(i)) {
+      out << (first ? "" : ", ") << quote(PerfCounters::name(i)) << ": " << \
+          sampler.countPerOp(i);
+      first = false;
+    }
+  }
+  out << "}" << std::endl;
+  out << "    }";
+}
+
+
+void runAll(
+    settings_struct const & settings,
+    std::ostream & out)
+{
+  out << std::setprecision(9);
+  out << "{" << std::endl;
+  out << "  \"kernels\": [";
+
+  std::ostringstream graphs;
+  graphs << std::setprecision(9);
+
+  bool first = true;
+  for (size_t g = 0; g < settings.graphs.size(); ++g) {
+    std::string const & name = settings.graphs[g];
+
+    Graph const graph = loadGraph(name);
+    input_struct const input = makeInput(&graph, settings.seed);
+
+    graphs << (g == 0 ? "" : ",") << std::endl;
+    graphs << "    {\"graph\": " << quote(name) << ", \"vertices\": " << \
+        graph.numVertices() << ", \"edges\": " << graph.numEdges() << "}";
+
+    for (kernel_struct const & kernel : settings.kernels) {
+      out << (first ? "" : ",") << std::endl;
+      runOne(name, input, kernel, settings.numReps, out);
+      first = false;
+    }
+  }
+
+  out << std::endl << "  ]," << std::endl;
+  out << "  \"graphs\": [" << graphs.str() << std::endl << "  ]" << \
+      std::endl;
+  out << "}" << std::endl;
+}
+
+}
+
+
+/******************************************************************************
+* MAIN ************************************************************************
+******************************************************************************/
+
+int main(
+    int argc,
+    char ** argv)
+{
+  settings_struct settings;
+  try {
+    settings = parseArguments(argc, argv);
+  } catch (std::runtime_error const & e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    showHelp(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (settings.graphs.empty()) {
+    showHelp(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  try {
+    if (settings.outputFile.empty()) {
+      runAll(settings, std::cout);
+    } else {
+      std::ofstream file(settings.outputFile);
+      if (!file.good()) {
+        throw std::runtime_error("Failed to open '" + settings.outputFile + \
+            "' for writing.");
+      }
+      runAll(settings, file);
+    }
+  } catch (std::runtime_error const & e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+/**
+* @file BarabasiAlbertGraphGenerator.cpp
+* @brief Implementation of the BarabasiAlbertGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BarabasiAlbertGraphGenerator.hpp"
+
+#include <vector>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+BarabasiAlbertGraphGenerator::BarabasiAlbertGraphGenerator(
+    vtx_type const numVertices,
+    vtx_type const edgesPerVertex,
+    unsigned int const seed) :
+  RandomGraphGenerator(seed),
+  m_numVertices(numVertices),
+  m_edgesPerVertex(edgesPerVertex)
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+Graph BarabasiAlbertGraphGenerator::generate()
+{
+  vtx_type const edgesPerVertex = m_edgesPerVertex;
+  size_t const numEdges = static_cast<size_t>(m_numVertices) * \
+      edgesPerVertex;
+
+  std::vector<vtx_type> sources(numEdges);
+  std::vector<vtx_type> dests(numEdges);
+
+  // endpoint 2i of the list is the vertex adding edge i, and endpoint 2i+1 is
+  // a copy of a random earlier endpoint
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (size_t i = 0; i < numEdges; ++i) {
+    uint64_t endpoint = 2*i + 1;
+    while (endpoint % 2 == 1) {
+      endpoint = random(0, endpoint) % endpoint;
+    }
+    sources[i] = static_cast<vtx_type>(i / edgesPerVertex);
+    dests[i] = static_cast<vtx_type>((endpoint / 2) / edgesPerVertex);
+  }
+
+  return build(m_numVertices, std::move(sources), std::move(dests));
+}
+
+
+}
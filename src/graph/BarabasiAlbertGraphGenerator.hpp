@@ -0,0 +1,87 @@
+/**
+* @file BarabasiAlbertGraphGenerator.hpp
+* @brief The BarabasiAlbertGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_BARABASIALBERTGRAPHGENERATOR_HPP
+#define POROS_SRC_BARABASIALBERTGRAPHGENERATOR_HPP
+
+
+#include "graph/RandomGraphGenerator.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Generates Barabasi-Albert preferential attachment graphs, where each
+* new vertex connects to existing vertices with probability proportional to
+* their degree, giving a power law degree distribution.
+*
+* Rather than attaching vertices one at a time, the list of edge endpoints is
+* generated directly: the target of each edge copies a uniformly random
+* earlier endpoint of the list, which picks a vertex in proportion to its
+* degree. Each endpoint is resolved independently by following the chain of
+* copies, so all edges are generated in parallel.
+*/
+class BarabasiAlbertGraphGenerator : public RandomGraphGenerator
+{
+  public:
+    /**
+    * @brief Create a new Barabasi-Albert generator.
+    *
+    * @param numVertices The number of vertices.
+    * @param edgesPerVertex The number of edges each new vertex attaches with
+    * (before duplicates and self loops are removed).
+    * @param seed The random seed.
+    */
+    BarabasiAlbertGraphGenerator(
+        vtx_type numVertices,
+        vtx_type edgesPerVertex,
+        unsigned int seed);
+
+
+    /**
+    * @brief Generate the graph.
+    *
+    * @return The generated graph.
+    *
+    * @throws std::runtime_error If the graph has too many edges for adj_type.
+    */
+    Graph generate() override;
+
+
+  private:
+    vtx_type m_numVertices;
+    vtx_type m_edgesPerVertex;
+
+};
+
+
+}
+
+
+#endif
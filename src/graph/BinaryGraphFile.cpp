@@ -0,0 +1,325 @@
+/**
+* @file BinaryGraphFile.cpp
+* @brief Implementation of the BinaryGraphFile class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-22
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BinaryGraphFile.hpp"
+
+#include "util/MemoryMappedFile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+struct header_struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t vtxBytes;
+  uint32_t adjBytes;
+  uint32_t wgtBytes;
+  uint32_t flags;
+  uint64_t numVertices;
+  uint64_t numEdges;
+  uint64_t totalVertexWeight;
+  uint64_t totalEdgeWeight;
+};
+
+static_assert(sizeof(header_struct) == 64, "Unexpected header padding");
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+char const MAGIC[8] = {'P', 'O', 'R', 'O', 'S', 'C', 'S', 'R'};
+
+uint32_t const BYTE_ORDER_MARK = 0x01020304;
+
+uint32_t const HAS_VERTEX_WEIGHTS = 1;
+uint32_t const HAS_EDGE_WEIGHTS = 2;
+
+size_t const SECTION_ALIGNMENT = 64;
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+size_t alignSection(
+    size_t const offset) noexcept
+{
+  return ((offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT) * \
+      SECTION_ALIGNMENT;
+}
+
+
+/**
+* @brief The offsets of each section in the file.
+*/
+struct layout_struct
+{
+  size_t edgePrefix;
+  size_t edgeList;
+  size_t vertexWeight;
+  size_t edgeWeight;
+  size_t end;
+};
+
+
+layout_struct computeLayout(
+    header_struct const & header) noexcept
+{
+  layout_struct layout;
+
+  layout.edgePrefix = alignSection(sizeof(header_struct));
+  layout.edgeList = alignSection(layout.edgePrefix + \
+      (header.numVertices+1)*sizeof(adj_type));
+  layout.vertexWeight = alignSection(layout.edgeList + \
+      header.numEdges*sizeof(vtx_type));
+
+  size_t offset = layout.vertexWeight;
+  if (header.flags & HAS_VERTEX_WEIGHTS) {
+    offset = alignSection(offset + header.numVertices*sizeof(wgt_type));
+  }
+  layout.edgeWeight = offset;
+
+  if (header.flags & HAS_EDGE_WEIGHTS) {
+    offset = alignSection(offset + header.numEdges*sizeof(wgt_type));
+  }
+  layout.end = offset;
+
+  return layout;
+}
+
+
+void writeSection(
+    std::ostream * const stream,
+    void const * const data,
+    size_t const bytes,
+    size_t const start,
+    size_t const end)
+{
+  static char const padding[SECTION_ALIGNMENT] = {0};
+
+  stream->write(static_cast<char const *>(data), bytes);
+
+  size_t const position = static_cast<size_t>(stream->tellp()) - start;
+  stream->write(padding, end - position);
+}
+
+
+std::runtime_error formatError(
+    std::string const & filename,
+    std::string const & reason)
+{
+  return std::runtime_error("Cannot load '" + filename + "' as a binary " \
+      "graph: " + reason);
+}
+
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+constexpr uint32_t const BinaryGraphFile::VERSION;
+
+
+void BinaryGraphFile::write(
+    Graph const * const graph,
+    std::string const & filename)
+{
+  std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+  if (!stream) {
+    throw std::runtime_error("Failed to open '" + filename + "' for " \
+        "writing.");
+  }
+
+  write(graph, &stream);
+
+  if (!stream.flush()) {
+    throw std::runtime_error("Failed to write '" + filename + "'.");
+  }
+}
+
+
+void BinaryGraphFile::write(
+    Graph const * const graph,
+    std::ostream * const stream)
+{
+  header_struct header;
+  std::memset(&header, 0, sizeof(header));
+
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.vtxBytes = sizeof(vtx_type);
+  header.adjBytes = sizeof(adj_type);
+  header.wgtBytes = sizeof(wgt_type);
+  header.flags = (graph->hasUnitVertexWeight() ? 0 : HAS_VERTEX_WEIGHTS) | \
+      (graph->hasUnitEdgeWeight() ? 0 : HAS_EDGE_WEIGHTS);
+  header.numVertices = graph->numVertices();
+  header.numEdges = graph->numEdges();
+  header.totalVertexWeight = graph->getTotalVertexWeight();
+  header.totalEdgeWeight = graph->getTotalEdgeWeight();
+
+  layout_struct const layout = computeLayout(header);
+
+  size_t const start = static_cast<size_t>(stream->tellp());
+
+  writeSection(stream, &header, sizeof(header), start, layout.edgePrefix);
+  writeSection(stream, graph->getEdgePrefix(), \
+      (graph->numVertices()+1)*sizeof(adj_type), start, layout.edgeList);
+  writeSection(stream, graph->getEdgeList(), \
+      graph->numEdges()*sizeof(vtx_type), start, layout.vertexWeight);
+  if (header.flags & HAS_VERTEX_WEIGHTS) {
+    writeSection(stream, graph->getVertexWeight(), \
+        graph->numVertices()*sizeof(wgt_type), start, layout.edgeWeight);
+  }
+  if (header.flags & HAS_EDGE_WEIGHTS) {
+    writeSection(stream, graph->getEdgeWeight(), \
+        graph->numEdges()*sizeof(wgt_type), start, layout.end);
+  }
+}
+
+
+Graph BinaryGraphFile::load(
+    std::string const & filename,
+    bool const checked)
+{
+  std::unique_ptr<MemoryMappedFile> file( \
+      new MemoryMappedFile(filename, false));
+
+  Graph graph = view(file->data(), file->size(), filename, nullptr, checked);
+  graph.setAllocatedData(std::move(file));
+
+  return graph;
+}
+
+
+Graph BinaryGraphFile::view(
+    char const * const data,
+    size_t const size,
+    std::string const & name,
+    size_t * const numBytes,
+    bool const checked)
+{
+  if (size < sizeof(header_struct)) {
+    throw formatError(name, "too small for a header");
+  }
+
+  header_struct header;
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw formatError(name, "not a binary graph");
+  } else if (header.version != VERSION) {
+    throw formatError(name, "unsupported version " + \
+        std::to_string(header.version));
+  } else if (header.byteOrder != BYTE_ORDER_MARK) {
+    throw formatError(name, "written with a different byte order");
+  } else if (header.vtxBytes != sizeof(vtx_type) || \
+      header.adjBytes != sizeof(adj_type) || \
+      header.wgtBytes != sizeof(wgt_type)) {
+    throw formatError(name, "written with different type sizes");
+  } else if (header.numVertices >= static_cast<uint64_t>(NULL_VTX) || \
+      header.numEdges >= static_cast<uint64_t>(NULL_ADJ)) {
+    throw formatError(name, "too large for this build");
+  }
+
+  layout_struct const layout = computeLayout(header);
+  if (size < layout.end) {
+    throw formatError(name, "truncated");
+  }
+
+  vtx_type const numVertices = static_cast<vtx_type>(header.numVertices);
+  adj_type const numEdges = static_cast<adj_type>(header.numEdges);
+
+  adj_type const * const edgePrefix = \
+      reinterpret_cast<adj_type const *>(data + layout.edgePrefix);
+  if (edgePrefix[0] != 0 || edgePrefix[numVertices] != numEdges) {
+    throw formatError(name, "corrupt edge prefix");
+  }
+
+  vtx_type const * const edgeList = \
+      reinterpret_cast<vtx_type const *>(data + layout.edgeList);
+  if (checked) {
+    // the graph is a view of the data, so a corrupt prefix or neighbour
+    // would otherwise be read past the end of the arrays
+    for (vtx_type v = 0; v < numVertices; ++v) {
+      if (edgePrefix[v+1] < edgePrefix[v]) {
+        throw formatError(name, "corrupt edge prefix");
+      }
+    }
+    for (adj_type e = 0; e < numEdges; ++e) {
+      if (edgeList[e] >= numVertices) {
+        throw formatError(name, "corrupt edge list");
+      }
+    }
+  }
+
+  bool const hasVertexWeights = (header.flags & HAS_VERTEX_WEIGHTS) != 0;
+  bool const hasEdgeWeights = (header.flags & HAS_EDGE_WEIGHTS) != 0;
+
+  if (numBytes) {
+    *numBytes = layout.end;
+  }
+
+  // use the stored totals, so that unless checked, no pass over the arrays
+  // is needed
+  return Graph( \
+      sl::ConstArray<adj_type>(edgePrefix, numVertices+1), \
+      sl::ConstArray<vtx_type>(edgeList, numEdges), \
+      sl::ConstArray<wgt_type>(hasVertexWeights ? \
+          reinterpret_cast<wgt_type const *>(data + layout.vertexWeight) : \
+          nullptr, hasVertexWeights ? numVertices : 0), \
+      sl::ConstArray<wgt_type>(hasEdgeWeights ? \
+          reinterpret_cast<wgt_type const *>(data + layout.edgeWeight) : \
+          nullptr, hasEdgeWeights ? numEdges : 0), \
+      static_cast<wgt_type>(header.totalVertexWeight), \
+      static_cast<wgt_type>(header.totalEdgeWeight), \
+      !hasVertexWeights, \
+      !hasEdgeWeights);
+}
+
+
+}
@@ -0,0 +1,134 @@
+/**
+* @file BinaryGraphFile.hpp
+* @brief The BinaryGraphFile class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-22
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_BINARYGRAPHFILE_HPP
+#define POROS_SRC_BINARYGRAPHFILE_HPP
+
+
+#include "Base.hpp"
+#include "graph/Graph.hpp"
+
+#include <ostream>
+#include <string>
+
+
+namespace poros
+{
+
+/**
+* @brief Reads and writes graphs in poros's binary CSR format. The file is a
+* 64 byte header holding the format version, type sizes, counts, total
+* weights, and which weights are present, followed by the edge prefix, edge
+* list, vertex weight, and edge weight sections, each aligned to 64 bytes.
+* Unit weights are not stored. Files are in native byte order.
+*/
+class BinaryGraphFile
+{
+  public:
+    /**
+    * @brief The current version of the format.
+    */
+    static constexpr uint32_t const VERSION = 1;
+
+    /**
+    * @brief Write a graph.
+    *
+    * @param graph The graph.
+    * @param filename The name of the file to write.
+    *
+    * @throws std::runtime_error If the file cannot be written.
+    */
+    static void write(
+        Graph const * graph,
+        std::string const & filename);
+
+
+    /**
+    * @brief Write a graph to a stream, so that it can be embedded in other
+    * files. The stream should be at an offset which is a multiple of 64
+    * bytes, and is left at one.
+    *
+    * @param graph The graph.
+    * @param stream The stream to write to.
+    */
+    static void write(
+        Graph const * graph,
+        std::ostream * stream);
+
+
+    /**
+    * @brief Load a graph by memory mapping the file. Its arrays point
+    * directly into the mapping, which is released with the graph, so pages
+    * are only read as they are touched and are shared with any other process
+    * mapping the same file.
+    *
+    * @param filename The name of the file to load.
+    * @param checked Whether to check that the edge prefix and edge list are
+    * valid. This reads both in full, so is only needed for untrusted files.
+    *
+    * @return The graph.
+    *
+    * @throws std::runtime_error If the file cannot be read, was not written
+    * by a compatible build, or (if checked) holds an invalid graph.
+    */
+    static Graph load(
+        std::string const & filename,
+        bool checked = false);
+
+
+    /**
+    * @brief Create a graph whose arrays point into a buffer holding a graph
+    * written by `write()`. The buffer must outlive the graph.
+    *
+    * @param data The start of the graph in the buffer (64 byte aligned).
+    * @param size The number of bytes from the start of the graph to the end
+    * of the buffer.
+    * @param name The name of the buffer, for error messages.
+    * @param numBytes The number of bytes the graph takes up (output, may be
+    * null).
+    * @param checked Whether to check that the edge prefix and edge list are
+    * valid. This reads both in full, so is only needed for untrusted buffers.
+    *
+    * @return The graph.
+    *
+    * @throws std::runtime_error If the buffer does not hold a graph written
+    * by a compatible build, or (if checked) holds an invalid graph.
+    */
+    static Graph view(
+        char const * data,
+        size_t size,
+        std::string const & name,
+        size_t * numBytes,
+        bool checked = false);
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,309 @@
+/**
+* @file EdgeListGraphBuilder.cpp
+* @brief Implementation of the EdgeListGraphBuilder class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-23
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "EdgeListGraphBuilder.hpp"
+
+#include "util/MemoryPolicy.hpp"
+#include "solidutils/VectorMath.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+struct edge_struct
+{
+  vtx_type dest;
+  wgt_type weight;
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+inline adj_type claimSlot(
+    adj_type * const cursor) noexcept
+{
+  adj_type slot;
+  #ifdef _OPENMP
+  #pragma omp atomic capture
+  #endif
+  slot = (*cursor)++;
+  return slot;
+}
+
+
+/**
+* @brief Sort the edges of a vertex by destination and merge duplicates.
+*
+* @param merge How to combine the weights of duplicates.
+* @param edges The edges of the vertex.
+* @param numEdges The number of edges.
+*
+* @return The number of edges left.
+*/
+adj_type mergeEdges(
+    EdgeListGraphBuilder::merge_type const merge,
+    edge_struct * const edges,
+    adj_type const numEdges)
+{
+  if (numEdges == 0) {
+    return 0;
+  }
+
+  std::sort(edges, edges+numEdges, \
+      [](edge_struct const & a, edge_struct const & b) {
+    return a.dest < b.dest;
+  });
+
+  adj_type numMerged = 1;
+  for (adj_type j = 1; j < numEdges; ++j) {
+    if (edges[j].dest == edges[numMerged-1].dest) {
+      wgt_type & weight = edges[numMerged-1].weight;
+      if (merge == EdgeListGraphBuilder::MERGE_SUM) {
+        weight += edges[j].weight;
+      } else {
+        weight = std::max(weight, edges[j].weight);
+      }
+    } else {
+      edges[numMerged++] = edges[j];
+    }
+  }
+
+  return numMerged;
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+EdgeListGraphBuilder::EdgeListGraphBuilder(
+    vtx_type const numVertices) :
+  m_numVertices(numVertices),
+  m_merge(MERGE_SUM),
+  m_vertexWeight(),
+  m_sources(),
+  m_dests(),
+  m_weights()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void EdgeListGraphBuilder::reserve(
+    size_t const numEdges)
+{
+  m_sources.reserve(numEdges);
+  m_dests.reserve(numEdges);
+  m_weights.reserve(numEdges);
+}
+
+
+void EdgeListGraphBuilder::setMergeType(
+    merge_type const merge) noexcept
+{
+  m_merge = merge;
+}
+
+
+void EdgeListGraphBuilder::setVertexWeight(
+    vtx_type const vertex,
+    wgt_type const weight)
+{
+  ASSERT_LESS(vertex, m_numVertices);
+
+  if (m_vertexWeight.size() == 0) {
+    m_vertexWeight = sl::Array<wgt_type>(m_numVertices, 1);
+  }
+  m_vertexWeight[vertex] = weight;
+}
+
+
+void EdgeListGraphBuilder::addEdges(
+    size_t const numEdges,
+    vtx_type const * const sources,
+    vtx_type const * const dests,
+    wgt_type const * const weights)
+{
+  m_sources.insert(m_sources.end(), sources, sources+numEdges);
+  m_dests.insert(m_dests.end(), dests, dests+numEdges);
+  if (weights) {
+    m_weights.insert(m_weights.end(), weights, weights+numEdges);
+  } else {
+    m_weights.resize(m_weights.size()+numEdges, 1);
+  }
+}
+
+
+void EdgeListGraphBuilder::addEdges(
+    std::vector<vtx_type> && sources,
+    std::vector<vtx_type> && dests,
+    std::vector<wgt_type> && weights)
+{
+  ASSERT_EQUAL(sources.size(), dests.size());
+  ASSERT_EQUAL(sources.size(), weights.size());
+
+  if (m_sources.empty()) {
+    m_sources = std::move(sources);
+    m_dests = std::move(dests);
+    m_weights = std::move(weights);
+  } else {
+    addEdges(sources.size(), sources.data(), dests.data(), weights.data());
+  }
+}
+
+
+Graph EdgeListGraphBuilder::finish()
+{
+  vtx_type const numVertices = m_numVertices;
+  size_t const numInput = m_sources.size();
+
+  if (2*numInput >= static_cast<size_t>(NULL_ADJ)) {
+    throw std::runtime_error("Too many edges for adj_type: " + \
+        std::to_string(numInput));
+  }
+
+  // count the edges of each vertex in both directions, skipping those with
+  // an end which is not a vertex, so that they can be reported after
+  sl::Array<adj_type> cursor(numVertices+1, 0);
+  vtx_type maxVertex = 0;
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) reduction(max: maxVertex)
+  #endif
+  for (size_t i = 0; i < numInput; ++i) {
+    vtx_type const u = m_sources[i];
+    vtx_type const v = m_dests[i];
+    maxVertex = std::max(maxVertex, std::max(u, v));
+    if (u != v && u < numVertices && v < numVertices) {
+      #ifdef _OPENMP
+      #pragma omp atomic
+      #endif
+      ++cursor[u];
+      #ifdef _OPENMP
+      #pragma omp atomic
+      #endif
+      ++cursor[v];
+    }
+  }
+  if (numInput > 0 && maxVertex >= numVertices) {
+    throw std::runtime_error("Edge to vertex " + std::to_string(maxVertex) + \
+        " in a graph of " + std::to_string(numVertices) + " vertices.");
+  }
+  sl::VectorMath::prefixSumExclusive(cursor.begin(), cursor.end());
+
+  sl::Array<adj_type> bucketPrefix(numVertices+1);
+  std::copy(cursor.begin(), cursor.end(), bucketPrefix.begin());
+
+  // bucket the edges by vertex
+  sl::Array<edge_struct> buckets(cursor[numVertices]);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (size_t i = 0; i < numInput; ++i) {
+    vtx_type const u = m_sources[i];
+    vtx_type const v = m_dests[i];
+    if (u != v) {
+      wgt_type const w = m_weights[i];
+      buckets[claimSlot(cursor.data()+u)] = edge_struct{v, w};
+      buckets[claimSlot(cursor.data()+v)] = edge_struct{u, w};
+    }
+  }
+
+  // the input is no longer needed
+  m_sources = std::vector<vtx_type>();
+  m_dests = std::vector<vtx_type>();
+  m_weights = std::vector<wgt_type>();
+
+  // sort and merge each bucket, re-using the cursor array for the number of
+  // unique edges of each vertex
+  bool unitEdgeWeight = true;
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 1024) \
+      reduction(&&: unitEdgeWeight)
+  #endif
+  for (vtx_type v = 0; v < numVertices; ++v) {
+    edge_struct * const edges = buckets.data() + bucketPrefix[v];
+    adj_type const numMerged = mergeEdges(m_merge, edges, \
+        bucketPrefix[v+1] - bucketPrefix[v]);
+    for (adj_type j = 0; j < numMerged; ++j) {
+      unitEdgeWeight = unitEdgeWeight && edges[j].weight == 1;
+    }
+    cursor[v] = numMerged;
+  }
+  cursor[numVertices] = 0;
+  sl::VectorMath::prefixSumExclusive(cursor.begin(), cursor.end());
+
+  // copy the merged edges into the graph
+  adj_type const numEdges = cursor[numVertices];
+  sl::Array<vtx_type> edgeList = MemoryPolicy::allocate<vtx_type>(numEdges);
+  sl::Array<wgt_type> edgeWeight;
+  if (!unitEdgeWeight) {
+    edgeWeight = MemoryPolicy::allocate<wgt_type>(numEdges);
+  }
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (vtx_type v = 0; v < numVertices; ++v) {
+    edge_struct const * const edges = buckets.data() + bucketPrefix[v];
+    adj_type const start = cursor[v];
+    adj_type const numMerged = cursor[v+1] - start;
+    for (adj_type j = 0; j < numMerged; ++j) {
+      edgeList[start+j] = edges[j].dest;
+      if (!unitEdgeWeight) {
+        edgeWeight[start+j] = edges[j].weight;
+      }
+    }
+  }
+
+  return Graph(std::move(cursor), std::move(edgeList), \
+      std::move(m_vertexWeight), std::move(edgeWeight));
+}
+
+
+}
@@ -0,0 +1,189 @@
+/**
+* @file EdgeListGraphBuilder.hpp
+* @brief The EdgeListGraphBuilder class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-23
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_EDGELISTGRAPHBUILDER_HPP
+#define POROS_SRC_EDGELISTGRAPHBUILDER_HPP
+
+
+#include "Base.hpp"
+#include "graph/Graph.hpp"
+#include "solidutils/Array.hpp"
+#include "solidutils/Debug.hpp"
+
+#include <vector>
+
+
+namespace poros
+{
+
+/**
+* @brief Builds a graph from a list of edges given in any order, in either or
+* both directions, and possibly more than once. When the graph is built,
+* each edge is added in both directions, duplicate edges are merged (by
+* default by summing their weights), and self loops are dropped. The edges
+* are bucketed by vertex using a counting sort, which runs in parallel when
+* built with OpenMP.
+*/
+class EdgeListGraphBuilder
+{
+  public:
+    /**
+    * @brief How the weights of duplicate edges are combined.
+    */
+    enum merge_type {
+      MERGE_SUM,
+      MERGE_MAX
+    };
+
+
+    /**
+    * @brief Create a new graph builder.
+    *
+    * @param numVertices The number of vertices in the graph.
+    */
+    EdgeListGraphBuilder(
+        vtx_type numVertices);
+
+
+    /**
+    * @brief Reserve space for a number of edges to be added.
+    *
+    * @param numEdges The number of edges.
+    */
+    void reserve(
+        size_t numEdges);
+
+
+    /**
+    * @brief Set how the weights of duplicate edges are combined.
+    *
+    * @param merge The type of merge.
+    */
+    void setMergeType(
+        merge_type merge) noexcept;
+
+
+    /**
+    * @brief Set the weight of a vertex. Vertices whose weight is not set have
+    * a weight of 1.
+    *
+    * @param vertex The vertex.
+    * @param weight The weight.
+    */
+    void setVertexWeight(
+        vtx_type vertex,
+        wgt_type weight);
+
+
+    /**
+    * @brief Add an edge.
+    *
+    * @param source The vertex at one end of the edge.
+    * @param dest The vertex at the other end of the edge.
+    * @param weight The weight of the edge.
+    */
+    void addEdge(
+        vtx_type const source,
+        vtx_type const dest,
+        wgt_type const weight = 1)
+    {
+      ASSERT_LESS(source, m_numVertices);
+      ASSERT_LESS(dest, m_numVertices);
+
+      m_sources.emplace_back(source);
+      m_dests.emplace_back(dest);
+      m_weights.emplace_back(weight);
+    }
+
+
+    /**
+    * @brief Add several edges.
+    *
+    * @param numEdges The number of edges.
+    * @param sources The vertex at one end of each edge.
+    * @param dests The vertex at the other end of each edge.
+    * @param weights The weight of each edge (may be null for weights of 1).
+    */
+    void addEdges(
+        size_t numEdges,
+        vtx_type const * sources,
+        vtx_type const * dests,
+        wgt_type const * weights);
+
+
+    /**
+    * @brief Add several edges, taking ownership of the arrays if no edges
+    * have been added yet.
+    *
+    * @param sources The vertex at one end of each edge.
+    * @param dests The vertex at the other end of each edge.
+    * @param weights The weight of each edge.
+    */
+    void addEdges(
+        std::vector<vtx_type> && sources,
+        std::vector<vtx_type> && dests,
+        std::vector<wgt_type> && weights);
+
+
+    /**
+    * @brief Get the number of edges added so far.
+    *
+    * @return The number of edges.
+    */
+    size_t numAddedEdges() const noexcept
+    {
+      return m_sources.size();
+    }
+
+
+    /**
+    * @brief Build the graph. This resets the builder to having no edges and
+    * unit vertex weights.
+    *
+    * @return The built graph.
+    *
+    * @throws std::runtime_error If the graph has too many edges for adj_type,
+    * or an edge has an end which is not a vertex of the graph.
+    */
+    Graph finish();
+
+
+  private:
+    vtx_type m_numVertices;
+    merge_type m_merge;
+    sl::Array<wgt_type> m_vertexWeight;
+    std::vector<vtx_type> m_sources;
+    std::vector<vtx_type> m_dests;
+    std::vector<wgt_type> m_weights;
+};
+
+
+}
+
+
+#endif
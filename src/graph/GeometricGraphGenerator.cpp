@@ -0,0 +1,258 @@
+/**
+* @file GeometricGraphGenerator.cpp
+* @brief Implementation of the GeometricGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "GeometricGraphGenerator.hpp"
+#include "solidutils/Array.hpp"
+#include "solidutils/Debug.hpp"
+#include "solidutils/VectorMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+unsigned int const MAX_DIMENSIONS = 3;
+
+double const PI = 3.14159265358979323846;
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+/**
+* @brief Get the volume of a ball of radius one.
+*
+* @param numDimensions The number of dimensions.
+*
+* @return The volume.
+*/
+double unitBallVolume(
+    unsigned int const numDimensions)
+{
+  return numDimensions == 2 ? PI : 4.0*PI/3.0;
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+GeometricGraphGenerator::GeometricGraphGenerator(
+    vtx_type const numVertices,
+    double const averageDegree,
+    unsigned int const numDimensions,
+    unsigned int const seed) :
+  RandomGraphGenerator(seed),
+  m_numVertices(numVertices),
+  m_numDimensions(numDimensions),
+  m_radius(std::pow(averageDegree / \
+      (std::max(numVertices, static_cast<vtx_type>(1)) * \
+      unitBallVolume(numDimensions)), 1.0 / numDimensions))
+{
+  ASSERT_TRUE(numDimensions == 2 || numDimensions == 3);
+
+  if (!(averageDegree > 0) || !std::isfinite(averageDegree)) {
+    throw std::runtime_error("The average degree of a geometric graph " \
+        "must be positive: " + std::to_string(averageDegree));
+  }
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+double GeometricGraphGenerator::radius() const noexcept
+{
+  return m_radius;
+}
+
+
+Graph GeometricGraphGenerator::generate()
+{
+  vtx_type const numVertices = m_numVertices;
+  unsigned int const numDims = m_numDimensions;
+
+  // bucket the points into cells the size of the radius, so that neighbors
+  // are in adjacent cells, but with no more cells than points
+  double const maxCellsPerDim = std::ceil(std::pow( \
+      std::max(numVertices, static_cast<vtx_type>(1)), 1.0 / numDims));
+  size_t const cellsPerDim = static_cast<size_t>( \
+      std::max(1.0, std::min(1.0 / m_radius, maxCellsPerDim)));
+  size_t const numCells = numDims == 2 ? cellsPerDim*cellsPerDim : \
+      cellsPerDim*cellsPerDim*cellsPerDim;
+
+  auto coordinate = [=](vtx_type const point, unsigned int const dim) {
+    return randomReal(dim, point);
+  };
+  auto cellCoordinate = [=](double const x) {
+    return std::min(static_cast<size_t>(x * cellsPerDim), cellsPerDim-1);
+  };
+  auto cellOf = [=](vtx_type const point) {
+    size_t cell = 0;
+    for (unsigned int d = numDims; d > 0; --d) {
+      cell = cell*cellsPerDim + cellCoordinate(coordinate(point, d-1));
+    }
+    return cell;
+  };
+
+  sl::Array<size_t> cellPrefix(numCells+1, 0);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (vtx_type p = 0; p < numVertices; ++p) {
+    size_t const cell = cellOf(p);
+    #ifdef _OPENMP
+    #pragma omp atomic
+    #endif
+    ++cellPrefix[cell];
+  }
+  sl::VectorMath::prefixSumExclusive(cellPrefix.begin(), cellPrefix.end());
+
+  // points are numbered by cell, and by their index within each cell so the
+  // order does not depend on the number of threads
+  sl::Array<size_t> cursor(numCells);
+  std::copy(cellPrefix.begin(), cellPrefix.end()-1, cursor.begin());
+  sl::Array<vtx_type> points(numVertices);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (vtx_type p = 0; p < numVertices; ++p) {
+    size_t const cell = cellOf(p);
+    size_t slot;
+    #ifdef _OPENMP
+    #pragma omp atomic capture
+    #endif
+    slot = cursor[cell]++;
+    points[slot] = p;
+  }
+
+  std::vector<double> coords(static_cast<size_t>(numVertices)*numDims);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 1024)
+  #endif
+  for (size_t c = 0; c < numCells; ++c) {
+    std::sort(points.data()+cellPrefix[c], points.data()+cellPrefix[c+1]);
+    for (size_t i = cellPrefix[c]; i < cellPrefix[c+1]; ++i) {
+      for (unsigned int d = 0; d < numDims; ++d) {
+        coords[i*numDims+d] = coordinate(points[i], d);
+      }
+    }
+  }
+
+  // find the neighbors of each vertex with a higher number, first counting
+  // them and then recording them
+  double const radius2 = m_radius*m_radius;
+  auto forEachNeighbor = [&](size_t const c, vtx_type const v, \
+      auto const & visit) {
+    size_t cc[MAX_DIMENSIONS] = {0, 0, 0};
+    size_t rest = c;
+    for (unsigned int d = 0; d < numDims; ++d) {
+      cc[d] = rest % cellsPerDim;
+      rest /= cellsPerDim;
+    }
+
+    size_t const zStart = numDims == 3 && cc[2] > 0 ? cc[2]-1 : cc[2];
+    size_t const zEnd = numDims == 3 ? std::min(cc[2]+2, cellsPerDim) : 1;
+    size_t const yStart = cc[1] > 0 ? cc[1]-1 : 0;
+    size_t const yEnd = std::min(cc[1]+2, cellsPerDim);
+    size_t const xStart = cc[0] > 0 ? cc[0]-1 : 0;
+    size_t const xEnd = std::min(cc[0]+2, cellsPerDim);
+    for (size_t z = zStart; z < zEnd; ++z) {
+      for (size_t y = yStart; y < yEnd; ++y) {
+        for (size_t x = xStart; x < xEnd; ++x) {
+          size_t const other = (z*cellsPerDim + y)*cellsPerDim + x;
+          for (size_t u = std::max(cellPrefix[other], \
+              static_cast<size_t>(v)+1); u < cellPrefix[other+1]; ++u) {
+            double dist2 = 0;
+            for (unsigned int d = 0; d < numDims; ++d) {
+              double const diff = coords[u*numDims+d] - coords[v*numDims+d];
+              dist2 += diff*diff;
+            }
+            if (dist2 <= radius2) {
+              visit(static_cast<vtx_type>(u));
+            }
+          }
+        }
+      }
+    }
+  };
+
+  sl::Array<size_t> edgePrefix(numVertices+1);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 16)
+  #endif
+  for (size_t c = 0; c < numCells; ++c) {
+    for (size_t v = cellPrefix[c]; v < cellPrefix[c+1]; ++v) {
+      size_t count = 0;
+      forEachNeighbor(c, static_cast<vtx_type>(v), [&](vtx_type) {
+        ++count;
+      });
+      edgePrefix[v] = count;
+    }
+  }
+  edgePrefix[numVertices] = 0;
+  sl::VectorMath::prefixSumExclusive(edgePrefix.begin(), edgePrefix.end());
+
+  std::vector<vtx_type> sources(edgePrefix[numVertices]);
+  std::vector<vtx_type> dests(edgePrefix[numVertices]);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 16)
+  #endif
+  for (size_t c = 0; c < numCells; ++c) {
+    for (size_t v = cellPrefix[c]; v < cellPrefix[c+1]; ++v) {
+      size_t edge = edgePrefix[v];
+      forEachNeighbor(c, static_cast<vtx_type>(v), [&](vtx_type const u) {
+        sources[edge] = static_cast<vtx_type>(v);
+        dests[edge] = u;
+        ++edge;
+      });
+    }
+  }
+
+  return build(numVertices, std::move(sources), std::move(dests));
+}
+
+
+}
@@ -0,0 +1,97 @@
+/**
+* @file GeometricGraphGenerator.hpp
+* @brief The GeometricGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_GEOMETRICGRAPHGENERATOR_HPP
+#define POROS_SRC_GEOMETRICGRAPHGENERATOR_HPP
+
+
+#include "graph/RandomGraphGenerator.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Generates random geometric graphs, where points are placed uniformly
+* in the unit square or cube, and connected to all other points within a
+* radius. The radius is chosen to give the requested average degree (less
+* near the boundary). Vertices are numbered by their cell in a grid with
+* cells the size of the radius, so that neighbors are numbered close
+* together as they are in meshes.
+*/
+class GeometricGraphGenerator : public RandomGraphGenerator
+{
+  public:
+    /**
+    * @brief Create a new random geometric graph generator.
+    *
+    * @param numVertices The number of vertices.
+    * @param averageDegree The expected degree of a vertex away from the
+    * boundary.
+    * @param numDimensions The number of dimensions (2 or 3).
+    * @param seed The random seed.
+    *
+    * @throws std::runtime_error If the average degree is not positive.
+    */
+    GeometricGraphGenerator(
+        vtx_type numVertices,
+        double averageDegree,
+        unsigned int numDimensions,
+        unsigned int seed);
+
+
+    /**
+    * @brief Get the radius within which points are connected.
+    *
+    * @return The radius.
+    */
+    double radius() const noexcept;
+
+
+    /**
+    * @brief Generate the graph.
+    *
+    * @return The generated graph.
+    *
+    * @throws std::runtime_error If the graph has too many edges for adj_type.
+    */
+    Graph generate() override;
+
+
+  private:
+    vtx_type m_numVertices;
+    unsigned int m_numDimensions;
+    double m_radius;
+
+};
+
+
+}
+
+
+#endif
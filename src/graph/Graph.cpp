@@ -90,6 +90,7 @@ Graph::Graph(
   m_numEdges(edgeList.size()),
   m_totalVertexWeight(0),
   m_totalEdgeWeight(0),
+  m_data(),
   m_edgePrefix(std::move(edgePrefix)),
   m_edgeList(std::move(edgeList)),
   m_vertexWeight(std::move(vertexWeight)),
@@ -147,6 +148,7 @@ Graph::Graph(
   m_numEdges(edgeList.size()),
   m_totalVertexWeight(totalVertexWeight),
   m_totalEdgeWeight(totalEdgeWeight),
+  m_data(),
   m_edgePrefix(std::move(edgePrefix)),
   m_edgeList(std::move(edgeList)),
   m_vertexWeight(std::move(vertexWeight)),
@@ -164,6 +166,7 @@ Graph::Graph(
   m_numEdges(lhs.m_numEdges),
   m_totalVertexWeight(lhs.m_totalVertexWeight),
   m_totalEdgeWeight(lhs.m_totalEdgeWeight),
+  m_data(std::move(lhs.m_data)),
   m_edgePrefix(std::move(lhs.m_edgePrefix)),
   m_edgeList(std::move(lhs.m_edgeList)),
   m_vertexWeight(std::move(lhs.m_vertexWeight)),
@@ -38,6 +38,7 @@
 #include "solidutils/ConstArray.hpp"
 #include "solidutils/Debug.hpp"
 #include <cstdlib>
+#include <memory>
 
 
 namespace poros
@@ -338,7 +339,34 @@ class Graph
       return m_unitVertexWeight;
     }
 
+    /**
+    * @brief Get the number of bytes used by the arrays of this graph
+    * (regardless of whether or not they are owned by it).
+    *
+    * @return The number of bytes.
+    */
+    size_t getMemoryUsage() const noexcept
+    {
+      return m_edgePrefix.size()*sizeof(adj_type) + \
+          m_edgeList.size()*sizeof(vtx_type) + \
+          m_vertexWeight.size()*sizeof(wgt_type) + \
+          m_edgeWeight.size()*sizeof(wgt_type);
+    }
+
    
+    /**
+    * @brief Tie the lifetime of some data to this graph, such as the backing
+    * memory of externally owned arrays.
+    *
+    * @param data The data.
+    */
+    void setAllocatedData(
+        std::unique_ptr<IAllocatedData> data) noexcept
+    {
+      m_data = std::move(data);
+    }
+
+
     #ifndef NDEBUG
     /**
     * @brief Check if this graph is internally coherent.
@@ -358,6 +386,9 @@ class Graph
     wgt_type m_totalVertexWeight;
     wgt_type m_totalEdgeWeight;
 
+    // declared before the arrays so that it outlives them
+    std::unique_ptr<IAllocatedData> m_data;
+
     sl::ConstArray<adj_type> m_edgePrefix;
     sl::ConstArray<vtx_type> m_edgeList;
     sl::ConstArray<wgt_type> m_vertexWeight;
@@ -0,0 +1,455 @@
+/**
+* @file MatrixMarketReader.cpp
+* @brief Implementation of the MatrixMarketReader class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MatrixMarketReader.hpp"
+
+#include "graph/EdgeListGraphBuilder.hpp"
+#include "util/LineParser.hpp"
+#include "util/MemoryMappedFile.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+enum field_type {
+  FIELD_REAL,
+  FIELD_INTEGER,
+  FIELD_COMPLEX,
+  FIELD_PATTERN
+};
+
+
+enum symmetry_type {
+  SYMMETRY_GENERAL,
+  SYMMETRY_SYMMETRIC,
+  SYMMETRY_SKEW_SYMMETRIC,
+  SYMMETRY_HERMITIAN
+};
+
+
+/**
+* @brief The format and size of the matrix, as given by the banner and size
+* line.
+*/
+struct format_struct
+{
+  field_type field;
+  symmetry_type symmetry;
+  vtx_type numRows;
+  size_t numEntries;
+};
+
+
+/**
+* @brief A line aligned range of the body of the file, and what was found in
+* it.
+*/
+struct chunk_struct
+{
+  char const * begin;
+  char const * end;
+  size_t numEntries;
+  std::string error;
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+inline bool isComment(
+    char const * const line,
+    char const * const end) noexcept
+{
+  return line < end && *line == '%';
+}
+
+
+/**
+* @brief Split a (short) line into lower case tokens.
+*
+* @param line The start of the line.
+* @param end The end of the line.
+*
+* @return The tokens.
+*/
+std::vector<std::string> lowerTokens(
+    char const * line,
+    char const * const end)
+{
+  std::vector<std::string> tokens;
+  line = LineParser::skipSpace(line, end);
+  while (line < end) {
+    std::string token;
+    while (line < end && !LineParser::isSpace(*line)) {
+      token.push_back(static_cast<char>(std::tolower(*line)));
+      ++line;
+    }
+    tokens.emplace_back(std::move(token));
+    line = LineParser::skipSpace(line, end);
+  }
+  return tokens;
+}
+
+
+/**
+* @brief Parse the banner and size lines, skipping the comment lines between
+* them.
+*
+* @param ptr The start of the file (updated to the start of the entries).
+* @param end The end of the file.
+*
+* @return The format of the file.
+*/
+format_struct parseHeader(
+    char const ** const ptr,
+    char const * const end)
+{
+  char const * line = *ptr;
+  char const * lineEnd = LineParser::findLineEnd(line, end);
+
+  std::vector<std::string> const banner = lowerTokens(line, lineEnd);
+  if (banner.size() != 5 || \
+      banner[0] != "%%matrixmarket" || \
+      banner[1] != "matrix") {
+    throw std::runtime_error("Invalid Matrix Market banner: '" + \
+        LineParser::excerpt(line, lineEnd) + "'");
+  }
+  if (banner[2] != "coordinate") {
+    throw std::runtime_error("Only Matrix Market coordinate files are " \
+        "supported: '" + LineParser::excerpt(line, lineEnd) + "'");
+  }
+
+  format_struct format;
+  if (banner[3] == "real" || banner[3] == "double") {
+    format.field = FIELD_REAL;
+  } else if (banner[3] == "integer") {
+    format.field = FIELD_INTEGER;
+  } else if (banner[3] == "complex") {
+    format.field = FIELD_COMPLEX;
+  } else if (banner[3] == "pattern") {
+    format.field = FIELD_PATTERN;
+  } else {
+    throw std::runtime_error("Unknown Matrix Market field: '" + banner[3] + \
+        "'");
+  }
+
+  if (banner[4] == "general") {
+    format.symmetry = SYMMETRY_GENERAL;
+  } else if (banner[4] == "symmetric") {
+    format.symmetry = SYMMETRY_SYMMETRIC;
+  } else if (banner[4] == "skew-symmetric") {
+    format.symmetry = SYMMETRY_SKEW_SYMMETRIC;
+  } else if (banner[4] == "hermitian") {
+    format.symmetry = SYMMETRY_HERMITIAN;
+  } else {
+    throw std::runtime_error("Unknown Matrix Market symmetry: '" + \
+        banner[4] + "'");
+  }
+
+  // skip comments and blank lines
+  do {
+    line = LineParser::nextLine(lineEnd, end);
+    lineEnd = LineParser::findLineEnd(line, end);
+  } while (line < end && (isComment(line, lineEnd) || \
+      LineParser::skipSpace(line, lineEnd) == lineEnd));
+
+  char const * pos = LineParser::skipSpace(line, lineEnd);
+  uint64_t numRows, numCols, numEntries;
+  if (!LineParser::parseUnsigned(&pos, lineEnd, &numRows) || \
+      !LineParser::parseUnsigned(&pos, lineEnd, &numCols) || \
+      !LineParser::parseUnsigned(&pos, lineEnd, &numEntries) || \
+      pos < lineEnd) {
+    throw std::runtime_error("Invalid Matrix Market size line: '" + \
+        LineParser::excerpt(line, lineEnd) + "'");
+  }
+  if (numRows != numCols) {
+    throw std::runtime_error("Matrix must be square to be read as a " \
+        "graph: " + std::to_string(numRows) + "x" + std::to_string(numCols));
+  }
+  if (numRows >= static_cast<uint64_t>(NULL_VTX)) {
+    throw std::runtime_error("Too many rows for vtx_type: " + \
+        std::to_string(numRows));
+  }
+
+  format.numRows = static_cast<vtx_type>(numRows);
+  format.numEntries = static_cast<size_t>(numEntries);
+
+  *ptr = LineParser::nextLine(lineEnd, end);
+
+  return format;
+}
+
+
+/**
+* @brief Count the entry lines in a chunk.
+*
+* @param chunk The chunk.
+*/
+void countChunk(
+    chunk_struct * const chunk)
+{
+  char const * line = chunk->begin;
+  while (line < chunk->end) {
+    char const * const lineEnd = LineParser::findLineEnd(line, chunk->end);
+    if (!isComment(line, lineEnd) && \
+        LineParser::skipSpace(line, lineEnd) < lineEnd) {
+      ++chunk->numEntries;
+    }
+    line = LineParser::nextLine(lineEnd, chunk->end);
+  }
+}
+
+
+/**
+* @brief Parse the entries of a chunk into its slice of the edge arrays.
+*
+* @param format The format of the file.
+* @param valueWeights Whether to weight edges by the values.
+* @param entryStart The number of entries before this chunk.
+* @param chunk The chunk.
+* @param sources The row of each entry.
+* @param dests The column of each entry.
+* @param weights The weight of each entry.
+* @param rowCounts The number of entries in each row (may be null).
+*/
+void parseChunk(
+    format_struct const & format,
+    bool const valueWeights,
+    size_t const entryStart,
+    chunk_struct * const chunk,
+    vtx_type * const sources,
+    vtx_type * const dests,
+    wgt_type * const weights,
+    wgt_type * const rowCounts)
+{
+  // only one triangle is stored for anything other than general matrices,
+  // and so those entries count for both a_ij and a_ji
+  bool const mirrored = format.symmetry != SYMMETRY_GENERAL;
+
+  size_t entry = entryStart;
+
+  char const * line = chunk->begin;
+  while (line < chunk->end) {
+    char const * const lineEnd = LineParser::findLineEnd(line, chunk->end);
+    char const * pos = LineParser::skipSpace(line, lineEnd);
+
+    if (!isComment(line, lineEnd) && pos < lineEnd) {
+      uint64_t row, col;
+      bool valid = LineParser::parseUnsigned(&pos, lineEnd, &row) && \
+          LineParser::parseUnsigned(&pos, lineEnd, &col) && \
+          row > 0 && row <= format.numRows && \
+          col > 0 && col <= format.numRows;
+
+      double magnitude = 1.0;
+      if (valid && format.field != FIELD_PATTERN) {
+        double real;
+        valid = LineParser::parseReal(&pos, lineEnd, &real);
+        magnitude = std::fabs(real);
+        if (valid && format.field == FIELD_COMPLEX) {
+          double imag;
+          valid = LineParser::parseReal(&pos, lineEnd, &imag);
+          magnitude = std::hypot(real, imag);
+        }
+      }
+
+      if (!valid || pos < lineEnd) {
+        chunk->error = "Invalid Matrix Market entry: '" + \
+            LineParser::excerpt(line, lineEnd) + "'";
+        return;
+      }
+
+      vtx_type const u = static_cast<vtx_type>(row-1);
+      vtx_type const v = static_cast<vtx_type>(col-1);
+
+      wgt_type weight = 1;
+      if (valueWeights) {
+        // clamp to the range of wgt_type, as converting a value outside of
+        // it is undefined
+        double const value = std::max(1.0, std::round( \
+            mirrored && u != v ? 2.0*magnitude : magnitude));
+        weight = static_cast<wgt_type>(std::min(value, \
+            static_cast<double>(std::numeric_limits<wgt_type>::max())));
+      }
+
+      sources[entry] = u;
+      dests[entry] = v;
+      weights[entry] = weight;
+      ++entry;
+
+      if (rowCounts) {
+        #ifdef _OPENMP
+        #pragma omp atomic
+        #endif
+        ++rowCounts[u];
+        if (mirrored && u != v) {
+          #ifdef _OPENMP
+          #pragma omp atomic
+          #endif
+          ++rowCounts[v];
+        }
+      }
+    }
+
+    line = LineParser::nextLine(lineEnd, chunk->end);
+  }
+}
+
+
+void checkChunks(
+    std::vector<chunk_struct> const & chunks)
+{
+  for (chunk_struct const & chunk : chunks) {
+    if (!chunk.error.empty()) {
+      throw std::runtime_error(chunk.error);
+    }
+  }
+}
+
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+MatrixMarketReader::MatrixMarketReader(
+    std::string const & filename) :
+  m_filename(filename),
+  m_valueEdgeWeights(false),
+  m_rowVertexWeights(false)
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void MatrixMarketReader::setValueEdgeWeights(
+    bool const valueEdgeWeights) noexcept
+{
+  m_valueEdgeWeights = valueEdgeWeights;
+}
+
+
+void MatrixMarketReader::setRowVertexWeights(
+    bool const rowVertexWeights) noexcept
+{
+  m_rowVertexWeights = rowVertexWeights;
+}
+
+
+Graph MatrixMarketReader::read()
+{
+  MemoryMappedFile file(m_filename);
+
+  char const * body = file.data();
+  char const * const end = file.data() + file.size();
+
+  format_struct const format = parseHeader(&body, end);
+  bool const valueWeights = m_valueEdgeWeights && \
+      format.field != FIELD_PATTERN;
+
+  std::vector<chunk_struct> chunks;
+  for (LineParser::range_type const & range : LineParser::split(body, end)) {
+    chunks.push_back(chunk_struct{range.first, range.second, 0, ""});
+  }
+  int const numChunks = static_cast<int>(chunks.size());
+
+  // first pass: count the entries in each chunk
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (int i = 0; i < numChunks; ++i) {
+    countChunk(&chunks[i]);
+  }
+
+  std::vector<size_t> entryStarts(chunks.size()+1, 0);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    entryStarts[i+1] = entryStarts[i] + chunks[i].numEntries;
+  }
+  if (entryStarts.back() != format.numEntries) {
+    throw std::runtime_error("Expected " + \
+        std::to_string(format.numEntries) + " entries in Matrix Market " \
+        "file, but found " + std::to_string(entryStarts.back()) + ".");
+  }
+
+  std::vector<vtx_type> sources(format.numEntries);
+  std::vector<vtx_type> dests(format.numEntries);
+  std::vector<wgt_type> weights(format.numEntries);
+  std::vector<wgt_type> rowCounts;
+  if (m_rowVertexWeights) {
+    rowCounts.resize(format.numRows, 0);
+  }
+
+  // second pass: parse each chunk in to its slice of the edge arrays
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (int i = 0; i < numChunks; ++i) {
+    parseChunk(format, valueWeights, entryStarts[i], &chunks[i], \
+        sources.data(), dests.data(), weights.data(), \
+        m_rowVertexWeights ? rowCounts.data() : nullptr);
+  }
+  checkChunks(chunks);
+
+  EdgeListGraphBuilder builder(format.numRows);
+  if (!valueWeights) {
+    // a_ij and a_ji are the same edge of A+A^T
+    builder.setMergeType(EdgeListGraphBuilder::MERGE_MAX);
+  }
+  builder.addEdges(std::move(sources), std::move(dests), std::move(weights));
+  if (m_rowVertexWeights) {
+    for (vtx_type v = 0; v < format.numRows; ++v) {
+      builder.setVertexWeight(v, std::max<wgt_type>(1, rowCounts[v]));
+    }
+  }
+
+  return builder.finish();
+}
+
+
+}
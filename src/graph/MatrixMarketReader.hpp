@@ -0,0 +1,105 @@
+/**
+* @file MatrixMarketReader.hpp
+* @brief The MatrixMarketReader class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_MATRIXMARKETREADER_HPP
+#define POROS_SRC_MATRIXMARKETREADER_HPP
+
+
+#include "Base.hpp"
+#include "graph/Graph.hpp"
+
+#include <string>
+
+
+namespace poros
+{
+
+/**
+* @brief Reads square sparse matrices in the Matrix Market coordinate format,
+* as the adjacency graph of A+A^T. The file is memory mapped and split into
+* line aligned chunks, which are parsed in parallel (when built with OpenMP).
+*
+* The diagonal is dropped. By default every edge has a weight of one and
+* every vertex a weight of one. Optionally, the edge {i,j} can instead be
+* weighted by |a_ij| + |a_ji| (rounded, and at least one), and each vertex
+* by the number of non-zeros in its row of A (at least one).
+*/
+class MatrixMarketReader
+{
+  public:
+    /**
+    * @brief Create a new reader.
+    *
+    * @param filename The name of the file to read.
+    */
+    MatrixMarketReader(
+        std::string const & filename);
+
+
+    /**
+    * @brief Set whether to use the magnitude of the values of the matrix as
+    * edge weights.
+    *
+    * @param valueEdgeWeights True to use values as edge weights.
+    */
+    void setValueEdgeWeights(
+        bool valueEdgeWeights) noexcept;
+
+
+    /**
+    * @brief Set whether to use the number of non-zeros in each row as vertex
+    * weights.
+    *
+    * @param rowVertexWeights True to use the row lengths as vertex weights.
+    */
+    void setRowVertexWeights(
+        bool rowVertexWeights) noexcept;
+
+
+    /**
+    * @brief Read the graph.
+    *
+    * @return The graph.
+    *
+    * @throws std::runtime_error If the file cannot be read, is not a valid
+    * Matrix Market coordinate file, or the matrix is not square.
+    */
+    Graph read();
+
+  private:
+    std::string m_filename;
+    bool m_valueEdgeWeights;
+    bool m_rowVertexWeights;
+
+};
+
+
+}
+
+
+#endif
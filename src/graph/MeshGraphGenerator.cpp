@@ -0,0 +1,203 @@
+/**
+* @file MeshGraphGenerator.cpp
+* @brief Implementation of the MeshGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MeshGraphGenerator.hpp"
+#include "solidutils/Array.hpp"
+#include "solidutils/Debug.hpp"
+#include "solidutils/VectorMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+struct hole_struct
+{
+  double x;
+  double y;
+  double radius;
+};
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+enum {
+  HOLE_X_STREAM,
+  HOLE_Y_STREAM,
+  HOLE_RADIUS_STREAM
+};
+
+// the offsets of the neighbors of a vertex with higher numbers
+int const NUM_FORWARD_EDGES = 3;
+int const FORWARD_X[NUM_FORWARD_EDGES] = {1, 0, 1};
+int const FORWARD_Y[NUM_FORWARD_EDGES] = {0, 1, 1};
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+MeshGraphGenerator::MeshGraphGenerator(
+    vtx_type const numX,
+    vtx_type const numY,
+    vtx_type const numHoles,
+    double const maxHoleRadius,
+    unsigned int const seed) :
+  RandomGraphGenerator(seed),
+  m_numX(numX),
+  m_numY(numY),
+  m_numHoles(numHoles),
+  m_maxHoleRadius(maxHoleRadius)
+{
+  ASSERT_GREATER(numX, 0);
+  ASSERT_GREATER(numY, 0);
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+Graph MeshGraphGenerator::generate()
+{
+  vtx_type const numX = m_numX;
+  vtx_type const numY = m_numY;
+  size_t const numPoints = static_cast<size_t>(numX)*numY;
+  if (numPoints >= static_cast<size_t>(NULL_VTX)) {
+    throw std::runtime_error("Too many vertices for vtx_type: " + \
+        std::to_string(numPoints));
+  }
+
+  std::vector<hole_struct> holes(m_numHoles);
+  for (vtx_type h = 0; h < m_numHoles; ++h) {
+    holes[h].x = randomReal(HOLE_X_STREAM, h) * numX;
+    holes[h].y = randomReal(HOLE_Y_STREAM, h) * numY;
+    holes[h].radius = m_maxHoleRadius * \
+        (0.5 + 0.5*randomReal(HOLE_RADIUS_STREAM, h));
+  }
+
+  // cut out the holes one row at a time, marking each kept point with a one
+  sl::Array<vtx_type> vertexOf(numPoints+1);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (vtx_type y = 0; y < numY; ++y) {
+    vtx_type * const row = vertexOf.data() + static_cast<size_t>(y)*numX;
+    std::fill(row, row+numX, 1);
+    for (hole_struct const & hole : holes) {
+      double const dy = y - hole.y;
+      if (std::fabs(dy) < hole.radius) {
+        double const halfWidth = std::sqrt(hole.radius*hole.radius - dy*dy);
+        double const xStart = std::max(0.0, std::ceil(hole.x - halfWidth));
+        double const xEnd = std::min(static_cast<double>(numX), \
+            std::floor(hole.x + halfWidth) + 1.0);
+        for (double x = xStart; x < xEnd; x += 1.0) {
+          row[static_cast<vtx_type>(x)] = 0;
+        }
+      }
+    }
+  }
+
+  // number the kept points
+  vertexOf[numPoints] = 0;
+  sl::VectorMath::prefixSumExclusive(vertexOf.begin(), vertexOf.end());
+  vtx_type const numVertices = vertexOf[numPoints];
+
+  auto isKept = [&](size_t const point) {
+    return vertexOf[point+1] != vertexOf[point];
+  };
+  auto forEachEdge = [&](vtx_type const y, auto const & visit) {
+    for (vtx_type x = 0; x < numX; ++x) {
+      size_t const point = static_cast<size_t>(y)*numX + x;
+      if (!isKept(point)) {
+        continue;
+      }
+      for (int e = 0; e < NUM_FORWARD_EDGES; ++e) {
+        vtx_type const ox = x + FORWARD_X[e];
+        vtx_type const oy = y + FORWARD_Y[e];
+        if (ox < numX && oy < numY) {
+          size_t const other = static_cast<size_t>(oy)*numX + ox;
+          if (isKept(other)) {
+            visit(vertexOf[point], vertexOf[other]);
+          }
+        }
+      }
+    }
+  };
+
+  // count and then record the edges of each row
+  sl::Array<size_t> edgePrefix(numY+1);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (vtx_type y = 0; y < numY; ++y) {
+    size_t count = 0;
+    forEachEdge(y, [&count](vtx_type, vtx_type) {
+      ++count;
+    });
+    edgePrefix[y] = count;
+  }
+  edgePrefix[numY] = 0;
+  sl::VectorMath::prefixSumExclusive(edgePrefix.begin(), edgePrefix.end());
+
+  std::vector<vtx_type> sources(edgePrefix[numY]);
+  std::vector<vtx_type> dests(edgePrefix[numY]);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (vtx_type y = 0; y < numY; ++y) {
+    size_t edge = edgePrefix[y];
+    forEachEdge(y, [&](vtx_type const u, vtx_type const v) {
+      sources[edge] = u;
+      dests[edge] = v;
+      ++edge;
+    });
+  }
+
+  return build(numVertices, std::move(sources), std::move(dests));
+}
+
+
+}
@@ -0,0 +1,90 @@
+/**
+* @file MeshGraphGenerator.hpp
+* @brief The MeshGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_MESHGRAPHGENERATOR_HPP
+#define POROS_SRC_MESHGRAPHGENERATOR_HPP
+
+
+#include "graph/RandomGraphGenerator.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Generates 2D triangular meshes with circular holes cut out of them.
+* The mesh is a grid where each square is split by a diagonal, and the
+* vertices inside the holes are removed. The holes make the boundaries
+* irregular, unlike those of a plain grid, and may split the mesh into more
+* than one piece.
+*/
+class MeshGraphGenerator : public RandomGraphGenerator
+{
+  public:
+    /**
+    * @brief Create a new mesh generator.
+    *
+    * @param numX The number of vertices in X.
+    * @param numY The number of vertices in Y.
+    * @param numHoles The number of holes to place at random.
+    * @param maxHoleRadius The maximum radius of a hole, in vertices (each
+    * radius is drawn uniformly between half of this and this).
+    * @param seed The random seed.
+    */
+    MeshGraphGenerator(
+        vtx_type numX,
+        vtx_type numY,
+        vtx_type numHoles,
+        double maxHoleRadius,
+        unsigned int seed);
+
+
+    /**
+    * @brief Generate the graph.
+    *
+    * @return The generated graph.
+    *
+    * @throws std::runtime_error If the grid has too many points for vtx_type,
+    * or the graph has too many edges for adj_type.
+    */
+    Graph generate() override;
+
+
+  private:
+    vtx_type m_numX;
+    vtx_type m_numY;
+    vtx_type m_numHoles;
+    double m_maxHoleRadius;
+
+};
+
+
+}
+
+
+#endif
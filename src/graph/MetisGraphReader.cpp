@@ -0,0 +1,403 @@
+/**
+* @file MetisGraphReader.cpp
+* @brief Implementation of the MetisGraphReader class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MetisGraphReader.hpp"
+
+#include "util/MemoryMappedFile.hpp"
+#include "util/MemoryPolicy.hpp"
+#include "util/LineParser.hpp"
+#include "solidutils/Array.hpp"
+#include "solidutils/VectorMath.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief The layout of each vertex line, as given by the header.
+*/
+struct format_struct
+{
+  vtx_type numVertices;
+  adj_type numEdges;
+  bool hasVertexSizes;
+  bool hasVertexWeights;
+  bool hasEdgeWeights;
+};
+
+
+/**
+* @brief A line aligned range of the body of the file, and what was found in
+* it.
+*/
+struct chunk_struct
+{
+  char const * begin;
+  char const * end;
+  vtx_type numLines;
+  adj_type numEdges;
+  std::string error;
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+inline bool isComment(
+    char const * const line,
+    char const * const end) noexcept
+{
+  return line < end && *line == '%';
+}
+
+
+/**
+* @brief Parse the header line, skipping any comment lines before it.
+*
+* @param ptr The start of the file (updated to the start of the body).
+* @param end The end of the file.
+*
+* @return The format of the file.
+*/
+format_struct parseHeader(
+    char const ** const ptr,
+    char const * const end)
+{
+  char const * line = *ptr;
+  char const * lineEnd = line < end ? LineParser::findLineEnd(line, end) : end;
+  while (line < end && isComment(line, lineEnd)) {
+    line = LineParser::nextLine(lineEnd, end);
+    lineEnd = line < end ? LineParser::findLineEnd(line, end) : end;
+  }
+
+  if (line >= end) {
+    throw std::runtime_error("Missing METIS graph header.");
+  }
+
+  format_struct format{0, 0, false, false, false};
+
+  char const * pos = LineParser::skipSpace(line, lineEnd);
+  uint64_t numEdges;
+  if (!LineParser::parseUnsigned(&pos, lineEnd, &format.numVertices) || \
+      !LineParser::parseUnsigned(&pos, lineEnd, &numEdges)) {
+    throw std::runtime_error("Invalid METIS graph header: '" + \
+        LineParser::excerpt(line, lineEnd) + "'");
+  }
+
+  // edges are listed in both directions
+  format.numEdges = static_cast<adj_type>(2*numEdges);
+
+  if (pos < lineEnd) {
+    // the format flags are read as decimal digits, so leading zeros do not
+    // matter
+    unsigned int fmt;
+    if (!LineParser::parseUnsigned(&pos, lineEnd, &fmt) || fmt % 10 > 1 || \
+        (fmt / 10) % 10 > 1 || fmt / 100 > 1) {
+      throw std::runtime_error("Invalid METIS graph format: '" + \
+          LineParser::excerpt(line, lineEnd) + "'");
+    }
+    format.hasEdgeWeights = fmt % 10 == 1;
+    format.hasVertexWeights = (fmt / 10) % 10 == 1;
+    format.hasVertexSizes = fmt / 100 == 1;
+  }
+
+  if (pos < lineEnd) {
+    unsigned int ncon;
+    if (!LineParser::parseUnsigned(&pos, lineEnd, &ncon) || pos < lineEnd) {
+      throw std::runtime_error("Invalid METIS graph header: '" + \
+          LineParser::excerpt(line, lineEnd) + "'");
+    }
+    if (ncon > 1 || (ncon == 1 && !format.hasVertexWeights)) {
+      throw std::runtime_error("Only a single vertex weight is " \
+          "supported: '" + LineParser::excerpt(line, lineEnd) + "'");
+    }
+  }
+
+  *ptr = LineParser::nextLine(lineEnd, end);
+
+  return format;
+}
+
+
+/**
+* @brief Split the body of the file into line aligned chunks.
+*
+* @param begin The start of the body.
+* @param end The end of the body.
+*
+* @return The chunks.
+*/
+std::vector<chunk_struct> splitChunks(
+    char const * const begin,
+    char const * const end)
+{
+  std::vector<chunk_struct> chunks;
+  for (LineParser::range_type const & range : LineParser::split(begin, end)) {
+    chunks.push_back(chunk_struct{range.first, range.second, 0, 0, ""});
+  }
+
+  return chunks;
+}
+
+
+/**
+* @brief Count the vertex lines and edges in a chunk.
+*
+* @param format The format of the file.
+* @param chunk The chunk.
+*/
+void countChunk(
+    format_struct const & format,
+    chunk_struct * const chunk)
+{
+  size_t const leading = (format.hasVertexSizes ? 1 : 0) + \
+      (format.hasVertexWeights ? 1 : 0);
+  size_t const perEdge = format.hasEdgeWeights ? 2 : 1;
+
+  char const * line = chunk->begin;
+  while (line < chunk->end) {
+    char const * const lineEnd = LineParser::findLineEnd(line, chunk->end);
+
+    if (!isComment(line, lineEnd)) {
+      size_t const numTokens = LineParser::countTokens(line, lineEnd);
+      if (numTokens > 0 && (numTokens < leading || \
+          (numTokens - leading) % perEdge != 0)) {
+        chunk->error = "Invalid number of values in METIS graph line: '" + \
+            LineParser::excerpt(line, lineEnd) + "'";
+        return;
+      }
+
+      ++chunk->numLines;
+      if (numTokens > 0) {
+        chunk->numEdges += static_cast<adj_type>((numTokens - leading) / \
+            perEdge);
+      }
+    }
+
+    line = LineParser::nextLine(lineEnd, chunk->end);
+  }
+}
+
+
+/**
+* @brief Parse the vertex lines of a chunk into the graph arrays.
+*
+* @param format The format of the file.
+* @param vertexStart The number of vertex lines before this chunk.
+* @param edgeStart The number of edges before this chunk.
+* @param chunk The chunk.
+* @param edgePrefix The edge prefix array.
+* @param edgeList The edge list array.
+* @param vertexWeight The vertex weight array (may be null).
+* @param edgeWeight The edge weight array (may be null).
+*/
+void parseChunk(
+    format_struct const & format,
+    vtx_type const vertexStart,
+    adj_type const edgeStart,
+    chunk_struct * const chunk,
+    adj_type * const edgePrefix,
+    vtx_type * const edgeList,
+    wgt_type * const vertexWeight,
+    wgt_type * const edgeWeight)
+{
+  vtx_type vertex = vertexStart;
+  adj_type edge = edgeStart;
+
+  char const * line = chunk->begin;
+  while (line < chunk->end) {
+    char const * const lineEnd = LineParser::findLineEnd(line, chunk->end);
+
+    if (!isComment(line, lineEnd)) {
+      char const * pos = LineParser::skipSpace(line, lineEnd);
+
+      if (vertex >= format.numVertices) {
+        // trailing blank lines are fine
+        if (pos < lineEnd) {
+          chunk->error = "More than " + std::to_string(format.numVertices) + \
+              " vertex lines in METIS graph.";
+          return;
+        }
+      } else {
+        bool valid = true;
+        if (format.hasVertexSizes) {
+          vtx_type size;
+          valid = LineParser::parseUnsigned(&pos, lineEnd, &size);
+        }
+        if (valid && format.hasVertexWeights) {
+          valid = LineParser::parseUnsigned(&pos, lineEnd, \
+              vertexWeight + vertex);
+        }
+
+        while (valid && pos < lineEnd) {
+          vtx_type u = 0;
+          valid = LineParser::parseUnsigned(&pos, lineEnd, &u) && u > 0 && \
+              u <= format.numVertices;
+          if (!valid) {
+            break;
+          }
+          edgeList[edge] = u - 1;
+          if (format.hasEdgeWeights) {
+            valid = LineParser::parseUnsigned(&pos, lineEnd, edgeWeight + edge);
+          }
+          ++edge;
+        }
+
+        if (!valid) {
+          chunk->error = "Invalid line for vertex " + \
+              std::to_string(vertex+1) + " in METIS graph: '" + \
+              LineParser::excerpt(line, lineEnd) + "'";
+          return;
+        }
+
+        edgePrefix[vertex+1] = edge;
+        ++vertex;
+      }
+    }
+
+    line = LineParser::nextLine(lineEnd, chunk->end);
+  }
+}
+
+
+void checkChunks(
+    std::vector<chunk_struct> const & chunks)
+{
+  for (chunk_struct const & chunk : chunks) {
+    if (!chunk.error.empty()) {
+      throw std::runtime_error(chunk.error);
+    }
+  }
+}
+
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+MetisGraphReader::MetisGraphReader(
+    std::string const & filename) :
+  m_filename(filename)
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+Graph MetisGraphReader::read()
+{
+  MemoryMappedFile file(m_filename);
+
+  char const * body = file.data();
+  char const * const end = file.data() + file.size();
+
+  format_struct const format = parseHeader(&body, end);
+
+  std::vector<chunk_struct> chunks = splitChunks(body, end);
+  int const numChunks = static_cast<int>(chunks.size());
+
+  // first pass: count the lines and edges in each chunk
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (int i = 0; i < numChunks; ++i) {
+    countChunk(format, &chunks[i]);
+  }
+  checkChunks(chunks);
+
+  std::vector<vtx_type> vertexStarts(chunks.size()+1, 0);
+  std::vector<adj_type> edgeStarts(chunks.size()+1, 0);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    vertexStarts[i+1] = vertexStarts[i] + chunks[i].numLines;
+    edgeStarts[i+1] = edgeStarts[i] + chunks[i].numEdges;
+  }
+
+  if (vertexStarts.back() < format.numVertices) {
+    throw std::runtime_error("Expected " + \
+        std::to_string(format.numVertices) + " vertex lines in METIS " \
+        "graph, but found " + std::to_string(vertexStarts.back()) + ".");
+  }
+  if (edgeStarts.back() != format.numEdges) {
+    throw std::runtime_error("Expected " + \
+        std::to_string(format.numEdges / 2) + " edges in METIS graph, but " \
+        "found " + std::to_string(edgeStarts.back()) + "/2.");
+  }
+
+  // allocate the graph
+  sl::Array<adj_type> edgePrefix = \
+      MemoryPolicy::allocate<adj_type>(format.numVertices+1);
+  sl::Array<vtx_type> edgeList = \
+      MemoryPolicy::allocate<vtx_type>(format.numEdges);
+  sl::Array<wgt_type> vertexWeight;
+  if (format.hasVertexWeights) {
+    vertexWeight = MemoryPolicy::allocate<wgt_type>(format.numVertices);
+  }
+  sl::Array<wgt_type> edgeWeight;
+  if (format.hasEdgeWeights) {
+    edgeWeight = MemoryPolicy::allocate<wgt_type>(format.numEdges);
+  }
+  edgePrefix[0] = 0;
+
+  // second pass: parse each chunk in to its slice of the arrays
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (int i = 0; i < numChunks; ++i) {
+    parseChunk(format, vertexStarts[i], edgeStarts[i], &chunks[i], \
+        edgePrefix.data(), edgeList.data(), \
+        format.hasVertexWeights ? vertexWeight.data() : nullptr, \
+        format.hasEdgeWeights ? edgeWeight.data() : nullptr);
+  }
+  checkChunks(chunks);
+
+  return Graph(std::move(edgePrefix), std::move(edgeList), \
+      std::move(vertexWeight), std::move(edgeWeight));
+}
+
+
+}
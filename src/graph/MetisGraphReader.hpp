@@ -0,0 +1,81 @@
+/**
+* @file MetisGraphReader.hpp
+* @brief The MetisGraphReader class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_METISGRAPHREADER_HPP
+#define POROS_SRC_METISGRAPHREADER_HPP
+
+
+#include "Base.hpp"
+#include "graph/Graph.hpp"
+
+#include <string>
+
+
+namespace poros
+{
+
+/**
+* @brief Reads graphs in the METIS `.graph` format. The file is memory
+* mapped and split into line aligned chunks, which are parsed in parallel
+* (when built with OpenMP) directly into the arrays of the graph.
+*
+* Vertex sizes are accepted but discarded, and only a single vertex weight
+* per vertex (ncon of 1) is supported.
+*/
+class MetisGraphReader
+{
+  public:
+    /**
+    * @brief Create a new reader.
+    *
+    * @param filename The name of the file to read.
+    */
+    MetisGraphReader(
+        std::string const & filename);
+
+
+    /**
+    * @brief Read the graph.
+    *
+    * @return The graph.
+    *
+    * @throws std::runtime_error If the file cannot be read or is not a valid
+    * METIS graph.
+    */
+    Graph read();
+
+  private:
+    std::string m_filename;
+
+};
+
+
+}
+
+
+#endif
@@ -28,6 +28,7 @@
 
 
 #include "OneStepGraphBuilder.hpp"
+#include "util/MemoryPolicy.hpp"
 #include "solidutils/Debug.hpp"
 
 #include <algorithm>
@@ -47,13 +48,18 @@ OneStepGraphBuilder::OneStepGraphBuilder(
   m_numVertices(0),
   m_numEdges(1), // implicit self loop
   m_edgePrefix(numVertices+1),
-  m_edgeList(maxNumEdges+1), // last slot used for self loops
+  // last slot used for self loops
+  m_edgeList(MemoryPolicy::allocate<vtx_type>(maxNumEdges+1)),
   m_vertexWeight(numVertices),
-  m_edgeWeight(maxNumEdges+1), // last slot used for self loops
+  // last slot used for self loops
+  m_edgeWeight(MemoryPolicy::allocate<wgt_type>(maxNumEdges+1)),
   m_totalVertexWeight(0),
   m_totalEdgeWeight(0),
   m_htable(numVertices+1, NULL_ADJ),
-  m_maxNumEdges(maxNumEdges)
+  m_maxNumEdges(maxNumEdges),
+  m_memory((numVertices+1)*(sizeof(adj_type) + sizeof(adj_type)) + \
+      numVertices*sizeof(wgt_type) + \
+      (maxNumEdges+1)*(sizeof(vtx_type) + sizeof(wgt_type)))
 {
   m_edgePrefix[0] = 0;
 
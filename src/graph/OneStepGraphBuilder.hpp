@@ -34,6 +34,7 @@
 
 #include "graph/GraphHandle.hpp"
 #include "Base.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/Array.hpp"
 
 #include <vector>
@@ -138,6 +139,8 @@ class OneStepGraphBuilder
 
     adj_type m_maxNumEdges;
 
+    TrackedMemory m_memory;
+
     // prevent copying
     OneStepGraphBuilder(
         OneStepGraphBuilder const & lhs) = delete;
@@ -0,0 +1,158 @@
+/**
+* @file RMatGraphGenerator.cpp
+* @brief Implementation of the RMatGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RMatGraphGenerator.hpp"
+#include "solidutils/Debug.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+enum {
+  EDGE_STREAM,
+  SCRAMBLE_STREAM
+};
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+RMatGraphGenerator::RMatGraphGenerator(
+    unsigned int const scale,
+    unsigned int const edgeFactor,
+    unsigned int const seed) :
+  RandomGraphGenerator(seed),
+  m_scale(scale),
+  m_edgeFactor(edgeFactor),
+  m_a(0.57),
+  m_b(0.19),
+  m_c(0.19)
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void RMatGraphGenerator::setProbabilities(
+    double const a,
+    double const b,
+    double const c)
+{
+  ASSERT_GREATEREQUAL(a, 0.0);
+  ASSERT_GREATEREQUAL(b, 0.0);
+  ASSERT_GREATEREQUAL(c, 0.0);
+  ASSERT_LESSEQUAL(a + b + c, 1.0);
+
+  m_a = a;
+  m_b = b;
+  m_c = c;
+}
+
+
+Graph RMatGraphGenerator::generate()
+{
+  if (m_scale >= static_cast<unsigned int>( \
+      std::numeric_limits<vtx_type>::digits)) {
+    throw std::runtime_error("Too many vertices for vtx_type: 2^" + \
+        std::to_string(m_scale));
+  }
+
+  vtx_type const numVertices = static_cast<vtx_type>(1) << m_scale;
+  size_t const numEdges = static_cast<size_t>(numVertices) * m_edgeFactor;
+  vtx_type const mask = numVertices - 1;
+
+  // scramble vertex numbers with a bijection on [0, 2^scale): multiplying by
+  // an odd number and xor-ing with a right shift are both invertible modulo
+  // a power of two
+  vtx_type const multiplier = static_cast<vtx_type>( \
+      random(SCRAMBLE_STREAM, 0)) | 1;
+  vtx_type const offset = static_cast<vtx_type>(random(SCRAMBLE_STREAM, 1));
+  unsigned int const shift = (m_scale / 2) + 1;
+  auto scramble = [=](vtx_type v) {
+    v = (v * multiplier + offset) & mask;
+    v ^= v >> shift;
+    return (v * multiplier) & mask;
+  };
+
+  double const ab = m_a + m_b;
+  double const aNorm = m_a / ab;
+  double const cNorm = m_c / (1.0 - ab);
+
+  std::vector<vtx_type> sources(numEdges);
+  std::vector<vtx_type> dests(numEdges);
+
+  // each level needs two draws, which are taken from the halves of one random
+  // number
+  double const halfScale = 1.0 / static_cast<double>(1ULL << 32);
+  uint64_t const halfMask = (1ULL << 32) - 1;
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (size_t i = 0; i < numEdges; ++i) {
+    uint64_t state = random(EDGE_STREAM, i);
+    vtx_type u = 0;
+    vtx_type v = 0;
+    for (unsigned int level = 0; level < m_scale; ++level) {
+      // choose the half of the rows, and then the half of the columns given
+      // the rows
+      uint64_t const rand = nextRandom(&state);
+      bool const bottom = (rand >> 32) * halfScale >= ab;
+      bool const right = (rand & halfMask) * halfScale >= \
+          (bottom ? cNorm : aNorm);
+      u = (u << 1) | static_cast<vtx_type>(bottom);
+      v = (v << 1) | static_cast<vtx_type>(right);
+    }
+    sources[i] = scramble(u);
+    dests[i] = scramble(v);
+  }
+
+  return build(numVertices, std::move(sources), std::move(dests));
+}
+
+
+}
@@ -0,0 +1,102 @@
+/**
+* @file RMatGraphGenerator.hpp
+* @brief The RMatGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_RMATGRAPHGENERATOR_HPP
+#define POROS_SRC_RMATGRAPHGENERATOR_HPP
+
+
+#include "graph/RandomGraphGenerator.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Generates R-MAT graphs (i.e., stochastic Kronecker graphs with a 2x2
+* initiator matrix), which have the skewed degree distributions of social and
+* web graphs. Each edge is placed by recursively choosing one of the four
+* quadrants of the adjacency matrix with probabilities a, b, c, and d. The
+* vertices are then scrambled, so that high degree vertices are not numbered
+* together.
+*/
+class RMatGraphGenerator : public RandomGraphGenerator
+{
+  public:
+    /**
+    * @brief Create a new R-MAT generator with the Graph 500 quadrant
+    * probabilities (0.57, 0.19, 0.19, 0.05).
+    *
+    * @param scale The base 2 logarithm of the number of vertices.
+    * @param edgeFactor The number of edges to generate per vertex (before
+    * duplicates and self loops are removed).
+    * @param seed The random seed.
+    */
+    RMatGraphGenerator(
+        unsigned int scale,
+        unsigned int edgeFactor,
+        unsigned int seed);
+
+
+    /**
+    * @brief Set the probabilities of the quadrants. The probability of the
+    * last quadrant is 1 - a - b - c.
+    *
+    * @param a The probability of the top left quadrant.
+    * @param b The probability of the top right quadrant.
+    * @param c The probability of the bottom left quadrant.
+    */
+    void setProbabilities(
+        double a,
+        double b,
+        double c);
+
+
+    /**
+    * @brief Generate the graph.
+    *
+    * @return The generated graph.
+    *
+    * @throws std::runtime_error If 2^scale vertices do not fit in vtx_type.
+    */
+    Graph generate() override;
+
+
+  private:
+    unsigned int m_scale;
+    unsigned int m_edgeFactor;
+    double m_a;
+    double m_b;
+    double m_c;
+
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,217 @@
+/**
+* @file RandomGraphGenerator.cpp
+* @brief Implementation of the RandomGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RandomGraphGenerator.hpp"
+#include "graph/EdgeListGraphBuilder.hpp"
+#include "solidutils/Debug.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+// the generators number their own streams from zero
+uint64_t const VERTEX_WEIGHT_STREAM = ~static_cast<uint64_t>(0);
+uint64_t const EDGE_WEIGHT_STREAM = VERTEX_WEIGHT_STREAM - 1;
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+/**
+* @brief The finalizer of the splitmix64 generator, which maps consecutive
+* integers to well distributed random numbers.
+*
+* @param x The number to mix.
+*
+* @return The mixed number.
+*/
+inline uint64_t mix(
+    uint64_t x) noexcept
+{
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+
+inline wgt_type randomWeight(
+    uint64_t const rand,
+    wgt_type const min,
+    wgt_type const max) noexcept
+{
+  return min + static_cast<wgt_type>(rand % (static_cast<uint64_t>(max - \
+      min) + 1));
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+RandomGraphGenerator::RandomGraphGenerator(
+    unsigned int const seed) :
+  m_seed(mix(seed)),
+  m_vertexWeightMin(1),
+  m_vertexWeightMax(1),
+  m_edgeWeightMin(1),
+  m_edgeWeightMax(1)
+{
+  // do nothing
+}
+
+
+RandomGraphGenerator::~RandomGraphGenerator()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void RandomGraphGenerator::setRandomVertexWeight(
+    wgt_type const min,
+    wgt_type const max)
+{
+  ASSERT_GREATER(min, 0);
+  ASSERT_LESSEQUAL(min, max);
+
+  m_vertexWeightMin = min;
+  m_vertexWeightMax = max;
+}
+
+
+void RandomGraphGenerator::setRandomEdgeWeight(
+    wgt_type const min,
+    wgt_type const max)
+{
+  ASSERT_GREATER(min, 0);
+  ASSERT_LESSEQUAL(min, max);
+
+  m_edgeWeightMin = min;
+  m_edgeWeightMax = max;
+}
+
+
+/******************************************************************************
+* PROTECTED METHODS ***********************************************************
+******************************************************************************/
+
+uint64_t RandomGraphGenerator::random(
+    uint64_t const stream,
+    uint64_t const index) const noexcept
+{
+  return mix(mix(m_seed ^ mix(stream)) + index);
+}
+
+
+uint64_t RandomGraphGenerator::nextRandom(
+    uint64_t * const state) noexcept
+{
+  return mix((*state)++);
+}
+
+
+double RandomGraphGenerator::toReal(
+    uint64_t const rand) noexcept
+{
+  // use the top 53 bits to fill the mantissa
+  return static_cast<double>(rand >> 11) * \
+      (1.0 / static_cast<double>(1ULL << 53));
+}
+
+
+double RandomGraphGenerator::randomReal(
+    uint64_t const stream,
+    uint64_t const index) const noexcept
+{
+  return toReal(random(stream, index));
+}
+
+
+Graph RandomGraphGenerator::build(
+    vtx_type const numVertices,
+    std::vector<vtx_type> && sources,
+    std::vector<vtx_type> && dests) const
+{
+  ASSERT_EQUAL(sources.size(), dests.size());
+
+  size_t const numEdges = sources.size();
+  std::vector<wgt_type> weights(numEdges, 1);
+  if (m_edgeWeightMin != 1 || m_edgeWeightMax != 1) {
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (size_t i = 0; i < numEdges; ++i) {
+      weights[i] = randomWeight(random(EDGE_WEIGHT_STREAM, i), \
+          m_edgeWeightMin, m_edgeWeightMax);
+    }
+  }
+
+  EdgeListGraphBuilder builder(numVertices);
+
+  // keep duplicate edges at the weight of a single edge
+  builder.setMergeType(EdgeListGraphBuilder::MERGE_MAX);
+
+  if (numVertices > 0 && \
+      (m_vertexWeightMin != 1 || m_vertexWeightMax != 1)) {
+    // the first weight allocates the array
+    builder.setVertexWeight(0, randomWeight(random(VERTEX_WEIGHT_STREAM, 0), \
+        m_vertexWeightMin, m_vertexWeightMax));
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (vtx_type v = 1; v < numVertices; ++v) {
+      builder.setVertexWeight(v, randomWeight(random(VERTEX_WEIGHT_STREAM, \
+          v), m_vertexWeightMin, m_vertexWeightMax));
+    }
+  }
+
+  builder.addEdges(std::move(sources), std::move(dests), std::move(weights));
+
+  Graph graph = builder.finish();
+  ASSERT_TRUE(graph.isValid());
+
+  return graph;
+}
+
+
+}
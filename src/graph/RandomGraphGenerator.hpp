@@ -0,0 +1,184 @@
+/**
+* @file RandomGraphGenerator.hpp
+* @brief The RandomGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_RANDOMGRAPHGENERATOR_HPP
+#define POROS_SRC_RANDOMGRAPHGENERATOR_HPP
+
+
+#include "Base.hpp"
+#include "graph/Graph.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace poros
+{
+
+/**
+* @brief The base class of the seeded synthetic graph generators. Random
+* numbers are derived by hashing the seed with the index of what they are
+* for (e.g., an edge or a vertex), so that generators can fill their edges in
+* parallel and still produce the same graph for the same seed regardless of
+* the number of threads.
+*/
+class RandomGraphGenerator
+{
+  public:
+    /**
+    * @brief Create a new generator.
+    *
+    * @param seed The random seed.
+    */
+    RandomGraphGenerator(
+        unsigned int seed);
+
+
+    /**
+    * @brief Virtual destructor.
+    */
+    virtual ~RandomGraphGenerator();
+
+
+    /**
+    * @brief Set the random parameters of the vertex weights.
+    *
+    * @param min The minimum vertex weight (must be greater than 0).
+    * @param max The maximum vertex weight.
+    */
+    void setRandomVertexWeight(
+        wgt_type min,
+        wgt_type max);
+
+
+    /**
+    * @brief Set the random parameters of the edge weights.
+    *
+    * @param min The minimum edge weight (must be greater than 0).
+    * @param max The maximum edge weight.
+    */
+    void setRandomEdgeWeight(
+        wgt_type min,
+        wgt_type max);
+
+
+    /**
+    * @brief Generate the graph.
+    *
+    * @return The generated graph.
+    *
+    * @throws std::runtime_error If the graph is too large for vtx_type or
+    * adj_type.
+    */
+    virtual Graph generate() = 0;
+
+
+  protected:
+    /**
+    * @brief Get a random number.
+    *
+    * @param stream The stream of random numbers (i.e., what they are used
+    * for).
+    * @param index The index of the number in the stream.
+    *
+    * @return The random number.
+    */
+    uint64_t random(
+        uint64_t stream,
+        uint64_t index) const noexcept;
+
+
+    /**
+    * @brief Get the next random number of a sequence, which is cheaper than
+    * calling random() for each number when many are needed for the same
+    * index.
+    *
+    * @param state The state of the sequence, which should be initialized
+    * with random().
+    *
+    * @return The random number.
+    */
+    static uint64_t nextRandom(
+        uint64_t * state) noexcept;
+
+
+    /**
+    * @brief Convert a random number to a real number in the range [0, 1).
+    *
+    * @param rand The random number.
+    *
+    * @return The real number.
+    */
+    static double toReal(
+        uint64_t rand) noexcept;
+
+
+    /**
+    * @brief Get a random number in the range [0, 1).
+    *
+    * @param stream The stream of random numbers.
+    * @param index The index of the number in the stream.
+    *
+    * @return The random number.
+    */
+    double randomReal(
+        uint64_t stream,
+        uint64_t index) const noexcept;
+
+
+    /**
+    * @brief Build the graph from a list of edges, assigning the random vertex
+    * and edge weights. Edges may be given in either direction and more than
+    * once (the heaviest copy is kept), and self loops are dropped.
+    *
+    * @param numVertices The number of vertices.
+    * @param sources The vertex at one end of each edge.
+    * @param dests The vertex at the other end of each edge.
+    *
+    * @return The graph.
+    */
+    Graph build(
+        vtx_type numVertices,
+        std::vector<vtx_type> && sources,
+        std::vector<vtx_type> && dests) const;
+
+
+  private:
+    uint64_t m_seed;
+    wgt_type m_vertexWeightMin;
+    wgt_type m_vertexWeightMax;
+    wgt_type m_edgeWeightMin;
+    wgt_type m_edgeWeightMax;
+
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,160 @@
+/**
+* @file StochasticBlockGraphGenerator.cpp
+* @brief Implementation of the StochasticBlockGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "StochasticBlockGraphGenerator.hpp"
+#include "solidutils/Array.hpp"
+#include "solidutils/Debug.hpp"
+#include "solidutils/VectorMath.hpp"
+
+#include <cmath>
+#include <vector>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+StochasticBlockGraphGenerator::StochasticBlockGraphGenerator(
+    vtx_type const numVertices,
+    vtx_type const numBlocks,
+    double const intraProbability,
+    double const interProbability,
+    unsigned int const seed) :
+  RandomGraphGenerator(seed),
+  m_numVertices(numVertices),
+  m_numBlocks(numBlocks),
+  m_intraProbability(intraProbability),
+  m_interProbability(interProbability)
+{
+  ASSERT_GREATER(numBlocks, 0);
+  ASSERT_LESSEQUAL(numBlocks, std::max(numVertices, \
+      static_cast<vtx_type>(1)));
+  ASSERT_GREATEREQUAL(intraProbability, 0.0);
+  ASSERT_LESSEQUAL(intraProbability, 1.0);
+  ASSERT_GREATEREQUAL(interProbability, 0.0);
+  ASSERT_LESSEQUAL(interProbability, 1.0);
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+vtx_type StochasticBlockGraphGenerator::blockOf(
+    vtx_type const vertex) const noexcept
+{
+  return static_cast<vtx_type>((static_cast<uint64_t>(vertex) * \
+      m_numBlocks) / m_numVertices);
+}
+
+
+Graph StochasticBlockGraphGenerator::generate()
+{
+  vtx_type const numVertices = m_numVertices;
+
+  // count and then record the edges of each vertex to higher numbered
+  // vertices
+  sl::Array<size_t> edgePrefix(numVertices+1);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 64)
+  #endif
+  for (vtx_type v = 0; v < numVertices; ++v) {
+    size_t count = 0;
+    forEachNeighbor(v, [&count](vtx_type) {
+      ++count;
+    });
+    edgePrefix[v] = count;
+  }
+  edgePrefix[numVertices] = 0;
+  sl::VectorMath::prefixSumExclusive(edgePrefix.begin(), edgePrefix.end());
+
+  std::vector<vtx_type> sources(edgePrefix[numVertices]);
+  std::vector<vtx_type> dests(edgePrefix[numVertices]);
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 64)
+  #endif
+  for (vtx_type v = 0; v < numVertices; ++v) {
+    size_t edge = edgePrefix[v];
+    forEachNeighbor(v, [&](vtx_type const u) {
+      sources[edge] = v;
+      dests[edge] = u;
+      ++edge;
+    });
+  }
+
+  return build(numVertices, std::move(sources), std::move(dests));
+}
+
+
+/******************************************************************************
+* PRIVATE METHODS *************************************************************
+******************************************************************************/
+
+template<typename F>
+void StochasticBlockGraphGenerator::forEachNeighbor(
+    vtx_type const vertex,
+    F visit) const
+{
+  // the first vertex of the next block
+  vtx_type const block = blockOf(vertex);
+  vtx_type const blockEnd = static_cast<vtx_type>( \
+      ((static_cast<uint64_t>(block+1) * m_numVertices) + m_numBlocks - 1) / \
+      m_numBlocks);
+
+  uint64_t state = random(vertex, 0);
+  auto visitRange = [&](vtx_type const start, vtx_type const end, \
+      double const probability) {
+    if (probability <= 0.0) {
+      return;
+    }
+    double const logMiss = std::log1p(-probability);
+    uint64_t u = start;
+    while (true) {
+      if (probability < 1.0) {
+        // skip the pairs which are not connected
+        u += static_cast<uint64_t>(std::floor(std::log1p( \
+            -toReal(nextRandom(&state))) / logMiss));
+      }
+      if (u >= end) {
+        break;
+      }
+      visit(static_cast<vtx_type>(u));
+      ++u;
+    }
+  };
+
+  visitRange(vertex+1, blockEnd, m_intraProbability);
+  visitRange(blockEnd, m_numVertices, m_interProbability);
+}
+
+
+}
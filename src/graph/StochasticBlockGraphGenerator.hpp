@@ -0,0 +1,114 @@
+/**
+* @file StochasticBlockGraphGenerator.hpp
+* @brief The StochasticBlockGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_STOCHASTICBLOCKGRAPHGENERATOR_HPP
+#define POROS_SRC_STOCHASTICBLOCKGRAPHGENERATOR_HPP
+
+
+#include "graph/RandomGraphGenerator.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Generates stochastic block model graphs, where the vertices are split
+* into equal sized blocks of consecutive vertices, and each pair of vertices
+* is connected with one probability if they are in the same block and
+* another if they are not. The pairs that are connected are found by drawing
+* the geometrically distributed gaps between them, so the work is
+* proportional to the number of edges rather than the number of pairs.
+*/
+class StochasticBlockGraphGenerator : public RandomGraphGenerator
+{
+  public:
+    /**
+    * @brief Create a new stochastic block model generator.
+    *
+    * @param numVertices The number of vertices.
+    * @param numBlocks The number of blocks.
+    * @param intraProbability The probability of an edge between two vertices
+    * in the same block.
+    * @param interProbability The probability of an edge between two vertices
+    * in different blocks.
+    * @param seed The random seed.
+    */
+    StochasticBlockGraphGenerator(
+        vtx_type numVertices,
+        vtx_type numBlocks,
+        double intraProbability,
+        double interProbability,
+        unsigned int seed);
+
+
+    /**
+    * @brief Get the block of a vertex.
+    *
+    * @param vertex The vertex.
+    *
+    * @return The block.
+    */
+    vtx_type blockOf(
+        vtx_type vertex) const noexcept;
+
+
+    /**
+    * @brief Generate the graph.
+    *
+    * @return The generated graph.
+    *
+    * @throws std::runtime_error If the graph has too many edges for adj_type.
+    */
+    Graph generate() override;
+
+
+  private:
+    vtx_type m_numVertices;
+    vtx_type m_numBlocks;
+    double m_intraProbability;
+    double m_interProbability;
+
+    /**
+    * @brief Visit the neighbors of a vertex with a higher number.
+    *
+    * @tparam F The type of function to call.
+    * @param vertex The vertex.
+    * @param visit The function to call with each neighbor.
+    */
+    template<typename F>
+    void forEachNeighbor(
+        vtx_type vertex,
+        F visit) const;
+
+};
+
+
+}
+
+
+#endif
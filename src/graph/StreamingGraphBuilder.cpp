@@ -0,0 +1,141 @@
+/**
+* @file StreamingGraphBuilder.cpp
+* @brief Implementation of the StreamingGraphBuilder class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "StreamingGraphBuilder.hpp"
+
+#include "util/MemoryPolicy.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+StreamingGraphBuilder::StreamingGraphBuilder(
+    vtx_type const numVertices,
+    adj_type const numEdges,
+    bool const hasVertexWeights,
+    bool const hasEdgeWeights) :
+  m_numVertices(numVertices),
+  m_numEdges(numEdges),
+  m_numAddedVertices(0),
+  m_edgePrefix(MemoryPolicy::allocate<adj_type>(numVertices+1)),
+  m_edgeList(MemoryPolicy::allocate<vtx_type>(numEdges)),
+  m_vertexWeight(hasVertexWeights ? \
+      MemoryPolicy::allocate<wgt_type>(numVertices) : sl::Array<wgt_type>()),
+  m_edgeWeight(hasEdgeWeights ? \
+      MemoryPolicy::allocate<wgt_type>(numEdges) : sl::Array<wgt_type>())
+{
+  m_edgePrefix[0] = 0;
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void StreamingGraphBuilder::addVertices(
+    vtx_type const numVertices,
+    adj_type const * const edgePrefix,
+    vtx_type const * const edgeList,
+    wgt_type const * const vertexWeight,
+    wgt_type const * const edgeWeight)
+{
+  vtx_type const start = m_numAddedVertices;
+  adj_type const edgeStart = m_edgePrefix[start];
+
+  if (numVertices > m_numVertices - start) {
+    throw std::runtime_error("Block of " + std::to_string(numVertices) + \
+        " vertices would exceed the " + std::to_string(m_numVertices) + \
+        " vertices of the graph.");
+  } else if (edgePrefix[0] != 0 || \
+      edgePrefix[numVertices] > m_numEdges - edgeStart) {
+    throw std::runtime_error("Block of " + \
+        std::to_string(edgePrefix[numVertices]) + " edges would exceed the " + \
+        std::to_string(m_numEdges) + " edges of the graph.");
+  } else if ((vertexWeight != nullptr) != (m_vertexWeight.size() > 0) || \
+      (edgeWeight != nullptr) != (m_edgeWeight.size() > 0)) {
+    throw std::runtime_error("Block weights do not match those of the " \
+        "graph.");
+  }
+
+  for (vtx_type v = 0; v < numVertices; ++v) {
+    if (edgePrefix[v+1] < edgePrefix[v]) {
+      throw std::runtime_error("Block edge prefix is not increasing.");
+    }
+  }
+
+  adj_type const numEdges = edgePrefix[numVertices];
+  for (adj_type j = 0; j < numEdges; ++j) {
+    if (edgeList[j] >= m_numVertices) {
+      throw std::runtime_error("Invalid neighbor " + \
+          std::to_string(edgeList[j]) + " in block.");
+    }
+  }
+
+  for (vtx_type v = 0; v < numVertices; ++v) {
+    m_edgePrefix[start+v+1] = edgeStart + edgePrefix[v+1];
+  }
+  std::copy(edgeList, edgeList+numEdges, m_edgeList.data()+edgeStart);
+  if (vertexWeight) {
+    std::copy(vertexWeight, vertexWeight+numVertices, \
+        m_vertexWeight.data()+start);
+  }
+  if (edgeWeight) {
+    std::copy(edgeWeight, edgeWeight+numEdges, m_edgeWeight.data()+edgeStart);
+  }
+
+  m_numAddedVertices += numVertices;
+}
+
+
+Graph StreamingGraphBuilder::finish()
+{
+  if (m_numAddedVertices != m_numVertices || \
+      m_edgePrefix[m_numVertices] != m_numEdges) {
+    throw std::runtime_error("Only " + std::to_string(m_numAddedVertices) + \
+        " of " + std::to_string(m_numVertices) + " vertices and " + \
+        std::to_string(m_edgePrefix[m_numAddedVertices]) + " of " + \
+        std::to_string(m_numEdges) + " edges have been added.");
+  }
+
+  m_numAddedVertices = 0;
+
+  return Graph(std::move(m_edgePrefix), std::move(m_edgeList), \
+      std::move(m_vertexWeight), std::move(m_edgeWeight));
+}
+
+
+}
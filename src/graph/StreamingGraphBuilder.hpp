@@ -0,0 +1,158 @@
+/**
+* @file StreamingGraphBuilder.hpp
+* @brief The StreamingGraphBuilder class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_STREAMINGGRAPHBUILDER_HPP
+#define POROS_SRC_STREAMINGGRAPHBUILDER_HPP
+
+
+#include "Base.hpp"
+#include "graph/Graph.hpp"
+#include "solidutils/Array.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Assembles a graph from consecutive blocks of vertices, each given as
+* a local edge prefix, adjacency list, and weights, so that the caller never
+* needs to hold the whole graph. The arrays of the graph are allocated at
+* their final size up front, and each block is copied directly into them.
+*/
+class StreamingGraphBuilder
+{
+  public:
+    /**
+    * @brief Create a new streaming graph builder.
+    *
+    * @param numVertices The number of vertices in the graph.
+    * @param numEdges The number of edges in the graph (counted in each
+    * direction).
+    * @param hasVertexWeights Whether vertex weights will be given.
+    * @param hasEdgeWeights Whether edge weights will be given.
+    */
+    StreamingGraphBuilder(
+        vtx_type numVertices,
+        adj_type numEdges,
+        bool hasVertexWeights,
+        bool hasEdgeWeights);
+
+
+    /**
+    * @brief Add the next block of vertices.
+    *
+    * @param numVertices The number of vertices in the block.
+    * @param edgePrefix The prefix sum of the number of edges of each vertex
+    * in the block (of length numVertices+1 and starting at 0).
+    * @param edgeList The neighbors of each vertex in the block.
+    * @param vertexWeight The weight of each vertex in the block (must be null
+    * if the graph has no vertex weights).
+    * @param edgeWeight The weight of each edge in the block (must be null if
+    * the graph has no edge weights).
+    *
+    * @throws std::runtime_error If the block does not fit in the graph, or
+    * has neighbors which are not in the graph.
+    */
+    void addVertices(
+        vtx_type numVertices,
+        adj_type const * edgePrefix,
+        vtx_type const * edgeList,
+        wgt_type const * vertexWeight,
+        wgt_type const * edgeWeight);
+
+
+    /**
+    * @brief Get the number of vertices added so far.
+    *
+    * @return The number of vertices.
+    */
+    vtx_type numAddedVertices() const noexcept
+    {
+      return m_numAddedVertices;
+    }
+
+
+    /**
+    * @brief Get the edge prefix of the vertices added so far.
+    *
+    * @return The edge prefix (valid up to numAddedVertices()+1).
+    */
+    adj_type const * getEdgePrefix() const noexcept
+    {
+      return m_edgePrefix.data();
+    }
+
+
+    /**
+    * @brief Get the edge list of the vertices added so far.
+    *
+    * @return The edge list.
+    */
+    vtx_type const * getEdgeList() const noexcept
+    {
+      return m_edgeList.data();
+    }
+
+
+    /**
+    * @brief Get the edge weights of the vertices added so far.
+    *
+    * @return The edge weights, or null if there are none.
+    */
+    wgt_type const * getEdgeWeight() const noexcept
+    {
+      return m_edgeWeight.size() > 0 ? m_edgeWeight.data() : nullptr;
+    }
+
+
+    /**
+    * @brief Build the graph. The builder cannot be used afterwards.
+    *
+    * @return The graph.
+    *
+    * @throws std::runtime_error If not all of the vertices and edges have
+    * been added.
+    */
+    Graph finish();
+
+
+  private:
+    vtx_type m_numVertices;
+    adj_type m_numEdges;
+    vtx_type m_numAddedVertices;
+    sl::Array<adj_type> m_edgePrefix;
+    sl::Array<vtx_type> m_edgeList;
+    sl::Array<wgt_type> m_vertexWeight;
+    sl::Array<wgt_type> m_edgeWeight;
+};
+
+
+}
+
+
+#endif
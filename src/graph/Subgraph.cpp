@@ -43,7 +43,8 @@ Subgraph::Subgraph(
     GraphHandle graph,
     sl::Array<vtx_type> superMap) :
   m_superMap(std::move(superMap)),
-  m_graph(graph)
+  m_graph(graph),
+  m_memory(m_graph->getMemoryUsage() + m_superMap.size()*sizeof(vtx_type))
 {
   // do nothing
 }
@@ -52,7 +53,8 @@ Subgraph::Subgraph(
 Subgraph::Subgraph(
     GraphHandle graph) :
   m_superMap(graph->numVertices()),
-  m_graph(graph)
+  m_graph(graph),
+  m_memory(m_graph->getMemoryUsage() + m_superMap.size()*sizeof(vtx_type))
 {
   sl::VectorMath::increment(m_superMap.data(), m_superMap.size());
 }
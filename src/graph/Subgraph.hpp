@@ -35,6 +35,7 @@
 #include "graph/GraphHandle.hpp"
 #include "partition/Partitioning.hpp"
 #include "graph/IMappedGraph.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/Array.hpp"
 
 
@@ -115,6 +116,7 @@ class Subgraph :
   private:
     sl::Array<vtx_type> m_superMap;
     GraphHandle m_graph;
+    TrackedMemory m_memory;
 };
 
 
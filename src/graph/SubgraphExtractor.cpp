@@ -90,6 +90,33 @@ void fillEdges(
   }
 }
 
+
+template<bool HAS_EDGE_WEIGHTS>
+void fillPartitionEdges(
+    Graph const * const graph,
+    Partitioning const * const part,
+    pid_type const pid,
+    vtx_type const * const subMap,
+    TwoStepGraphBuilder * const builder)
+{
+  for (Vertex const vertex : graph->vertices()) {
+    if (part->getAssignment(vertex) == pid) {
+      vtx_type const subV = subMap[vertex.index];
+
+      for (Edge const edge : graph->edgesOf(vertex)) {
+        Vertex const u = graph->destinationOf(edge);
+
+        // this edge will exist in the subgraph
+        if (part->getAssignment(u) == pid) {
+          vtx_type const subU = subMap[u.index];
+          wgt_type const weight = graph->weightOf<HAS_EDGE_WEIGHTS>(edge);
+          builder->addEdgeToVertex(subV, subU, weight);
+        }
+      }
+    }
+  }
+}
+
 }
 
 /******************************************************************************
@@ -191,6 +218,66 @@ std::vector<Subgraph> SubgraphExtractor::partitions(
 }
 
 
+Subgraph SubgraphExtractor::partition(
+    Graph const * const graph,
+    Partitioning const * const part,
+    pid_type const pid,
+    vtx_type const * const labels)
+{
+  vtx_type const numVertices = graph->numVertices();
+
+  // number the vertices of the partition
+  sl::Array<vtx_type> subMap(numVertices);
+  vtx_type numSubVertices = 0;
+  for (Vertex const v : graph->vertices()) {
+    if (part->getAssignment(v) == pid) {
+      subMap[v.index] = numSubVertices++;
+    }
+  }
+
+  TwoStepGraphBuilder builder;
+  builder.setNumVertices(numSubVertices);
+  builder.setUnitEdgeWeight(graph->hasUnitEdgeWeight());
+  builder.setUnitVertexWeight(graph->hasUnitVertexWeight());
+  builder.beginVertexPhase();
+
+  // populate super-map, vertex weights, and number of edges
+  sl::Array<vtx_type> superMap(numSubVertices);
+  for (Vertex const vertex : graph->vertices()) {
+    if (part->getAssignment(vertex) == pid) {
+      vtx_type const subV = subMap[vertex.index];
+
+      if (labels) {
+        superMap[subV] = labels[vertex.index];
+      } else {
+        superMap[subV] = vertex.index;
+      }
+
+      if (!graph->hasUnitVertexWeight()) {
+        builder.setVertexWeight(subV, graph->weightOf<true>(vertex));
+      }
+
+      for (Edge const edge : graph->edgesOf(vertex)) {
+        if (part->getAssignment(graph->destinationOf(edge)) == pid) {
+          builder.incVertexNumEdges(subV);
+        }
+      }
+    }
+  }
+
+  builder.beginEdgePhase();
+
+  // fill edges
+  if (graph->hasUnitEdgeWeight()) {
+    fillPartitionEdges<false>(graph, part, pid, subMap.data(), &builder);
+  } else {
+    fillPartitionEdges<true>(graph, part, pid, subMap.data(), &builder);
+  }
+
+  return Subgraph(builder.finish(), std::move(superMap));
+}
+
+
 
 
 }
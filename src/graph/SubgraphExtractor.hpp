@@ -57,6 +57,26 @@ class SubgraphExtractor
         Graph const * graph,
         Partitioning const * part,
         vtx_type const * const labels = nullptr);
+
+    /**
+    * @brief Extract the subgraph formed by a single partition. Extracting the
+    * partitions one at a time requires more passes over the graph than
+    * extracting them all at once, but only one subgraph needs to be held in
+    * memory at a time.
+    *
+    * @param graph The graph.
+    * @param part The partitioning.
+    * @param pid The partition to extract.
+    * @param labels The labels of the vertices in the graph (may be null if
+    * they are not aliased).
+    *
+    * @return The subgraph.
+    */
+    static Subgraph partition(
+        Graph const * graph,
+        Partitioning const * part,
+        pid_type pid,
+        vtx_type const * const labels = nullptr);
 };
 
 
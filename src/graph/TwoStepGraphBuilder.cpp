@@ -28,6 +28,7 @@
 
 
 #include "TwoStepGraphBuilder.hpp"
+#include "util/MemoryPolicy.hpp"
 #include "solidutils/VectorMath.hpp"
 
 
@@ -49,7 +50,8 @@ TwoStepGraphBuilder::TwoStepGraphBuilder() :
   m_edgePrefix(0),
   m_edgeList(0),
   m_vertexWeight(0),
-  m_edgeWeight(0)
+  m_edgeWeight(0),
+  m_memory()
 {
   // do nothing
 }
@@ -89,10 +91,13 @@ void TwoStepGraphBuilder::beginVertexPhase()
   m_phase = PHASE_VERTICES;
   
   // allocate vertex arrays
-  m_edgePrefix = sl::Array<adj_type>(m_numVertices+1, 0);
+  m_edgePrefix = MemoryPolicy::allocate<adj_type>(m_numVertices+1, 0);
   if (!m_unitVertexWeight) {
     m_vertexWeight = sl::Array<wgt_type>(m_numVertices);
   }
+
+  m_memory.add(m_edgePrefix.size()*sizeof(adj_type) + \
+      m_vertexWeight.size()*sizeof(wgt_type));
 }
 
 
@@ -111,11 +116,14 @@ void TwoStepGraphBuilder::beginEdgePhase()
   }
 
   // allocate edge arrays
-  m_edgeList = sl::Array<vtx_type>(m_numEdges);
+  m_edgeList = MemoryPolicy::allocate<vtx_type>(m_numEdges);
 
   if (!m_unitEdgeWeight) {
-    m_edgeWeight = sl::Array<wgt_type>(m_numEdges);
+    m_edgeWeight = MemoryPolicy::allocate<wgt_type>(m_numEdges);
   }
+
+  m_memory.add(m_edgeList.size()*sizeof(vtx_type) + \
+      m_edgeWeight.size()*sizeof(wgt_type));
 }
 
 
@@ -130,6 +138,7 @@ GraphHandle TwoStepGraphBuilder::finish()
       std::move(m_edgeWeight));
 
   m_phase = PHASE_START;
+  m_memory = TrackedMemory();
 
   ASSERT_TRUE(handle->isValid());
 
@@ -34,6 +34,7 @@
 
 #include "Base.hpp"
 #include "graph/GraphHandle.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/Array.hpp"
 
 
@@ -191,6 +192,7 @@ class TwoStepGraphBuilder
     sl::Array<vtx_type> m_edgeList;
     sl::Array<wgt_type> m_vertexWeight;
     sl::Array<wgt_type> m_edgeWeight;
+    TrackedMemory m_memory;
 
     // prevent copying
     TwoStepGraphBuilder(
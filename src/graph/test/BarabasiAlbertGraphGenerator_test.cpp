@@ -0,0 +1,75 @@
+/**
+* @file BarabasiAlbertGraphGenerator_test.cpp
+* @brief Unit tests for the BarabasiAlbertGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/BarabasiAlbertGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <algorithm>
+
+
+namespace poros
+{
+
+
+UNITTEST(BarabasiAlbertGraphGenerator, PowerLaw)
+{
+  BarabasiAlbertGraphGenerator gen(10000, 4, 0);
+  Graph graph = gen.generate();
+
+  testEqual(graph.numVertices(), static_cast<vtx_type>(10000));
+  testLessOrEqual(graph.numEdges(), static_cast<adj_type>(2*10000*4));
+  testGreater(graph.numEdges(), static_cast<adj_type>(2*10000*3));
+
+  // early vertices collect most of the edges
+  vtx_type maxDegree = 0;
+  vtx_type minDegree = graph.numVertices();
+  for (Vertex const v : graph.vertices()) {
+    maxDegree = std::max(maxDegree, graph.degreeOf(v));
+    minDegree = std::min(minDegree, graph.degreeOf(v));
+  }
+  testGreater(maxDegree, static_cast<vtx_type>(100));
+  testGreater(minDegree, static_cast<vtx_type>(0));
+}
+
+
+UNITTEST(BarabasiAlbertGraphGenerator, Seeded)
+{
+  BarabasiAlbertGraphGenerator gen1(2000, 3, 11);
+  Graph graph1 = gen1.generate();
+
+  BarabasiAlbertGraphGenerator gen2(2000, 3, 11);
+  Graph graph2 = gen2.generate();
+
+  testEqual(graph1.numEdges(), graph2.numEdges());
+  for (adj_type e = 0; e < graph1.numEdges(); ++e) {
+    testEqual(graph1.getEdgeList()[e], graph2.getEdgeList()[e]);
+  }
+}
+
+
+}
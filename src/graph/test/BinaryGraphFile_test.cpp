@@ -0,0 +1,191 @@
+/**
+* @file BinaryGraphFile_test.cpp
+* @brief Unit tests for the BinaryGraphFile class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-22
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/BinaryGraphFile.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+
+namespace poros
+{
+
+namespace
+{
+
+void testGraphsEqual(
+    Graph const * const expected,
+    Graph const * const actual)
+{
+  testEqual(actual->numVertices(), expected->numVertices());
+  testEqual(actual->numEdges(), expected->numEdges());
+  testEqual(actual->hasUnitVertexWeight(), expected->hasUnitVertexWeight());
+  testEqual(actual->hasUnitEdgeWeight(), expected->hasUnitEdgeWeight());
+  testEqual(actual->getTotalVertexWeight(), \
+      expected->getTotalVertexWeight());
+  testEqual(actual->getTotalEdgeWeight(), expected->getTotalEdgeWeight());
+
+  for (Vertex const v : expected->vertices()) {
+    testEqual(actual->getEdgePrefix()[v.index+1], \
+        expected->getEdgePrefix()[v.index+1]);
+    if (!expected->hasUnitVertexWeight()) {
+      testEqual(actual->weightOf<true>(v), expected->weightOf<true>(v));
+    }
+  }
+  for (adj_type e = 0; e < expected->numEdges(); ++e) {
+    testEqual(actual->getEdgeList()[e], expected->getEdgeList()[e]);
+  }
+}
+
+
+bool loadFails(
+    std::string const & filename,
+    bool const checked = false)
+{
+  try {
+    BinaryGraphFile::load(filename, checked);
+  } catch (std::runtime_error const &) {
+    return true;
+  }
+  return false;
+}
+
+}
+
+
+UNITTEST(BinaryGraphFile, RoundTripUnit)
+{
+  GridGraphGenerator gen(5, 4, 3);
+  Graph expected = gen.generate();
+
+  std::string const filename("BinaryGraphFile_unit.bin");
+  BinaryGraphFile::write(&expected, filename);
+
+  {
+    Graph const actual = BinaryGraphFile::load(filename);
+    testTrue(actual.getVertexWeight() == nullptr || \
+        actual.hasUnitVertexWeight());
+    testGraphsEqual(&expected, &actual);
+  }
+
+  std::remove(filename.c_str());
+}
+
+
+UNITTEST(BinaryGraphFile, RoundTripWeighted)
+{
+  GridGraphGenerator gen(7, 5, 2);
+  gen.setRandomVertexWeight(1, 5);
+  gen.setRandomEdgeWeight(1, 9);
+  Graph expected = gen.generate();
+
+  std::string const filename("BinaryGraphFile_weighted.bin");
+  BinaryGraphFile::write(&expected, filename);
+
+  {
+    Graph const actual = BinaryGraphFile::load(filename);
+    testGraphsEqual(&expected, &actual);
+    for (adj_type e = 0; e < expected.numEdges(); ++e) {
+      testEqual(actual.getEdgeWeight()[e], expected.getEdgeWeight()[e]);
+    }
+  }
+
+  std::remove(filename.c_str());
+}
+
+
+UNITTEST(BinaryGraphFile, LoadInvalid)
+{
+  GridGraphGenerator gen(5, 4, 3);
+  Graph graph = gen.generate();
+
+  std::string const filename("BinaryGraphFile_invalid.bin");
+  BinaryGraphFile::write(&graph, filename);
+
+  // truncate the file
+  std::string contents;
+  {
+    std::ifstream stream(filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(stream), \
+        std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    stream.write(contents.data(), contents.size()/2);
+  }
+  testTrue(loadFails(filename));
+
+  // the edge prefix starts after the 64 byte header, and the edge list at the
+  // next 64 byte boundary after it
+  size_t const prefixOffset = 64;
+  size_t const listOffset = ((prefixOffset + \
+      (graph.numVertices()+1)*sizeof(adj_type) + 63) / 64) * 64;
+
+  // a decreasing edge prefix
+  {
+    std::string corrupt = contents;
+    adj_type const prefix = graph.getEdgePrefix()[2] + 1;
+    corrupt.replace(prefixOffset + sizeof(adj_type), sizeof(adj_type), \
+        reinterpret_cast<char const *>(&prefix), sizeof(adj_type));
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    stream.write(corrupt.data(), corrupt.size());
+  }
+  testTrue(loadFails(filename, true));
+
+  // a neighbour which is not a vertex
+  {
+    std::string corrupt = contents;
+    vtx_type const neighbour = graph.numVertices();
+    corrupt.replace(listOffset, sizeof(vtx_type), \
+        reinterpret_cast<char const *>(&neighbour), sizeof(vtx_type));
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    stream.write(corrupt.data(), corrupt.size());
+  }
+  testTrue(loadFails(filename, true));
+
+  // not a binary graph
+  {
+    std::ofstream stream(filename, std::ios::trunc);
+    stream << "4 3\n2\n1 3\n2 4\n3\n";
+    for (int i = 0; i < 64; ++i) {
+      stream << "%\n";
+    }
+  }
+  testTrue(loadFails(filename));
+
+  std::remove(filename.c_str());
+
+  // missing file
+  testTrue(loadFails(filename));
+}
+
+
+}
@@ -0,0 +1,189 @@
+/**
+* @file EdgeListGraphBuilder_test.cpp
+* @brief Unit tests for the EdgeListGraphBuilder class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-23
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/EdgeListGraphBuilder.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+
+namespace poros
+{
+
+
+UNITTEST(EdgeListGraphBuilder, SymmetrizeAndMerge)
+{
+  EdgeListGraphBuilder builder(4);
+
+  builder.addEdge(0, 1, 2);
+  builder.addEdge(1, 0, 3);
+  builder.addEdge(2, 1);
+  builder.addEdge(3, 3, 7);
+  builder.addEdge(3, 0);
+  builder.addEdge(0, 3);
+
+  Graph const graph = builder.finish();
+
+  testEqual(graph.numVertices(), 4u);
+  testEqual(graph.numEdges(), 6u);
+  testFalse(graph.hasUnitEdgeWeight());
+  testTrue(graph.hasUnitVertexWeight());
+
+  // vertex 0 -> 1 (5), 3 (2)
+  testEqual(graph.getEdgePrefix()[1], 2u);
+  testEqual(graph.getEdgeList()[0], 1u);
+  testEqual(graph.getEdgeWeight()[0], 5u);
+  testEqual(graph.getEdgeList()[1], 3u);
+  testEqual(graph.getEdgeWeight()[1], 2u);
+
+  // vertex 1 -> 0 (5), 2 (1)
+  testEqual(graph.getEdgePrefix()[2], 4u);
+  testEqual(graph.getEdgeList()[2], 0u);
+  testEqual(graph.getEdgeWeight()[2], 5u);
+  testEqual(graph.getEdgeList()[3], 2u);
+  testEqual(graph.getEdgeWeight()[3], 1u);
+
+  // vertex 2 -> 1, vertex 3 -> 0 (without the self loop)
+  testEqual(graph.getEdgePrefix()[3], 5u);
+  testEqual(graph.getEdgeList()[4], 1u);
+  testEqual(graph.getEdgeList()[5], 0u);
+  testEqual(graph.getEdgeWeight()[5], 2u);
+}
+
+
+UNITTEST(EdgeListGraphBuilder, MergeMax)
+{
+  EdgeListGraphBuilder builder(3);
+  builder.setMergeType(EdgeListGraphBuilder::MERGE_MAX);
+
+  builder.addEdge(0, 1, 2);
+  builder.addEdge(1, 0, 3);
+  builder.addEdge(1, 2);
+  builder.addEdge(2, 1);
+
+  Graph const graph = builder.finish();
+
+  testEqual(graph.numEdges(), 4u);
+  testEqual(graph.getEdgeWeight()[0], 3u);
+  testEqual(graph.getEdgeWeight()[1], 3u);
+  testEqual(graph.getEdgeWeight()[2], 1u);
+  testEqual(graph.getEdgeWeight()[3], 1u);
+}
+
+
+UNITTEST(EdgeListGraphBuilder, InvalidVertex)
+{
+  EdgeListGraphBuilder builder(3);
+
+  std::vector<vtx_type> const sources{0, 1, 2};
+  std::vector<vtx_type> const dests{1, 3, 0};
+  builder.addEdges(sources.size(), sources.data(), dests.data(), nullptr);
+
+  bool thrown = false;
+  try {
+    builder.finish();
+  } catch (std::runtime_error const &) {
+    thrown = true;
+  }
+  testTrue(thrown);
+}
+
+
+UNITTEST(EdgeListGraphBuilder, VertexWeights)
+{
+  EdgeListGraphBuilder builder(3);
+  builder.setVertexWeight(1, 4);
+  builder.addEdge(0, 1);
+  builder.addEdge(1, 2);
+
+  Graph const graph = builder.finish();
+
+  testFalse(graph.hasUnitVertexWeight());
+  testTrue(graph.hasUnitEdgeWeight());
+  testEqual(graph.getTotalVertexWeight(), 6u);
+  testEqual(graph.getVertexWeight()[1], 4u);
+}
+
+
+UNITTEST(EdgeListGraphBuilder, MatchesGrid)
+{
+  GridGraphGenerator gen(6, 5, 4);
+  gen.setRandomEdgeWeight(1, 5);
+  Graph expected = gen.generate();
+
+  // add each edge once, in reverse order and reverse direction
+  std::vector<vtx_type> sources;
+  std::vector<vtx_type> dests;
+  std::vector<wgt_type> weights;
+  for (Vertex const v : expected.vertices()) {
+    for (Edge const e : expected.edgesOf(v)) {
+      Vertex const u = expected.destinationOf(e);
+      if (u.index < v.index) {
+        sources.emplace_back(v.index);
+        dests.emplace_back(u.index);
+        weights.emplace_back(expected.weightOf<true>(e));
+      }
+    }
+  }
+  std::reverse(sources.begin(), sources.end());
+  std::reverse(dests.begin(), dests.end());
+  std::reverse(weights.begin(), weights.end());
+
+  EdgeListGraphBuilder builder(expected.numVertices());
+  builder.addEdges(sources.size(), sources.data(), dests.data(), \
+      weights.data());
+  Graph const graph = builder.finish();
+
+  testEqual(graph.numEdges(), expected.numEdges());
+  testEqual(graph.getTotalEdgeWeight(), expected.getTotalEdgeWeight());
+  for (Vertex const v : expected.vertices()) {
+    testEqual(graph.getEdgePrefix()[v.index+1], \
+        expected.getEdgePrefix()[v.index+1]);
+
+    // the grid's edges are not sorted, so compare them as sets
+    std::vector<std::pair<vtx_type, wgt_type>> expectedEdges;
+    for (Edge const e : expected.edgesOf(v)) {
+      expectedEdges.emplace_back(expected.destinationOf(e).index, \
+          expected.weightOf<true>(e));
+    }
+    std::sort(expectedEdges.begin(), expectedEdges.end());
+
+    adj_type j = graph.getEdgePrefix()[v.index];
+    for (std::pair<vtx_type, wgt_type> const & edge : expectedEdges) {
+      testEqual(graph.getEdgeList()[j], edge.first);
+      testEqual(graph.getEdgeWeight()[j], edge.second);
+      ++j;
+    }
+  }
+}
+
+
+}
@@ -0,0 +1,101 @@
+/**
+* @file GeometricGraphGenerator_test.cpp
+* @brief Unit tests for the GeometricGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/GeometricGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <stdexcept>
+
+
+namespace poros
+{
+
+
+UNITTEST(GeometricGraphGenerator, AverageDegree2D)
+{
+  GeometricGraphGenerator gen(20000, 8.0, 2, 0);
+  Graph graph = gen.generate();
+
+  testEqual(graph.numVertices(), static_cast<vtx_type>(20000));
+
+  // vertices near the boundary have fewer neighbors
+  double const avgDegree = static_cast<double>(graph.numEdges()) / \
+      graph.numVertices();
+  testGreater(avgDegree, 7.0);
+  testLess(avgDegree, 8.5);
+}
+
+
+UNITTEST(GeometricGraphGenerator, AverageDegree3D)
+{
+  GeometricGraphGenerator gen(20000, 12.0, 3, 1);
+  Graph graph = gen.generate();
+
+
+  double const avgDegree = static_cast<double>(graph.numEdges()) / \
+      graph.numVertices();
+  testGreater(avgDegree, 9.0);
+  testLess(avgDegree, 12.5);
+}
+
+
+UNITTEST(GeometricGraphGenerator, Seeded)
+{
+  GeometricGraphGenerator gen1(5000, 6.0, 3, 3);
+  gen1.setRandomVertexWeight(2, 3);
+  Graph graph1 = gen1.generate();
+
+  GeometricGraphGenerator gen2(5000, 6.0, 3, 3);
+  gen2.setRandomVertexWeight(2, 3);
+  Graph graph2 = gen2.generate();
+
+  testEqual(graph1.numEdges(), graph2.numEdges());
+  for (adj_type e = 0; e < graph1.numEdges(); ++e) {
+    testEqual(graph1.getEdgeList()[e], graph2.getEdgeList()[e]);
+  }
+  for (vtx_type v = 0; v < graph1.numVertices(); ++v) {
+    testEqual(graph1.getVertexWeight()[v], graph2.getVertexWeight()[v]);
+    testGreaterOrEqual(graph1.getVertexWeight()[v], 2u);
+    testLessOrEqual(graph1.getVertexWeight()[v], 3u);
+  }
+}
+
+
+UNITTEST(GeometricGraphGenerator, InvalidDegree)
+{
+  bool thrown = false;
+  try {
+    GeometricGraphGenerator gen(1000, 0.0, 2, 0);
+  } catch (std::runtime_error const &) {
+    thrown = true;
+  }
+  testTrue(thrown);
+}
+
+
+}
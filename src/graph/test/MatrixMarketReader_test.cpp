@@ -0,0 +1,273 @@
+/**
+* @file MatrixMarketReader_test.cpp
+* @brief Unit tests for the MatrixMarketReader class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/MatrixMarketReader.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+namespace poros
+{
+
+namespace
+{
+
+void writeFile(
+    std::string const & filename,
+    std::string const & contents)
+{
+  std::ofstream stream(filename);
+  stream << contents;
+}
+
+
+bool readFails(
+    std::string const & filename)
+{
+  try {
+    MatrixMarketReader(filename).read();
+  } catch (std::runtime_error const &) {
+    return true;
+  }
+  return false;
+}
+
+}
+
+
+UNITTEST(MatrixMarketReader, ReadGeneralPattern)
+{
+  std::string const filename("MatrixMarketReader_pattern.mtx");
+  writeFile(filename, \
+      "%%MatrixMarket matrix coordinate pattern general\n"
+      "% a_01 and a_10 are the same edge, and the diagonal is dropped\n"
+      "4 4 5\n"
+      "1 2\n"
+      "2 1\n"
+      "2 2\n"
+      "\n"
+      "3 2\r\n"
+      "1 4");
+
+  Graph graph = MatrixMarketReader(filename).read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numVertices(), 4u);
+  testEqual(graph.numEdges(), 6u);
+  testTrue(graph.hasUnitVertexWeight());
+  testTrue(graph.hasUnitEdgeWeight());
+
+  testEqual(graph.getEdgePrefix()[1], 2u);
+  testEqual(graph.getEdgePrefix()[2], 4u);
+  testEqual(graph.getEdgePrefix()[3], 5u);
+  testEqual(graph.getEdgeList()[0], 1u);
+  testEqual(graph.getEdgeList()[1], 3u);
+  testEqual(graph.getEdgeList()[2], 0u);
+  testEqual(graph.getEdgeList()[3], 2u);
+}
+
+
+UNITTEST(MatrixMarketReader, ReadSymmetricWeighted)
+{
+  std::string const filename("MatrixMarketReader_symmetric.mtx");
+  writeFile(filename, \
+      "%%MatrixMarket matrix coordinate real symmetric\n"
+      "3 3 4\n"
+      "1 1 4.0\n"
+      "2 1 -1.5e0\n"
+      "3 2 0.2\n"
+      "3 3 2\n");
+
+  MatrixMarketReader reader(filename);
+  reader.setValueEdgeWeights(true);
+  reader.setRowVertexWeights(true);
+  Graph graph = reader.read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numVertices(), 3u);
+  testEqual(graph.numEdges(), 4u);
+
+  // |a_10| + |a_01| = 3, and |a_21| + |a_12| rounds to 0 so becomes 1
+  testEqual(graph.getEdgeWeight()[0], 3u);
+  testEqual(graph.getEdgeWeight()[1], 3u);
+  testEqual(graph.getEdgeWeight()[2], 1u);
+  testEqual(graph.getEdgeWeight()[3], 1u);
+
+  // rows of the full matrix have 2, 2, and 2 non-zeros
+  testEqual(graph.getVertexWeight()[0], 2u);
+  testEqual(graph.getVertexWeight()[1], 2u);
+  testEqual(graph.getVertexWeight()[2], 2u);
+}
+
+
+UNITTEST(MatrixMarketReader, ReadGeneralWeighted)
+{
+  std::string const filename("MatrixMarketReader_general.mtx");
+  writeFile(filename, \
+      "%%MatrixMarket Matrix Coordinate Complex General\n"
+      "3 3 3\n"
+      "1 2 3 4\n"
+      "2 1 -2 0\n"
+      "3 1 0 1\n");
+
+  MatrixMarketReader reader(filename);
+  reader.setValueEdgeWeights(true);
+  reader.setRowVertexWeights(true);
+  Graph graph = reader.read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numEdges(), 4u);
+  testEqual(graph.getEdgeList()[0], 1u);
+  testEqual(graph.getEdgeWeight()[0], 7u);
+  testEqual(graph.getEdgeList()[1], 2u);
+  testEqual(graph.getEdgeWeight()[1], 1u);
+
+  testEqual(graph.getVertexWeight()[0], 1u);
+  testEqual(graph.getVertexWeight()[1], 1u);
+  testEqual(graph.getVertexWeight()[2], 1u);
+}
+
+
+UNITTEST(MatrixMarketReader, ReadLargeWeight)
+{
+  std::string const filename("MatrixMarketReader_large.mtx");
+  writeFile(filename, \
+      "%%MatrixMarket matrix coordinate real symmetric\n"
+      "2 2 1\n"
+      "2 1 1e30\n");
+
+  MatrixMarketReader reader(filename);
+  reader.setValueEdgeWeights(true);
+  Graph graph = reader.read();
+  std::remove(filename.c_str());
+
+  // values too large for wgt_type are clamped to its maximum
+  testEqual(graph.numEdges(), 2u);
+  testEqual(graph.getEdgeWeight()[0], std::numeric_limits<wgt_type>::max());
+  testEqual(graph.getEdgeWeight()[1], std::numeric_limits<wgt_type>::max());
+}
+
+
+UNITTEST(MatrixMarketReader, ReadGrid)
+{
+  GridGraphGenerator gen(7, 5, 3);
+  gen.setRandomEdgeWeight(1, 9);
+  Graph expected = gen.generate();
+
+  // store the lower triangle
+  std::string contents = "%%MatrixMarket matrix coordinate integer " \
+      "symmetric\n" + std::to_string(expected.numVertices()) + " " + \
+      std::to_string(expected.numVertices()) + " " + \
+      std::to_string(expected.numEdges()/2) + "\n";
+  for (Vertex const v : expected.vertices()) {
+    for (Edge const e : expected.edgesOf(v)) {
+      Vertex const u = expected.destinationOf(e);
+      if (u.index < v.index) {
+        contents += std::to_string(v.index+1) + " " + \
+            std::to_string(u.index+1) + " " + \
+            std::to_string(expected.weightOf<true>(e)) + "\n";
+      }
+    }
+  }
+
+  std::string const filename("MatrixMarketReader_grid.mtx");
+  writeFile(filename, contents);
+  MatrixMarketReader reader(filename);
+  reader.setValueEdgeWeights(true);
+  Graph graph = reader.read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numVertices(), expected.numVertices());
+  testEqual(graph.numEdges(), expected.numEdges());
+  for (Vertex const v : expected.vertices()) {
+    // the grid's edges are not sorted, so compare them as sets
+    std::vector<std::pair<vtx_type, wgt_type>> expectedEdges;
+    for (Edge const e : expected.edgesOf(v)) {
+      expectedEdges.emplace_back(expected.destinationOf(e).index, \
+          2*expected.weightOf<true>(e));
+    }
+    std::sort(expectedEdges.begin(), expectedEdges.end());
+
+    adj_type j = graph.getEdgePrefix()[v.index];
+    for (std::pair<vtx_type, wgt_type> const & edge : expectedEdges) {
+      testEqual(graph.getEdgeList()[j], edge.first);
+      testEqual(graph.getEdgeWeight()[j], edge.second);
+      ++j;
+    }
+  }
+}
+
+
+UNITTEST(MatrixMarketReader, ReadInvalid)
+{
+  std::string const filename("MatrixMarketReader_invalid.mtx");
+
+  // array format
+  writeFile(filename, "%%MatrixMarket matrix array real general\n2 2\n" \
+      "1\n2\n3\n4\n");
+  testTrue(readFails(filename));
+
+  // not square
+  writeFile(filename, "%%MatrixMarket matrix coordinate pattern general\n" \
+      "2 3 1\n1 3\n");
+  testTrue(readFails(filename));
+
+  // wrong number of entries
+  writeFile(filename, "%%MatrixMarket matrix coordinate pattern general\n" \
+      "2 2 2\n1 2\n");
+  testTrue(readFails(filename));
+
+  // out of range index
+  writeFile(filename, "%%MatrixMarket matrix coordinate pattern general\n" \
+      "2 2 1\n1 3\n");
+  testTrue(readFails(filename));
+
+  // missing value
+  writeFile(filename, "%%MatrixMarket matrix coordinate real general\n" \
+      "2 2 1\n1 2\n");
+  testTrue(readFails(filename));
+
+  // missing banner
+  writeFile(filename, "2 2 1\n1 2\n");
+  testTrue(readFails(filename));
+
+  std::remove(filename.c_str());
+
+  // missing file
+  testTrue(readFails(filename));
+}
+
+
+}
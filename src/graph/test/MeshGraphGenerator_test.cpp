@@ -0,0 +1,74 @@
+/**
+* @file MeshGraphGenerator_test.cpp
+* @brief Unit tests for the MeshGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/MeshGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+
+namespace poros
+{
+
+
+UNITTEST(MeshGraphGenerator, NoHoles)
+{
+  MeshGraphGenerator gen(13, 9, 0, 0.0, 0);
+  Graph graph = gen.generate();
+
+  testEqual(graph.numVertices(), static_cast<vtx_type>(13*9));
+
+  // horizontal, vertical, and diagonal edges in both directions
+  testEqual(graph.numEdges(), static_cast<adj_type>( \
+      2*((12*9) + (13*8) + (12*8))));
+
+  // interior vertices have six neighbors
+  testEqual(graph.degreeOf(Vertex::make(13*4 + 6)), 6u);
+}
+
+
+UNITTEST(MeshGraphGenerator, Holes)
+{
+  MeshGraphGenerator gen(200, 100, 10, 12.0, 0);
+  gen.setRandomEdgeWeight(1, 9);
+  Graph graph = gen.generate();
+
+
+  // each hole removes at least a quarter of a circle of radius 6
+  testLess(graph.numVertices(), static_cast<vtx_type>(200*100 - 250));
+  testGreater(graph.numVertices(), static_cast<vtx_type>(200*100 - 10*460));
+
+  for (Vertex const v : graph.vertices()) {
+    testLessOrEqual(graph.degreeOf(v), 6u);
+  }
+  for (adj_type e = 0; e < graph.numEdges(); ++e) {
+    testGreaterOrEqual(graph.getEdgeWeight()[e], 1u);
+    testLessOrEqual(graph.getEdgeWeight()[e], 9u);
+  }
+}
+
+
+}
@@ -0,0 +1,184 @@
+/**
+* @file MetisGraphReader_test.cpp
+* @brief Unit tests for the MetisGraphReader class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/MetisGraphReader.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+
+namespace poros
+{
+
+namespace
+{
+
+void writeFile(
+    std::string const & filename,
+    std::string const & contents)
+{
+  std::ofstream stream(filename);
+  stream << contents;
+}
+
+
+bool readFails(
+    std::string const & filename)
+{
+  try {
+    MetisGraphReader(filename).read();
+  } catch (std::runtime_error const &) {
+    return true;
+  }
+  return false;
+}
+
+}
+
+
+UNITTEST(MetisGraphReader, ReadUnweighted)
+{
+  std::string const filename("MetisGraphReader_unweighted.graph");
+  writeFile(filename, \
+      "% a path with a dangling vertex\n"
+      "4 2\n"
+      "2\n"
+      "% comment between vertices\n"
+      "1 3\n"
+      "2\n"
+      "\n");
+
+  Graph graph = MetisGraphReader(filename).read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numVertices(), 4u);
+  testEqual(graph.numEdges(), 4u);
+  testTrue(graph.hasUnitVertexWeight());
+  testTrue(graph.hasUnitEdgeWeight());
+
+  testEqual(graph.getEdgePrefix()[1], 1u);
+  testEqual(graph.getEdgePrefix()[2], 3u);
+  testEqual(graph.getEdgePrefix()[3], 4u);
+  testEqual(graph.getEdgePrefix()[4], 4u);
+
+  testEqual(graph.getEdgeList()[0], 1u);
+  testEqual(graph.getEdgeList()[1], 0u);
+  testEqual(graph.getEdgeList()[2], 2u);
+  testEqual(graph.getEdgeList()[3], 1u);
+}
+
+
+UNITTEST(MetisGraphReader, ReadWeighted)
+{
+  std::string const filename("MetisGraphReader_weighted.graph");
+  writeFile(filename, \
+      "3 3 011 1\n"
+      "5 2 7 3 1\n"
+      "1 1 7 3 2\r\n"
+      "2 1 1 2 2");
+
+  Graph graph = MetisGraphReader(filename).read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numVertices(), 3u);
+  testEqual(graph.numEdges(), 6u);
+  testEqual(graph.getTotalVertexWeight(), 8u);
+  testEqual(graph.getTotalEdgeWeight(), 20u);
+
+  testEqual(graph.getVertexWeight()[0], 5u);
+  testEqual(graph.getVertexWeight()[2], 2u);
+  testEqual(graph.getEdgeList()[3], 2u);
+  testEqual(graph.getEdgeWeight()[3], 2u);
+}
+
+
+UNITTEST(MetisGraphReader, ReadGrid)
+{
+  GridGraphGenerator gen(7, 5, 3);
+  gen.setRandomEdgeWeight(1, 9);
+  Graph expected = gen.generate();
+
+  std::string contents = std::to_string(expected.numVertices()) + " " + \
+      std::to_string(expected.numEdges()/2) + " 1\n";
+  for (Vertex const v : expected.vertices()) {
+    for (Edge const e : expected.edgesOf(v)) {
+      contents += std::to_string(expected.destinationOf(e).index+1) + " " + \
+          std::to_string(expected.weightOf<true>(e)) + " ";
+    }
+    contents += "\n";
+  }
+
+  std::string const filename("MetisGraphReader_grid.graph");
+  writeFile(filename, contents);
+  Graph graph = MetisGraphReader(filename).read();
+  std::remove(filename.c_str());
+
+  testEqual(graph.numVertices(), expected.numVertices());
+  testEqual(graph.numEdges(), expected.numEdges());
+  for (adj_type e = 0; e < graph.numEdges(); ++e) {
+    testEqual(graph.getEdgeList()[e], expected.getEdgeList()[e]);
+    testEqual(graph.getEdgeWeight()[e], expected.getEdgeWeight()[e]);
+  }
+}
+
+
+UNITTEST(MetisGraphReader, ReadInvalid)
+{
+  std::string const filename("MetisGraphReader_invalid.graph");
+
+  // wrong number of edges
+  writeFile(filename, "3 3\n2\n1 3\n2\n");
+  testTrue(readFails(filename));
+
+  // out of range vertex
+  writeFile(filename, "2 1\n3\n1\n");
+  testTrue(readFails(filename));
+
+  // missing vertex lines
+  writeFile(filename, "3 1\n2\n1\n");
+  testTrue(readFails(filename));
+
+  // missing edge weight
+  writeFile(filename, "2 1 1\n2 1\n1\n");
+  testTrue(readFails(filename));
+
+  // multiple constraints
+  writeFile(filename, "2 1 10 2\n1 1 2\n1 1 1\n");
+  testTrue(readFails(filename));
+
+  std::remove(filename.c_str());
+
+  // missing file
+  testTrue(readFails(filename));
+}
+
+
+}
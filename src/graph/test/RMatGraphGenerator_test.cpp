@@ -0,0 +1,86 @@
+/**
+* @file RMatGraphGenerator_test.cpp
+* @brief Unit tests for the RMatGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/RMatGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <algorithm>
+
+
+namespace poros
+{
+
+
+UNITTEST(RMatGraphGenerator, SkewedDegrees)
+{
+  RMatGraphGenerator gen(12, 16, 0);
+  Graph graph = gen.generate();
+
+  testEqual(graph.numVertices(), static_cast<vtx_type>(4096));
+  testTrue(graph.hasUnitEdgeWeight());
+  testTrue(graph.hasUnitVertexWeight());
+
+  // duplicates and self loops are removed
+  testLessOrEqual(graph.numEdges(), static_cast<adj_type>(2*4096*16));
+
+  vtx_type maxDegree = 0;
+  for (Vertex const v : graph.vertices()) {
+    maxDegree = std::max(maxDegree, graph.degreeOf(v));
+  }
+  vtx_type const avgDegree = graph.numEdges() / graph.numVertices();
+  testGreater(maxDegree, 10*avgDegree);
+}
+
+
+UNITTEST(RMatGraphGenerator, Seeded)
+{
+  RMatGraphGenerator gen1(10, 8, 5);
+  gen1.setProbabilities(0.45, 0.15, 0.15);
+  gen1.setRandomEdgeWeight(1, 4);
+  Graph graph1 = gen1.generate();
+
+  RMatGraphGenerator gen2(10, 8, 5);
+  gen2.setProbabilities(0.45, 0.15, 0.15);
+  gen2.setRandomEdgeWeight(1, 4);
+  Graph graph2 = gen2.generate();
+
+  testEqual(graph1.numEdges(), graph2.numEdges());
+  for (adj_type e = 0; e < graph1.numEdges(); ++e) {
+    testEqual(graph1.getEdgeList()[e], graph2.getEdgeList()[e]);
+    testEqual(graph1.getEdgeWeight()[e], graph2.getEdgeWeight()[e]);
+    testGreaterOrEqual(graph1.getEdgeWeight()[e], 1u);
+    testLessOrEqual(graph1.getEdgeWeight()[e], 4u);
+  }
+
+  RMatGraphGenerator gen3(10, 8, 6);
+  Graph graph3 = gen3.generate();
+  testNotEqual(graph1.numEdges(), graph3.numEdges());
+}
+
+
+}
@@ -0,0 +1,126 @@
+/**
+* @file RandomGraphGenerator_test.cpp
+* @brief Unit tests for the RandomGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/BarabasiAlbertGraphGenerator.hpp"
+#include "graph/GeometricGraphGenerator.hpp"
+#include "graph/MeshGraphGenerator.hpp"
+#include "graph/RMatGraphGenerator.hpp"
+#include "graph/StochasticBlockGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+namespace poros
+{
+
+namespace
+{
+
+/**
+* @brief Generate a graph with a number of threads.
+*
+* @param make Creates the generator.
+* @param numThreads The number of threads.
+*
+* @return The generated graph.
+*/
+Graph generateWith(
+    std::function<RandomGraphGenerator*()> const & make,
+    int const numThreads)
+{
+  #ifdef _OPENMP
+  int const maxThreads = omp_get_max_threads();
+  omp_set_num_threads(numThreads);
+  #endif
+
+  std::unique_ptr<RandomGraphGenerator> gen(make());
+  gen->setRandomVertexWeight(1, 5);
+  gen->setRandomEdgeWeight(1, 3);
+  Graph graph = gen->generate();
+
+  #ifdef _OPENMP
+  omp_set_num_threads(maxThreads);
+  #endif
+
+  return graph;
+}
+
+}
+
+
+UNITTEST(RandomGraphGenerator, SameForAnyNumberOfThreads)
+{
+  std::vector<std::function<RandomGraphGenerator*()>> const makers{
+    []() {
+      return new BarabasiAlbertGraphGenerator(3000, 3, 1);
+    },
+    []() {
+      return new GeometricGraphGenerator(3000, 8.0, 2, 2);
+    },
+    []() {
+      return new MeshGraphGenerator(60, 50, 4, 3.0, 3);
+    },
+    []() {
+      return new RMatGraphGenerator(11, 8, 4);
+    },
+    []() {
+      return new StochasticBlockGraphGenerator(3000, 6, 0.01, 0.001, 5);
+    }
+  };
+
+  for (size_t i = 0; i < makers.size(); ++i) {
+    Graph const serial = generateWith(makers[i], 1);
+    Graph const parallel = generateWith(makers[i], 4);
+
+    testEqual(parallel.numVertices(), serial.numVertices()) << \
+        "Generator " << i;
+    testEqual(parallel.numEdges(), serial.numEdges()) << "Generator " << i;
+    for (Vertex const v : serial.vertices()) {
+      testEqual(parallel.getEdgePrefix()[v.index+1], \
+          serial.getEdgePrefix()[v.index+1]) << "Generator " << i;
+      testEqual(parallel.getVertexWeight()[v.index], \
+          serial.getVertexWeight()[v.index]) << "Generator " << i;
+    }
+    for (adj_type e = 0; e < serial.numEdges(); ++e) {
+      testEqual(parallel.getEdgeList()[e], serial.getEdgeList()[e]) << \
+          "Generator " << i;
+      testEqual(parallel.getEdgeWeight()[e], serial.getEdgeWeight()[e]) << \
+          "Generator " << i;
+    }
+  }
+}
+
+
+}
@@ -0,0 +1,93 @@
+/**
+* @file StochasticBlockGraphGenerator_test.cpp
+* @brief Unit tests for the StochasticBlockGraphGenerator class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/StochasticBlockGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+
+namespace poros
+{
+
+
+UNITTEST(StochasticBlockGraphGenerator, Cliques)
+{
+  // with certain edges inside of blocks and none between them, each block is
+  // a clique
+  StochasticBlockGraphGenerator gen(100, 7, 1.0, 0.0, 0);
+  Graph graph = gen.generate();
+
+  testEqual(graph.numVertices(), static_cast<vtx_type>(100));
+
+  vtx_type blockSize[7] = {0, 0, 0, 0, 0, 0, 0};
+  for (Vertex const v : graph.vertices()) {
+    ++blockSize[gen.blockOf(v.index)];
+  }
+  for (Vertex const v : graph.vertices()) {
+    testEqual(graph.degreeOf(v), blockSize[gen.blockOf(v.index)] - 1);
+    for (Edge const e : graph.edgesOf(v)) {
+      testEqual(gen.blockOf(graph.destinationOf(e).index), \
+          gen.blockOf(v.index));
+    }
+  }
+}
+
+
+UNITTEST(StochasticBlockGraphGenerator, Probabilities)
+{
+  vtx_type const numVertices = 4000;
+  vtx_type const numBlocks = 8;
+  StochasticBlockGraphGenerator gen(numVertices, numBlocks, 0.02, 0.001, 1);
+  Graph graph = gen.generate();
+
+
+  size_t intra = 0;
+  size_t inter = 0;
+  for (Vertex const v : graph.vertices()) {
+    for (Edge const e : graph.edgesOf(v)) {
+      if (gen.blockOf(graph.destinationOf(e).index) == gen.blockOf(v.index)) {
+        ++intra;
+      } else {
+        ++inter;
+      }
+    }
+  }
+
+  // compare the edges in each direction to the expected number of pairs
+  // times the probability
+  double const blockSize = numVertices / numBlocks;
+  double const intraPairs = numBlocks * blockSize * (blockSize - 1);
+  double const interPairs = static_cast<double>(numVertices) * \
+      (numVertices - blockSize);
+  testGreater(intra, 0.9 * 0.02 * intraPairs);
+  testLess(intra, 1.1 * 0.02 * intraPairs);
+  testGreater(inter, 0.9 * 0.001 * interPairs);
+  testLess(inter, 1.1 * 0.001 * interPairs);
+}
+
+
+}
@@ -0,0 +1,164 @@
+/**
+* @file StreamingGraphBuilder_test.cpp
+* @brief Unit tests for the StreamingGraphBuilder class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "graph/StreamingGraphBuilder.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+
+namespace poros
+{
+
+namespace
+{
+
+/**
+* @brief Stream a graph in blocks of a fixed number of vertices.
+*/
+Graph streamInBlocks(
+    Graph const * const graph,
+    vtx_type const blockSize)
+{
+  StreamingGraphBuilder builder(graph->numVertices(), graph->numEdges(), \
+      !graph->hasUnitVertexWeight(), !graph->hasUnitEdgeWeight());
+
+  adj_type const * const edgePrefix = graph->getEdgePrefix();
+  for (vtx_type start = 0; start < graph->numVertices(); start += blockSize) {
+    vtx_type const end = std::min(start + blockSize, graph->numVertices());
+
+    // the caller's block uses a local prefix
+    std::vector<adj_type> prefix(end-start+1);
+    for (vtx_type v = start; v <= end; ++v) {
+      prefix[v-start] = edgePrefix[v] - edgePrefix[start];
+    }
+
+    builder.addVertices(end-start, prefix.data(), \
+        graph->getEdgeList() + edgePrefix[start], \
+        graph->hasUnitVertexWeight() ? nullptr : \
+            graph->getVertexWeight() + start, \
+        graph->hasUnitEdgeWeight() ? nullptr : \
+            graph->getEdgeWeight() + edgePrefix[start]);
+    testEqual(builder.numAddedVertices(), end);
+  }
+
+  return builder.finish();
+}
+
+}
+
+
+UNITTEST(StreamingGraphBuilder, MatchesGrid)
+{
+  GridGraphGenerator gen(7, 6, 5);
+  gen.setRandomVertexWeight(1, 4);
+  gen.setRandomEdgeWeight(1, 9);
+  Graph expected = gen.generate();
+
+  for (vtx_type blockSize : {1u, 13u, 1000u}) {
+    Graph graph = streamInBlocks(&expected, blockSize);
+
+    testEqual(graph.numVertices(), expected.numVertices());
+    testEqual(graph.numEdges(), expected.numEdges());
+    testEqual(graph.getTotalVertexWeight(), expected.getTotalVertexWeight());
+    testEqual(graph.getTotalEdgeWeight(), expected.getTotalEdgeWeight());
+    for (vtx_type v = 0; v <= graph.numVertices(); ++v) {
+      testEqual(graph.getEdgePrefix()[v], expected.getEdgePrefix()[v]);
+    }
+    for (adj_type e = 0; e < graph.numEdges(); ++e) {
+      testEqual(graph.getEdgeList()[e], expected.getEdgeList()[e]);
+      testEqual(graph.getEdgeWeight()[e], expected.getEdgeWeight()[e]);
+    }
+  }
+}
+
+
+UNITTEST(StreamingGraphBuilder, Unweighted)
+{
+  Graph expected = GridGraphGenerator(5, 5, 1).generate();
+  Graph graph = streamInBlocks(&expected, 7);
+
+  testTrue(graph.hasUnitVertexWeight());
+  testTrue(graph.hasUnitEdgeWeight());
+  testEqual(graph.numEdges(), expected.numEdges());
+}
+
+
+UNITTEST(StreamingGraphBuilder, Invalid)
+{
+  adj_type const prefix[] = {0, 1, 2};
+  vtx_type const edges[] = {1, 0};
+  vtx_type const badEdges[] = {1, 3};
+  wgt_type const weights[] = {1, 1};
+
+  StreamingGraphBuilder builder(2, 2, false, false);
+
+  bool threw = false;
+  try {
+    builder.addVertices(2, prefix, badEdges, nullptr, nullptr);
+  } catch (std::runtime_error const &) {
+    threw = true;
+  }
+  testTrue(threw);
+
+  threw = false;
+  try {
+    builder.addVertices(2, prefix, edges, weights, nullptr);
+  } catch (std::runtime_error const &) {
+    threw = true;
+  }
+  testTrue(threw);
+
+  builder.addVertices(1, prefix, edges, nullptr, nullptr);
+
+  threw = false;
+  try {
+    builder.addVertices(2, prefix, edges, nullptr, nullptr);
+  } catch (std::runtime_error const &) {
+    threw = true;
+  }
+  testTrue(threw);
+
+  threw = false;
+  try {
+    builder.finish();
+  } catch (std::runtime_error const &) {
+    threw = true;
+  }
+  testTrue(threw);
+
+  builder.addVertices(1, prefix, edges+1, nullptr, nullptr);
+  Graph graph = builder.finish();
+  testEqual(graph.numEdges(), 2u);
+}
+
+
+}
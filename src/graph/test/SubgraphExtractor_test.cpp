@@ -61,4 +61,33 @@ UNITTEST(SubgraphExtract, Partitions)
   testEqual(subs[2].getSuperMap(1), 7u);
 }
 
+
+UNITTEST(SubgraphExtract, Partition)
+{
+  GridGraphGenerator gen(2,2,2);
+
+  Graph g = gen.generate(); 
+
+  Partitioning p(3, &g);
+  p.assignAll(0);
+  p.move(Vertex::make(2), 1);
+  p.move(Vertex::make(3), 1);
+  p.move(Vertex::make(6), 2);
+  p.move(Vertex::make(7), 2);
+
+  std::vector<Subgraph> subs = SubgraphExtractor::partitions(&g, &p);
+
+  for (pid_type pid = 0; pid < 3; ++pid) {
+    Subgraph const sub = SubgraphExtractor::partition(&g, &p, pid);
+    Graph const * const expected = subs[pid].getGraph();
+    Graph const * const actual = sub.getGraph();
+
+    testEqual(actual->numVertices(), expected->numVertices());
+    testEqual(actual->numEdges(), expected->numEdges());
+    for (vtx_type v = 0; v < actual->numVertices(); ++v) {
+      testEqual(sub.getSuperMap(v), subs[pid].getSuperMap(v));
+    }
+  }
+}
+
 }
@@ -0,0 +1,347 @@
+/**
+* @file CoarseningHierarchy.cpp
+* @brief Implementation of the CoarseningHierarchy class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-25
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "multilevel/CoarseningHierarchy.hpp"
+#include "graph/BinaryGraphFile.hpp"
+#include "util/MemoryMappedFile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+namespace
+{
+
+struct header_struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t vtxBytes;
+  uint32_t numLevels;
+  uint64_t numVertices;
+  uint64_t numEdges;
+  uint64_t totalVertexWeight;
+  uint64_t totalEdgeWeight;
+  uint64_t checksum;
+};
+
+static_assert(sizeof(header_struct) == 64, "Unexpected header padding");
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+char const MAGIC[8] = {'P', 'O', 'R', 'O', 'S', 'H', 'I', 'E'};
+
+uint32_t const BYTE_ORDER_MARK = 0x01020304;
+
+size_t const SECTION_ALIGNMENT = 64;
+
+uint64_t const FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+uint64_t const FNV_PRIME = 0x100000001b3ULL;
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+size_t alignSection(
+    size_t const offset) noexcept
+{
+  return ((offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT) * \
+      SECTION_ALIGNMENT;
+}
+
+
+void writeSection(
+    std::ofstream * const stream,
+    void const * const data,
+    size_t const bytes)
+{
+  static char const padding[SECTION_ALIGNMENT] = {0};
+
+  stream->write(static_cast<char const *>(data), bytes);
+
+  size_t const position = static_cast<size_t>(stream->tellp());
+  stream->write(padding, alignSection(position) - position);
+}
+
+
+/**
+* @brief Fold each element of an array into a checksum, FNV-1a style but a
+* whole element at a time.
+*
+* @tparam T The type of element.
+* @param checksum The checksum so far.
+* @param data The array.
+* @param size The number of elements.
+*
+* @return The updated checksum.
+*/
+template<typename T>
+uint64_t foldChecksum(
+    uint64_t checksum,
+    T const * const data,
+    size_t const size) noexcept
+{
+  for (size_t i = 0; i < size; ++i) {
+    checksum = (checksum ^ static_cast<uint64_t>(data[i])) * FNV_PRIME;
+  }
+  return checksum;
+}
+
+
+/**
+* @brief Compute a checksum of the structure and weights of a graph, so that a
+* hierarchy is not re-used for a different graph of the same size.
+*
+* @param graph The graph.
+*
+* @return The checksum.
+*/
+uint64_t graphChecksum(
+    Graph const * const graph) noexcept
+{
+  uint64_t checksum = FNV_OFFSET_BASIS;
+  checksum = foldChecksum(checksum, graph->getEdgePrefix(), \
+      graph->numVertices()+1);
+  checksum = foldChecksum(checksum, graph->getEdgeList(), graph->numEdges());
+  if (!graph->hasUnitVertexWeight()) {
+    checksum = foldChecksum(checksum, graph->getVertexWeight(), \
+        graph->numVertices());
+  }
+  if (!graph->hasUnitEdgeWeight()) {
+    checksum = foldChecksum(checksum, graph->getEdgeWeight(), \
+        graph->numEdges());
+  }
+  return checksum;
+}
+
+
+std::runtime_error formatError(
+    std::string const & filename,
+    std::string const & reason)
+{
+  return std::runtime_error("Cannot load '" + filename + "' as a " \
+      "coarsening hierarchy: " + reason);
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+constexpr uint32_t const CoarseningHierarchy::VERSION;
+
+
+CoarseningHierarchy::CoarseningHierarchy(
+    Graph const * const graph) :
+  m_numVertices(graph->numVertices()),
+  m_numEdges(graph->numEdges()),
+  m_totalVertexWeight(graph->getTotalVertexWeight()),
+  m_totalEdgeWeight(graph->getTotalEdgeWeight()),
+  m_checksum(graphChecksum(graph)),
+  m_data(),
+  m_graphs(),
+  m_coarseMaps()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+bool CoarseningHierarchy::isOf(
+    Graph const * const graph) const noexcept
+{
+  return graph->numVertices() == m_numVertices && \
+      graph->numEdges() == m_numEdges && \
+      graph->getTotalVertexWeight() == m_totalVertexWeight && \
+      graph->getTotalEdgeWeight() == m_totalEdgeWeight && \
+      graphChecksum(graph) == m_checksum;
+}
+
+
+void CoarseningHierarchy::addLevel(
+    GraphHandle coarse,
+    sl::Array<vtx_type> coarseMap)
+{
+  ASSERT_EQUAL(coarseMap.size(), m_graphs.empty() ? m_numVertices : \
+      m_graphs.back()->numVertices());
+
+  m_graphs.emplace_back(coarse);
+  m_coarseMaps.emplace_back(std::move(coarseMap));
+}
+
+
+void CoarseningHierarchy::save(
+    std::string const & filename) const
+{
+  header_struct header;
+  std::memset(&header, 0, sizeof(header));
+
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.vtxBytes = sizeof(vtx_type);
+  header.numLevels = static_cast<uint32_t>(m_graphs.size());
+  header.numVertices = m_numVertices;
+  header.numEdges = m_numEdges;
+  header.totalVertexWeight = m_totalVertexWeight;
+  header.totalEdgeWeight = m_totalEdgeWeight;
+  header.checksum = m_checksum;
+
+  std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+  if (!stream) {
+    throw std::runtime_error("Failed to open '" + filename + "' for " \
+        "writing.");
+  }
+
+  writeSection(&stream, &header, sizeof(header));
+  for (size_t level = 0; level < m_graphs.size(); ++level) {
+    writeSection(&stream, m_coarseMaps[level].data(), \
+        m_coarseMaps[level].size()*sizeof(vtx_type));
+    BinaryGraphFile::write(m_graphs[level].get(), &stream);
+  }
+
+  if (!stream.flush()) {
+    throw std::runtime_error("Failed to write '" + filename + "'.");
+  }
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+std::unique_ptr<CoarseningHierarchy> CoarseningHierarchy::load(
+    std::string const & filename)
+{
+  std::unique_ptr<MemoryMappedFile> file( \
+      new MemoryMappedFile(filename, false));
+
+  if (file->size() < sizeof(header_struct)) {
+    throw formatError(filename, "too small for a header");
+  }
+
+  header_struct header;
+  std::memcpy(&header, file->data(), sizeof(header));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw formatError(filename, "not a coarsening hierarchy");
+  } else if (header.version != VERSION) {
+    throw formatError(filename, "unsupported version " + \
+        std::to_string(header.version));
+  } else if (header.byteOrder != BYTE_ORDER_MARK) {
+    throw formatError(filename, "written with a different byte order");
+  } else if (header.vtxBytes != sizeof(vtx_type)) {
+    throw formatError(filename, "written with different type sizes");
+  } else if (header.numVertices >= static_cast<uint64_t>(NULL_VTX) || \
+      header.numEdges >= static_cast<uint64_t>(NULL_ADJ)) {
+    throw formatError(filename, "too large for this build");
+  }
+
+  std::unique_ptr<CoarseningHierarchy> hierarchy(new CoarseningHierarchy);
+  hierarchy->m_numVertices = static_cast<vtx_type>(header.numVertices);
+  hierarchy->m_numEdges = static_cast<adj_type>(header.numEdges);
+  hierarchy->m_totalVertexWeight = \
+      static_cast<wgt_type>(header.totalVertexWeight);
+  hierarchy->m_totalEdgeWeight = \
+      static_cast<wgt_type>(header.totalEdgeWeight);
+  hierarchy->m_checksum = header.checksum;
+
+  char const * const data = file->data();
+  size_t const size = file->size();
+  size_t offset = alignSection(sizeof(header));
+  vtx_type numFineVertices = hierarchy->m_numVertices;
+  for (uint32_t level = 0; level < header.numLevels; ++level) {
+    size_t const mapBytes = numFineVertices*sizeof(vtx_type);
+    if (offset + mapBytes > size) {
+      throw formatError(filename, "truncated");
+    }
+    vtx_type const * const coarseMap = \
+        reinterpret_cast<vtx_type const *>(data + offset);
+    offset = alignSection(offset + mapBytes);
+
+    size_t graphBytes;
+    Graph coarse = BinaryGraphFile::view(data + offset, size - offset, \
+        filename, &graphBytes, true);
+    offset += graphBytes;
+
+    for (vtx_type v = 0; v < numFineVertices; ++v) {
+      if (coarseMap[v] >= coarse.numVertices()) {
+        throw formatError(filename, "corrupt coarse map");
+      }
+    }
+
+    hierarchy->m_coarseMaps.emplace_back(coarseMap, numFineVertices);
+    numFineVertices = coarse.numVertices();
+    hierarchy->m_graphs.emplace_back(std::move(coarse));
+  }
+
+  hierarchy->m_data = std::move(file);
+
+  return hierarchy;
+}
+
+
+/******************************************************************************
+* PRIVATE METHODS *************************************************************
+******************************************************************************/
+
+CoarseningHierarchy::CoarseningHierarchy() :
+  m_numVertices(0),
+  m_numEdges(0),
+  m_totalVertexWeight(0),
+  m_totalEdgeWeight(0),
+  m_checksum(0),
+  m_data(),
+  m_graphs(),
+  m_coarseMaps()
+{
+  // do nothing
+}
+
+
+}
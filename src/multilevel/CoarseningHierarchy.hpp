@@ -0,0 +1,185 @@
+/**
+* @file CoarseningHierarchy.hpp
+* @brief The CoarseningHierarchy class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-25
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_MULTILEVEL_COARSENINGHIERARCHY_HPP
+#define POROS_SRC_MULTILEVEL_COARSENINGHIERARCHY_HPP
+
+
+#include "Base.hpp"
+#include "graph/GraphHandle.hpp"
+#include "util/IAllocatedData.hpp"
+#include "solidutils/Array.hpp"
+#include "solidutils/ConstArray.hpp"
+#include "solidutils/Debug.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace poros
+{
+
+/**
+* @brief The chain of coarse graphs built while coarsening a graph, and the
+* coarse map between each pair of levels. A hierarchy can be saved to a file
+* and loaded again later, so that partitioning the same graph again (with a
+* different number of partitions, targets, or seed) can skip straight to
+* initial partitioning.
+*
+* The file holds a 64 byte header identifying the fine graph, followed by
+* the coarse map and coarse graph (in the BinaryGraphFile format) of each
+* level. Loading memory maps the file, so neither is copied.
+*/
+class CoarseningHierarchy
+{
+  public:
+    /**
+    * @brief The current version of the file format.
+    */
+    static constexpr uint32_t const VERSION = 2;
+
+    /**
+    * @brief Create a new empty hierarchy for a graph.
+    *
+    * @param graph The fine graph.
+    */
+    CoarseningHierarchy(
+        Graph const * graph);
+
+
+    /**
+    * @brief Check if this hierarchy was built from a graph. The sizes, total
+    * weights, and a checksum of the edges and weights are compared.
+    *
+    * @param graph The graph.
+    *
+    * @return True if the graph matches the fine graph of this hierarchy.
+    */
+    bool isOf(
+        Graph const * graph) const noexcept;
+
+
+    /**
+    * @brief Get the number of coarse levels.
+    *
+    * @return The number of levels.
+    */
+    size_t numLevels() const noexcept
+    {
+      return m_graphs.size();
+    }
+
+
+    /**
+    * @brief Add the next coarse level.
+    *
+    * @param coarse The coarse graph.
+    * @param coarseMap The coarse vertex of each vertex in the previous level.
+    */
+    void addLevel(
+        GraphHandle coarse,
+        sl::Array<vtx_type> coarseMap);
+
+
+    /**
+    * @brief Get the coarse graph of a level.
+    *
+    * @param level The level (counting from 0 for the first coarse graph).
+    *
+    * @return The coarse graph.
+    */
+    GraphHandle const & graph(
+        size_t const level) const noexcept
+    {
+      ASSERT_LESS(level, m_graphs.size());
+      return m_graphs[level];
+    }
+
+
+    /**
+    * @brief Get the coarse map from the previous level to a level.
+    *
+    * @param level The level (counting from 0 for the first coarse graph).
+    *
+    * @return The coarse vertex of each vertex in the previous level.
+    */
+    vtx_type const * coarseMap(
+        size_t const level) const noexcept
+    {
+      ASSERT_LESS(level, m_coarseMaps.size());
+      return m_coarseMaps[level].data();
+    }
+
+
+    /**
+    * @brief Save the hierarchy to a file.
+    *
+    * @param filename The name of the file.
+    *
+    * @throws std::runtime_error If the file cannot be written.
+    */
+    void save(
+        std::string const & filename) const;
+
+
+    /**
+    * @brief Load a hierarchy from a file.
+    *
+    * @param filename The name of the file.
+    *
+    * @return The hierarchy.
+    *
+    * @throws std::runtime_error If the file cannot be read, or was not
+    * written by a compatible build.
+    */
+    static std::unique_ptr<CoarseningHierarchy> load(
+        std::string const & filename);
+
+
+  private:
+    /**
+    * @brief Create an empty hierarchy to load into.
+    */
+    CoarseningHierarchy();
+
+    vtx_type m_numVertices;
+    adj_type m_numEdges;
+    wgt_type m_totalVertexWeight;
+    wgt_type m_totalEdgeWeight;
+    uint64_t m_checksum;
+    std::unique_ptr<IAllocatedData> m_data;
+    std::vector<GraphHandle> m_graphs;
+    std::vector<sl::ConstArray<vtx_type>> m_coarseMaps;
+};
+
+
+}
+
+
+#endif
@@ -59,6 +59,25 @@ GraphHandle contract(
 }
 
 
+/**
+* @brief Build the coarse map of an aggregation.
+*
+* @param graph The fine graph.
+* @param agg The aggregation.
+*
+* @return The coarse vertex of each fine vertex.
+*/
+sl::Array<vtx_type> buildCoarseMap(
+    Graph const * const graph,
+    Aggregation const * const agg)
+{
+  sl::Array<vtx_type> coarseMap(graph->numVertices());
+  agg->fillCoarseMap(coarseMap.data());
+
+  return coarseMap;
+}
+
+
 template<bool HAS_EDGE_WEIGHTS>
 void fillInConnectivity(
     Graph const * const fineGraph,
@@ -119,9 +138,36 @@ DiscreteCoarseGraph::DiscreteCoarseGraph(
   Aggregation const * agg) :
   m_fine(graph),
   m_coarse(contract(graph, agg)),
-  m_coarseMap(graph->numVertices())
+  m_coarseMap(buildCoarseMap(graph, agg)),
+  m_memory(m_coarse->getMemoryUsage() + m_coarseMap.size()*sizeof(vtx_type))
+{
+  // do nothing
+}
+
+
+DiscreteCoarseGraph::DiscreteCoarseGraph(
+  Graph const * graph,
+  Aggregation const * agg,
+  IContractor * const contractor) :
+  m_fine(graph),
+  m_coarse(contractor->contract(graph, agg)),
+  m_coarseMap(buildCoarseMap(graph, agg)),
+  m_memory(m_coarse->getMemoryUsage() + m_coarseMap.size()*sizeof(vtx_type))
+{
+  // do nothing
+}
+
+
+DiscreteCoarseGraph::DiscreteCoarseGraph(
+  Graph const * const graph,
+  GraphHandle coarse,
+  vtx_type const * const coarseMap) :
+  m_fine(graph),
+  m_coarse(coarse),
+  m_coarseMap(coarseMap, graph->numVertices()),
+  m_memory()
 {
-  agg->fillCoarseMap(m_coarseMap.data());
+  // do nothing
 }
 
 
@@ -34,9 +34,12 @@
 #include "multilevel/ICoarseGraph.hpp"
 #include "graph/Graph.hpp"
 #include "aggregation/Aggregation.hpp"
+#include "aggregation/IContractor.hpp"
 #include "partition/Partitioning.hpp"
 
+#include "util/TrackedMemory.hpp"
 #include "solidutils/Array.hpp"
+#include "solidutils/ConstArray.hpp"
 
 namespace poros
 {
@@ -55,6 +58,32 @@ class DiscreteCoarseGraph : public ICoarseGraph
       Graph const * graph,
       Aggregation const * agg);
 
+  /**
+  * @brief Create a new coarse graph using the given contractor.
+  *
+  * @param graph The graph.
+  * @param agg The aggregation of the graph.
+  * @param contractor The contractor to build the coarse graph with.
+  */
+  DiscreteCoarseGraph(
+      Graph const * graph,
+      Aggregation const * agg,
+      IContractor * contractor);
+
+  /**
+  * @brief Create a new coarse graph from a graph which has already been
+  * contracted (i.e., one from a saved coarsening hierarchy). The coarse map
+  * is not copied, and must outlive this object.
+  *
+  * @param graph The graph.
+  * @param coarse The contracted graph.
+  * @param coarseMap The coarse vertex of each vertex in the graph.
+  */
+  DiscreteCoarseGraph(
+      Graph const * graph,
+      GraphHandle coarse,
+      vtx_type const * coarseMap);
+
   /**
   * @brief Deleted copy constructor.
   *
@@ -95,7 +124,8 @@ class DiscreteCoarseGraph : public ICoarseGraph
   private:
   Graph const * m_fine;
   GraphHandle m_coarse;
-  sl::Array<vtx_type> m_coarseMap;
+  sl::ConstArray<vtx_type> m_coarseMap;
+  TrackedMemory m_memory;
 };
 
 }
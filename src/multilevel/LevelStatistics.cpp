@@ -0,0 +1,101 @@
+/**
+* @file LevelStatistics.cpp
+* @brief Implementation of the LevelStatistics class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "LevelStatistics.hpp"
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+LevelStatistics::LevelStatistics() :
+  m_levels()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void LevelStatistics::clear() noexcept
+{
+  m_levels.clear();
+}
+
+
+void LevelStatistics::reportGraph(
+    size_t const level,
+    vtx_type const numVertices,
+    adj_type const numEdges,
+    wgt_type const exposedEdgeWeight)
+{
+  level_struct & stats = getLevel(level);
+
+  ++stats.numBisections;
+  stats.numVertices += numVertices;
+  stats.numEdges += numEdges;
+  stats.exposedEdgeWeight += exposedEdgeWeight;
+}
+
+
+void LevelStatistics::reportRefinement(
+    size_t const level,
+    wgt_type const initialCut,
+    wgt_type const refinedCut,
+    RefinementStatistics const & refinement)
+{
+  level_struct & stats = getLevel(level);
+
+  stats.initialCut += initialCut;
+  stats.refinedCut += refinedCut;
+  stats.refinement.add(refinement);
+}
+
+
+/******************************************************************************
+* PRIVATE METHODS *************************************************************
+******************************************************************************/
+
+LevelStatistics::level_struct & LevelStatistics::getLevel(
+    size_t const level)
+{
+  if (level >= m_levels.size()) {
+    m_levels.resize(level+1, \
+        level_struct{0, 0, 0, 0, 0, 0, RefinementStatistics()});
+  }
+
+  return m_levels[level];
+}
+
+
+}
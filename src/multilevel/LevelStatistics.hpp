@@ -0,0 +1,131 @@
+/**
+* @file LevelStatistics.hpp
+* @brief The LevelStatistics class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_LEVELSTATISTICS_HPP
+#define POROS_SRC_LEVELSTATISTICS_HPP
+
+#include "Base.hpp"
+#include "partition/RefinementStatistics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace poros
+{
+
+/**
+* @brief Collects statistics about each level of multilevel bisection. The
+* statistics of a level are summed over every bisection which reaches it, so
+* comparing consecutive levels shows how quickly coarsening shrinks the graphs
+* and how much refinement improves the cut at each level.
+*/
+class LevelStatistics
+{
+  public:
+    /**
+    * @brief The statistics recorded for a single level.
+    */
+    struct level_struct
+    {
+      uint64_t numBisections;
+      uint64_t numVertices;
+      uint64_t numEdges;
+      uint64_t exposedEdgeWeight;
+      uint64_t initialCut;
+      uint64_t refinedCut;
+      RefinementStatistics refinement;
+    };
+
+    /**
+    * @brief Create an empty set of statistics.
+    */
+    LevelStatistics();
+
+    /**
+    * @brief Record the graph of a bisection at a level.
+    *
+    * @param level The level (counting from 0).
+    * @param numVertices The number of vertices in the graph.
+    * @param numEdges The number of edges in the graph.
+    * @param exposedEdgeWeight The total edge weight of the graph.
+    */
+    void reportGraph(
+        size_t level,
+        vtx_type numVertices,
+        adj_type numEdges,
+        wgt_type exposedEdgeWeight);
+
+    /**
+    * @brief Record the refinement of a bisection at a level. At the coarsest
+    * level the initial bisection is recorded with an empty refinement.
+    *
+    * @param level The level (counting from 0).
+    * @param initialCut The cut before refinement.
+    * @param refinedCut The cut after refinement.
+    * @param refinement The work done by refinement.
+    */
+    void reportRefinement(
+        size_t level,
+        wgt_type initialCut,
+        wgt_type refinedCut,
+        RefinementStatistics const & refinement);
+
+    /**
+    * @brief Discard the statistics of every level.
+    */
+    void clear() noexcept;
+
+    /**
+    * @brief Get the statistics of each level, from the finest to the
+    * coarsest.
+    *
+    * @return The statistics.
+    */
+    std::vector<level_struct> const & levels() const noexcept
+    {
+      return m_levels;
+    }
+
+  private:
+    std::vector<level_struct> m_levels;
+
+    /**
+    * @brief Get the statistics of a level, adding it if needed.
+    *
+    * @param level The level.
+    *
+    * @return The statistics.
+    */
+    level_struct & getLevel(
+        size_t level);
+};
+
+}
+
+#endif
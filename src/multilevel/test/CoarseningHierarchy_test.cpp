@@ -0,0 +1,179 @@
+/**
+* @file CoarseningHierarchy_test.cpp
+* @brief Unit tests for the CoarseningHierarchy class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-25
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "multilevel/CoarseningHierarchy.hpp"
+#include "aggregation/Aggregation.hpp"
+#include "aggregation/SummationContractor.hpp"
+#include "graph/EdgeListGraphBuilder.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+
+namespace poros
+{
+
+namespace
+{
+
+/**
+* @brief Pair up consecutive vertices of a graph into a coarse level.
+*/
+void addPairedLevel(
+    CoarseningHierarchy * const hierarchy,
+    Graph const * const graph)
+{
+  vtx_type const numCoarse = (graph->numVertices()+1)/2;
+  sl::Array<vtx_type> cmap(graph->numVertices());
+  for (vtx_type i = 0; i < graph->numVertices(); ++i) {
+    cmap[i] = static_cast<vtx_type>(i/2);
+  }
+  Aggregation agg(std::move(cmap), numCoarse);
+
+  sl::Array<vtx_type> coarseMap(graph->numVertices());
+  agg.fillCoarseMap(coarseMap.data());
+
+  SummationContractor contractor;
+  hierarchy->addLevel(contractor.contract(graph, &agg), \
+      std::move(coarseMap));
+}
+
+}
+
+
+UNITTEST(CoarseningHierarchy, SaveAndLoad)
+{
+  GridGraphGenerator gen(4, 8, 2);
+  gen.setRandomVertexWeight(1, 3);
+  gen.setRandomEdgeWeight(1, 5);
+  Graph graph = gen.generate();
+
+  CoarseningHierarchy hierarchy(&graph);
+  testTrue(hierarchy.isOf(&graph));
+  addPairedLevel(&hierarchy, &graph);
+  addPairedLevel(&hierarchy, hierarchy.graph(0).get());
+  testEqual(hierarchy.numLevels(), 2u);
+
+  std::string const filename("CoarseningHierarchy_test.hier");
+  hierarchy.save(filename);
+  std::unique_ptr<CoarseningHierarchy> loaded = \
+      CoarseningHierarchy::load(filename);
+  std::remove(filename.c_str());
+
+  testTrue(loaded->isOf(&graph));
+  testEqual(loaded->numLevels(), 2u);
+
+  vtx_type numFine = graph.numVertices();
+  for (size_t level = 0; level < loaded->numLevels(); ++level) {
+    Graph const * const expected = hierarchy.graph(level).get();
+    Graph const * const actual = loaded->graph(level).get();
+
+    testEqual(actual->numVertices(), expected->numVertices());
+    testEqual(actual->numEdges(), expected->numEdges());
+    testEqual(actual->getTotalVertexWeight(), \
+        expected->getTotalVertexWeight());
+    testEqual(actual->getTotalEdgeWeight(), expected->getTotalEdgeWeight());
+    for (adj_type e = 0; e < actual->numEdges(); ++e) {
+      testEqual(actual->getEdgeList()[e], expected->getEdgeList()[e]);
+      testEqual(actual->getEdgeWeight()[e], expected->getEdgeWeight()[e]);
+    }
+    for (vtx_type v = 0; v < numFine; ++v) {
+      testEqual(loaded->coarseMap(level)[v], hierarchy.coarseMap(level)[v]);
+    }
+    numFine = expected->numVertices();
+  }
+}
+
+
+UNITTEST(CoarseningHierarchy, IsOf)
+{
+  Graph graph = GridGraphGenerator(4, 8, 2).generate();
+  Graph other = GridGraphGenerator(8, 4, 3).generate();
+
+  CoarseningHierarchy hierarchy(&graph);
+  testTrue(hierarchy.isOf(&graph));
+  testFalse(hierarchy.isOf(&other));
+}
+
+
+UNITTEST(CoarseningHierarchy, IsOfSameSize)
+{
+  // the paths 0-1-2-3 and 0-2-1-3 have the same sizes and weights
+  EdgeListGraphBuilder builder(4);
+  builder.addEdge(0, 1);
+  builder.addEdge(1, 2);
+  builder.addEdge(2, 3);
+  Graph const graph = builder.finish();
+
+  builder.addEdge(0, 2);
+  builder.addEdge(2, 1);
+  builder.addEdge(1, 3);
+  Graph const other = builder.finish();
+
+  testEqual(other.numEdges(), graph.numEdges());
+  testEqual(other.getTotalEdgeWeight(), graph.getTotalEdgeWeight());
+
+  CoarseningHierarchy hierarchy(&graph);
+  testTrue(hierarchy.isOf(&graph));
+  testFalse(hierarchy.isOf(&other));
+
+  std::string const filename("CoarseningHierarchy_same_size.hier");
+  hierarchy.save(filename);
+  std::unique_ptr<CoarseningHierarchy> loaded = \
+      CoarseningHierarchy::load(filename);
+  std::remove(filename.c_str());
+
+  testTrue(loaded->isOf(&graph));
+  testFalse(loaded->isOf(&other));
+}
+
+
+UNITTEST(CoarseningHierarchy, LoadInvalid)
+{
+  std::string const filename("CoarseningHierarchy_invalid.hier");
+  {
+    std::ofstream stream(filename);
+    stream << "not a hierarchy";
+  }
+
+  bool threw = false;
+  try {
+    CoarseningHierarchy::load(filename);
+  } catch (std::runtime_error const &) {
+    threw = true;
+  }
+  std::remove(filename.c_str());
+
+  testTrue(threw);
+}
+
+
+}
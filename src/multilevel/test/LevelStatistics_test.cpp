@@ -0,0 +1,91 @@
+/**
+* @file LevelStatistics_test.cpp
+* @brief Unit tests for the LevelStatistics class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "multilevel/LevelStatistics.hpp"
+#include "solidutils/UnitTest.hpp"
+
+namespace poros
+{
+
+namespace
+{
+
+RefinementStatistics moves(
+    vtx_type const numMoves)
+{
+  RefinementStatistics stats;
+  stats.reportPass(numMoves);
+  for (vtx_type i = 0; i < numMoves; ++i) {
+    stats.reportMove(1);
+  }
+  stats.reportPassEnd(0, false);
+  stats.reportStop(RefinementStatistics::STOP_MAX_PASSES);
+  return stats;
+}
+
+}
+
+UNITTEST(LevelStatistics, SumsBisections)
+{
+  LevelStatistics stats;
+
+  // two bisections, one of which stops at level 1
+  stats.reportGraph(0, 100, 400, 200);
+  stats.reportGraph(1, 50, 150, 100);
+  stats.reportGraph(2, 20, 40, 30);
+  stats.reportRefinement(2, 6, 6, RefinementStatistics());
+  stats.reportRefinement(1, 10, 8, moves(12));
+  stats.reportRefinement(0, 16, 12, moves(30));
+
+  stats.reportGraph(0, 60, 200, 100);
+  stats.reportGraph(1, 25, 60, 40);
+  stats.reportRefinement(1, 5, 5, RefinementStatistics());
+  stats.reportRefinement(0, 9, 7, moves(4));
+
+  std::vector<LevelStatistics::level_struct> const & levels = stats.levels();
+  testEqual(levels.size(), 3U);
+
+  testEqual(levels[0].numBisections, 2U);
+  testEqual(levels[0].numVertices, 160U);
+  testEqual(levels[0].numEdges, 600U);
+  testEqual(levels[0].exposedEdgeWeight, 300U);
+  testEqual(levels[0].initialCut, 25U);
+  testEqual(levels[0].refinedCut, 19U);
+  testEqual(levels[0].refinement.numMoves(), 34U);
+
+  testEqual(levels[1].numBisections, 2U);
+  testEqual(levels[1].numVertices, 75U);
+  testEqual(levels[1].refinement.numMoves(), 12U);
+  testEqual(levels[1].refinement.numPasses(), 1U);
+
+  testEqual(levels[2].numBisections, 1U);
+  testEqual(levels[2].numVertices, 20U);
+  testEqual(levels[2].initialCut, levels[2].refinedCut);
+}
+
+}
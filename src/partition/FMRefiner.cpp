@@ -31,6 +31,7 @@
 #include "PartitioningAnalyzer.hpp"
 #include "util/VertexQueue.hpp"
 #include "util/VisitTracker.hpp"
+#include "util/TimeScope.hpp"
 
 #include "solidutils/Debug.hpp"
 #include "solidutils/FixedPriorityQueue.hpp"
@@ -50,6 +51,12 @@ namespace poros
 namespace
 {
 
+/**
+* @brief The number of moves to make between checks of the deadline, as
+* reading the clock costs about as much as a move.
+*/
+constexpr vtx_type const DEADLINE_CHECK_INTERVAL = 64;
+
 
 /**
 * @brief Choose the side to move a vertex from.
@@ -152,9 +159,11 @@ void move(
 
 FMRefiner::FMRefiner(
     int const maxRefIters,
-    vtx_type const maxMoves) :
+    vtx_type const maxMoves,
+    Deadline const * const deadline) :
   m_maxRefinementIters(maxRefIters),
-  m_maxMoves(maxMoves)
+  m_maxMoves(maxMoves),
+  m_deadline(deadline)
 {
   // do nothing
 }
@@ -165,7 +174,7 @@ FMRefiner::FMRefiner(
 ******************************************************************************/
 
 
-void FMRefiner::refine(
+RefinementStatistics FMRefiner::refine(
     TargetPartitioning const * const target,
     TwoWayConnectivity * const connectivity,
     Partitioning * const partitioning,
@@ -185,7 +194,21 @@ void FMRefiner::refine(
       std::max(static_cast<vtx_type>(graph->numVertices()*0.01),
                static_cast<vtx_type>(25)));
 
+  RefinementStatistics stats;
+  bool const hasDeadline = m_deadline != nullptr && m_deadline->isSet();
+
+  int stopReason = RefinementStatistics::STOP_MAX_PASSES;
   for (int refIter = 0; refIter < m_maxRefinementIters; ++refIter) {
+    // the deadline only cuts short passes improving a balanced partitioning,
+    // as these passes are also the only ones which balance it
+    bool const startedBalanced = analyzer.isBalanced();
+    if (startedBalanced && hasDeadline && m_deadline->hasPassed()) {
+      stopReason = RefinementStatistics::STOP_DEADLINE;
+      break;
+    }
+
+    TimeScope passScope("Refinement Pass");
+
     DEBUG_MESSAGE(std::string("Cut is ") + \
         std::to_string(partitioning->getCutEdgeWeight()) + \
         std::string(" with balance of ") + \
@@ -201,12 +224,14 @@ void FMRefiner::refine(
       pid_type const side = partitioning->getAssignment(vertex);
       pqs[side].add(-connectivity->getVertexDelta(vertex), vertex);
     }
+    stats.reportPass(connectivity->getBorderVertexSet()->size());
 
     moves.clear();
     wgt_type bestCut = partitioning->getCutEdgeWeight();
     double bestBalance = analyzer.calcMaxImbalance();
 
     vtx_type numMoved = 0;
+    bool deadlinePassed = false;
 
     // move all possible vertices
     while ((pqs[0].size() > 0 || pqs[1].size() > 0) && \
@@ -222,6 +247,8 @@ void FMRefiner::refine(
       visited.visit(vertex.index);
       ASSERT_EQUAL(from, partitioning->getAssignment(vertex));
 
+      stats.reportMove(-connectivity->getVertexDelta(vertex));
+
       if (graph->hasUnitEdgeWeight()) {
         move<false>(vertex, to, graph, partitioning, connectivity, pqs.data(), &visited);
       } else {
@@ -243,10 +270,20 @@ void FMRefiner::refine(
       }
 
       ++numMoved;
+
+      // end the pass early once out of time, keeping its best prefix of
+      // moves as usual (which is balanced if the pass started so)
+      if (startedBalanced && hasDeadline && \
+          numMoved % DEADLINE_CHECK_INTERVAL == 0 && \
+          m_deadline->hasPassed()) {
+        deadlinePassed = true;
+        break;
+      }
     }
 
     DEBUG_MESSAGE(std::string("Undoing ") + std::to_string(moves.size()) + \
         std::string("/") + std::to_string(numMoved) + std::string(" moves."));
+    stats.reportPassEnd(moves.size(), moves.size() >= maxNumBadMoves);
     ASSERT_TRUE(connectivity->verify(graph, partitioning));
 
     // undo bad moves
@@ -266,9 +303,14 @@ void FMRefiner::refine(
     ASSERT_TRUE(connectivity->verify(graph, partitioning));
     ASSERT_EQUAL(partitioning->getCutEdgeWeight(), bestCut);
 
-    if (numMoved == moves.size()) {
+    if (deadlinePassed) {
+      DEBUG_MESSAGE("Out of time, stopping refinement early.");
+      stopReason = RefinementStatistics::STOP_DEADLINE;
+      break;
+    } else if (numMoved == moves.size()) {
       // no improvement
       DEBUG_MESSAGE("Kept zero moves, stopping refinement early.");
+      stopReason = RefinementStatistics::STOP_NO_IMPROVEMENT;
       break;
     }
 
@@ -280,7 +322,10 @@ void FMRefiner::refine(
       visited.clear();
     }
   }
-   
+
+  stats.reportStop(stopReason);
+
+  return stats;
 }
 
 
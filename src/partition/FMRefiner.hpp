@@ -33,6 +33,7 @@
 
 #include "ITwoWayRefiner.hpp"
 #include "TargetPartitioning.hpp"
+#include "util/Deadline.hpp"
 
 
 namespace poros
@@ -49,10 +50,14 @@ class FMRefiner : public ITwoWayRefiner
     *
     * @param maxIters The maximum number of refinement iterations.
     * @param maxMoves The maximum number of bad moves to make.
+    * @param deadline The deadline to stop refining by (may be null). It must
+    * outlive this refiner. Passes are still made past it until the
+    * partitioning is balanced.
     */
     FMRefiner(
         int maxIters,
-        vtx_type maxMoves); 
+        vtx_type maxMoves,
+        Deadline const * deadline = nullptr); 
 
 
     /**
@@ -63,8 +68,10 @@ class FMRefiner : public ITwoWayRefiner
     * @param connectivity The connectivity.
     * @param partitioning The current partitioning.
     * @param graph The graph.
+    *
+    * @return A record of the work done.
     */
-    void refine(
+    RefinementStatistics refine(
         TargetPartitioning const * target,
         TwoWayConnectivity * connectivity,
         Partitioning * partitioning,
@@ -73,6 +80,13 @@ class FMRefiner : public ITwoWayRefiner
   private:
     int m_maxRefinementIters;
     vtx_type m_maxMoves;
+    Deadline const * m_deadline;
+
+    // disable copying
+    FMRefiner(
+        FMRefiner const & rhs) = delete;
+    FMRefiner & operator=(
+        FMRefiner const & rhs) = delete;
 };
 
 }
@@ -34,6 +34,7 @@
 #include "TargetPartitioning.hpp"
 #include "Partitioning.hpp"
 #include "TwoWayConnectivity.hpp"
+#include "RefinementStatistics.hpp"
 #include "graph/Graph.hpp"
 
 
@@ -59,8 +60,10 @@ class ITwoWayRefiner
     * @param partitioning The partitioning (input and output).
     * @param connectivity The connectivity of vertices to the partitions.
     * @param graph The graph.
+    *
+    * @return A record of the work done.
     */
-    virtual void refine(
+    virtual RefinementStatistics refine(
         TargetPartitioning const * target,
         TwoWayConnectivity * connectivity,
         Partitioning * partitioning,
@@ -28,11 +28,15 @@
 
 #include "partition/MultilevelBisector.hpp"
 #include "multilevel/DiscreteCoarseGraph.hpp"
+#include "aggregation/ContractorFactory.hpp"
 #include "partition/TwoWayConnectivity.hpp"
 #include "multilevel/CompositeStoppingCriteria.hpp"
 #include "multilevel/EdgeRatioStoppingCriteria.hpp"
 #include "multilevel/VertexNumberStoppingCriteria.hpp"
 
+#include "util/MemoryScope.hpp"
+#include "util/TimeScope.hpp"
+
 #include "solidutils/Timer.hpp"
 
 #include <iostream>
@@ -41,6 +45,34 @@ namespace poros
 {
 
 
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief The number of vertices to coarsen to. We know we'll have two
+* partitions -- keep 10 in each.
+*/
+vtx_type const TARGET_NUM_VERTICES = 20;
+
+/**
+* @brief The fraction of its fine graph's edges a coarse graph may keep before
+* coarsening stops.
+*/
+double const EDGE_RATIO = 0.95;
+
+/**
+* @brief The maximum weight of a coarse vertex, relative to the average of a
+* graph of TARGET_NUM_VERTICES.
+*/
+double const MAX_VERTEX_WEIGHT_FACTOR = 1.5;
+
+}
+
+
 /******************************************************************************
 * CONSTRUCTORS / DESTRUCTOR ***************************************************
 ******************************************************************************/
@@ -50,10 +82,30 @@ MultilevelBisector::MultilevelBisector(
     std::unique_ptr<IBisector> initialBisector,
     std::unique_ptr<ITwoWayRefiner> refiner,
     std::shared_ptr<TimeKeeper> timeKeeper) :
+  MultilevelBisector(std::move(aggregator), ContractorFactory::make(), \
+      std::move(initialBisector), std::move(refiner), timeKeeper)
+{
+  // do nothing
+}
+
+
+MultilevelBisector::MultilevelBisector(
+    std::unique_ptr<IAggregator> aggregator,
+    std::unique_ptr<IContractor> contractor,
+    std::unique_ptr<IBisector> initialBisector,
+    std::unique_ptr<ITwoWayRefiner> refiner,
+    std::shared_ptr<TimeKeeper> timeKeeper) :
   m_aggregator(std::move(aggregator)),
+  m_contractor(std::move(contractor)),
   m_initialBisector(std::move(initialBisector)),
   m_refiner(std::move(refiner)),
-  m_timeKeeper(timeKeeper)
+  m_timeKeeper(timeKeeper),
+  m_hierarchy(nullptr),
+  m_statistics(nullptr),
+  m_progress(nullptr),
+  m_targetNumVertices(TARGET_NUM_VERTICES),
+  m_edgeRatio(EDGE_RATIO),
+  m_maxVertexWeightFactor(MAX_VERTEX_WEIGHT_FACTOR)
 {
   // do nothing
 }
@@ -70,18 +122,13 @@ Partitioning MultilevelBisector::execute(
 {
   CompositeStoppingCriteria criteria;
 
-  AggregationParameters params;
-
-  // we know we'll have two partitions -- keep 10 in each
-  vtx_type const targetNumVertices = 20;
+  AggregationParameters const params = aggregationParameters(graph, \
+      m_targetNumVertices, m_maxVertexWeightFactor);
 
   criteria.add(std::unique_ptr<IStoppingCriteria>(
-      new VertexNumberStoppingCriteria(targetNumVertices)));
+      new VertexNumberStoppingCriteria(m_targetNumVertices)));
   criteria.add(std::unique_ptr<IStoppingCriteria>(
-      new EdgeRatioStoppingCriteria(0.95)));
-
-  params.setMaxVertexWeight(static_cast<wgt_type>( \
-      (1.5 * graph->getTotalVertexWeight()) / targetNumVertices));
+      new EdgeRatioStoppingCriteria(m_edgeRatio)));
 
   PartitioningInformation partInfo = \
       recurse(0, params, &criteria, target, nullptr, graph);
@@ -90,6 +137,56 @@ Partitioning MultilevelBisector::execute(
 }
 
 
+void MultilevelBisector::setHierarchy(
+    CoarseningHierarchy * const hierarchy) noexcept
+{
+  m_hierarchy = hierarchy;
+}
+
+
+void MultilevelBisector::setStatistics(
+    LevelStatistics * const statistics) noexcept
+{
+  m_statistics = statistics;
+}
+
+
+void MultilevelBisector::setProgress(
+    ProgressMonitor * const progress) noexcept
+{
+  m_progress = progress;
+}
+
+
+void MultilevelBisector::setCoarsening(
+    vtx_type const targetNumVertices,
+    double const edgeRatio,
+    double const maxVertexWeightFactor) noexcept
+{
+  m_targetNumVertices = targetNumVertices;
+  m_edgeRatio = edgeRatio;
+  m_maxVertexWeightFactor = maxVertexWeightFactor;
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+AggregationParameters MultilevelBisector::aggregationParameters(
+    Graph const * const graph,
+    vtx_type const targetNumVertices,
+    double const maxVertexWeightFactor)
+{
+  AggregationParameters params;
+  params.setMaxVertexWeight(static_cast<wgt_type>( \
+      (maxVertexWeightFactor * graph->getTotalVertexWeight()) / \
+      targetNumVertices));
+
+  return params;
+}
+
+
 /******************************************************************************
 * PROTECTED METHODS ***********************************************************
 ******************************************************************************/
@@ -108,44 +205,143 @@ PartitioningInformation MultilevelBisector::recurse(
       " edges, with an exposed weight of " +
       std::to_string(graph->getTotalEdgeWeight()) + ".");
 
+  TimeScope levelScope("Level", level);
+
+  if (m_statistics != nullptr) {
+    m_statistics->reportGraph(level, graph->numVertices(), \
+        graph->numEdges(), graph->getTotalEdgeWeight());
+  }
+
   if (stoppingCriteria->shouldStop(level, parent, graph)) {
+    MemoryScope memoryScope(MemoryKeeper::INITIAL_PARTITIONING);
     Partitioning part = m_initialBisector->execute(target, graph);
+    if (m_statistics != nullptr) {
+      m_statistics->reportRefinement(level, part.getCutEdgeWeight(), \
+          part.getCutEdgeWeight(), RefinementStatistics());
+    }
     TwoWayConnectivity conn = \
         TwoWayConnectivity::fromPartitioning(graph, &part);
+    if (m_progress != nullptr) {
+      m_progress->report(INITIAL_PARTITIONING_PHASE, level);
+    }
     return PartitioningInformation(std::move(part), std::move(conn));
   } else {
-    sl::Timer coarsenTmr;
-    coarsenTmr.start();
-    Aggregation agg = m_aggregator->aggregate(params, graph);
+    // the coarse graph and its partitioning are released before refining
+    // this level, so they do not add to the peak memory usage
+    PartitioningInformation finePartInfo = coarsenAndProject( \
+        level, params, stoppingCriteria, target, graph);
+
+    MemoryScope memoryScope(MemoryKeeper::REFINEMENT);
+
+    wgt_type const initialCut = \
+        finePartInfo.partitioning()->getCutEdgeWeight();
+
+    sl::Timer refineTmr;
+    refineTmr.start();
+    RefinementStatistics const refinement = m_refiner->refine(target, \
+        finePartInfo.connectivity(), finePartInfo.partitioning(), graph);
+    refineTmr.stop();
+    m_timeKeeper->reportTime(TimeKeeper::UNCOARSENING, refineTmr.poll());
+
+    if (m_statistics != nullptr) {
+      m_statistics->reportRefinement(level, initialCut, \
+          finePartInfo.partitioning()->getCutEdgeWeight(), refinement);
+    }
+    if (m_progress != nullptr) {
+      m_progress->report(REFINEMENT_PHASE, level);
+    }
+
+    return finePartInfo;
+  }
+}
+
+
+PartitioningInformation MultilevelBisector::coarsenAndProject(
+    int const level,
+    AggregationParameters const params,
+    IStoppingCriteria const * const stoppingCriteria,
+    TargetPartitioning const * const target,
+    Graph const * const graph)
+{
+  std::unique_ptr<ICoarseGraph> coarse = coarsen(level, params, graph);
+  if (m_progress != nullptr) {
+    m_progress->report(COARSENING_PHASE, level+1);
+  }
 
-    sl::Timer contractTmr;
-    contractTmr.start();
-    DiscreteCoarseGraph coarse(graph, &agg);
-    contractTmr.stop();
-    m_timeKeeper->reportTime(TimeKeeper::CONTRACTION, contractTmr.poll());
+  // recurse
+  PartitioningInformation coarsePartInfo = recurse( \
+      level+1, params, stoppingCriteria, target, graph, coarse->graph());
 
-    coarsenTmr.stop();
-    m_timeKeeper->reportTime(TimeKeeper::COARSENING, coarsenTmr.poll());
+  MemoryScope memoryScope(MemoryKeeper::REFINEMENT);
+  TimeScope timeScope(TimeKeeper::PROJECTION);
 
-    // recurse
-    PartitioningInformation coarsePartInfo = recurse( \
-        level+1, params, stoppingCriteria, target, graph, coarse.graph());
+  sl::Timer projectTmr;
+  projectTmr.start();
+  PartitioningInformation finePartInfo = coarse->project(&coarsePartInfo);
+  projectTmr.stop();
+  m_timeKeeper->reportTime(TimeKeeper::PROJECTION, projectTmr.poll());
+  m_timeKeeper->reportTime(TimeKeeper::UNCOARSENING, projectTmr.poll());
 
-    sl::Timer uncoarsenTmr;
-    uncoarsenTmr.start();
+  return finePartInfo;
+}
 
-    sl::Timer projectTmr;
-    projectTmr.start();
-    PartitioningInformation finePartInfo = coarse.project(&coarsePartInfo);
-    projectTmr.stop();
-    m_timeKeeper->reportTime(TimeKeeper::PROJECTION, projectTmr.poll());
 
-    m_refiner->refine(target, finePartInfo.connectivity(),
-        finePartInfo.partitioning(), graph);
-    uncoarsenTmr.stop();
-    m_timeKeeper->reportTime(TimeKeeper::UNCOARSENING, uncoarsenTmr.poll());
+std::unique_ptr<ICoarseGraph> MultilevelBisector::coarsen(
+    int const level,
+    AggregationParameters const params,
+    Graph const * const graph)
+{
+  MemoryScope memoryScope(MemoryKeeper::COARSENING);
+  TimeScope timeScope(TimeKeeper::COARSENING);
 
-    return finePartInfo;
+  bool const useHierarchy = inHierarchy(level, graph);
+  if (useHierarchy && static_cast<size_t>(level) < m_hierarchy->numLevels()) {
+    return std::unique_ptr<ICoarseGraph>(new DiscreteCoarseGraph(graph, \
+        m_hierarchy->graph(level), m_hierarchy->coarseMap(level)));
+  }
+
+  sl::Timer coarsenTmr;
+  coarsenTmr.start();
+  Aggregation agg = m_aggregator->aggregate(params, graph);
+
+  sl::Timer contractTmr;
+  contractTmr.start();
+  TimeScope contractScope(TimeKeeper::CONTRACTION);
+  std::unique_ptr<ICoarseGraph> coarse;
+  if (useHierarchy) {
+    // keep the level in the hierarchy, so that it outlives this bisection
+    sl::Array<vtx_type> coarseMap(graph->numVertices());
+    agg.fillCoarseMap(coarseMap.data());
+    m_hierarchy->addLevel(m_contractor->contract(graph, &agg), \
+        std::move(coarseMap));
+    coarse.reset(new DiscreteCoarseGraph(graph, m_hierarchy->graph(level), \
+        m_hierarchy->coarseMap(level)));
+  } else {
+    coarse.reset(new DiscreteCoarseGraph(graph, &agg, m_contractor.get()));
+  }
+  contractTmr.stop();
+  m_timeKeeper->reportTime(TimeKeeper::CONTRACTION, contractTmr.poll());
+
+  coarsenTmr.stop();
+  m_timeKeeper->reportTime(TimeKeeper::COARSENING, coarsenTmr.poll());
+
+  return coarse;
+}
+
+
+bool MultilevelBisector::inHierarchy(
+    int const level,
+    Graph const * const graph) const noexcept
+{
+  if (m_hierarchy == nullptr) {
+    return false;
+  } else if (level == 0) {
+    return m_hierarchy->isOf(graph);
+  } else {
+    // coarse graphs in the hierarchy are only ever reached by coarsening the
+    // previous level of it
+    return static_cast<size_t>(level) <= m_hierarchy->numLevels() && \
+        m_hierarchy->graph(level-1).get() == graph;
   }
 }
 
@@ -33,10 +33,15 @@
 
 #include "partition/IBisector.hpp"
 #include "aggregation/IAggregator.hpp"
+#include "aggregation/IContractor.hpp"
 #include "partition/ITwoWayRefiner.hpp"
 #include "partition/PartitioningInformation.hpp"
 #include "multilevel/IStoppingCriteria.hpp"
+#include "multilevel/ICoarseGraph.hpp"
+#include "multilevel/CoarseningHierarchy.hpp"
+#include "multilevel/LevelStatistics.hpp"
 #include "util/TimeKeeper.hpp"
+#include "util/ProgressMonitor.hpp"
 
 #include <memory>
 
@@ -61,6 +66,22 @@ class MultilevelBisector : public IBisector
         std::shared_ptr<TimeKeeper> timeKeeper);
 
 
+    /**
+    * @brief Create a new multilevel bisector.
+    *
+    * @param aggregator The aggregation scheme to use.
+    * @param contractor The contractor to build coarse graphs with.
+    * @param initialBisector The initial bisector to use.
+    * @param refiner The refinement scheme to use.
+    */
+    MultilevelBisector(
+        std::unique_ptr<IAggregator> aggregator,
+        std::unique_ptr<IContractor> contractor,
+        std::unique_ptr<IBisector> initialBisector,
+        std::unique_ptr<ITwoWayRefiner> refiner,
+        std::shared_ptr<TimeKeeper> timeKeeper);
+
+
     /**
      * @brief Create a two-way partitioning of the graph.
      *
@@ -73,6 +94,77 @@ class MultilevelBisector : public IBisector
         TargetPartitioning const * target,
         Graph const * graph) override;
 
+
+    /**
+    * @brief Set a coarsening hierarchy to use when bisecting the graph it
+    * belongs to. Levels already in the hierarchy are re-used rather than
+    * coarsening the graph again, and any new levels are added to it. Other
+    * graphs are coarsened as usual.
+    *
+    * @param hierarchy The hierarchy (may be null to stop using one). It must
+    * outlive this bisector.
+    */
+    void setHierarchy(
+        CoarseningHierarchy * hierarchy) noexcept;
+
+
+    /**
+    * @brief Set the statistics to add the levels of each bisection to.
+    *
+    * @param statistics The statistics (may be null to stop recording them).
+    * They must outlive this bisector.
+    */
+    void setStatistics(
+        LevelStatistics * statistics) noexcept;
+
+
+    /**
+    * @brief Set the monitor to report the progress of each bisection to.
+    *
+    * @param progress The monitor (may be null to stop reporting). It must
+    * outlive this bisector.
+    */
+    void setProgress(
+        ProgressMonitor * progress) noexcept;
+
+
+    /**
+    * @brief Set when to stop coarsening, and how heavy coarse vertices may
+    * become. By default, graphs are coarsened to 20 vertices, or until a
+    * coarse graph keeps more than 95% of the edges of its fine graph, and
+    * coarse vertices may weigh 1.5 times the average of a graph of 20
+    * vertices.
+    *
+    * @param targetNumVertices The number of vertices to coarsen down to.
+    * @param edgeRatio The fraction of the fine edges kept by a coarse graph
+    * at which to stop coarsening.
+    * @param maxVertexWeightFactor The maximum weight of a coarse vertex,
+    * relative to the average weight of a vertex of a graph of
+    * `targetNumVertices`.
+    */
+    void setCoarsening(
+        vtx_type targetNumVertices,
+        double edgeRatio,
+        double maxVertexWeightFactor) noexcept;
+
+
+    /**
+    * @brief Get the parameters used to aggregate a graph and each of its
+    * coarser levels.
+    *
+    * @param graph The graph to bisect.
+    * @param targetNumVertices The number of vertices to coarsen down to.
+    * @param maxVertexWeightFactor The maximum weight of a coarse vertex,
+    * relative to the average weight of a vertex of a graph of
+    * `targetNumVertices`.
+    *
+    * @return The aggregation parameters.
+    */
+    static AggregationParameters aggregationParameters(
+        Graph const * graph,
+        vtx_type targetNumVertices,
+        double maxVertexWeightFactor);
+
   protected:
     /**
      * @brief Recurse to a new level.
@@ -94,11 +186,71 @@ class MultilevelBisector : public IBisector
         Graph const * parent,
         Graph const * graph);
 
+    /**
+     * @brief Coarsen a graph, partition the coarse graph, and project the
+     * partitioning back to this graph. The coarse graph and its partitioning
+     * are released before returning.
+     *
+     * @param level The level number of the graph (counting from 0).
+     * @param params The aggregation parameters.
+     * @param stoppingCriteria The stopping criteria for coarsening.
+     * @param target The target partitioning.
+     * @param graph The graph to coarsen.
+     *
+     * @return The unrefined partitioning information of the graph.
+     */
+    PartitioningInformation coarsenAndProject(
+        int level,
+        AggregationParameters params,
+        IStoppingCriteria const * stoppingCriteria,
+        TargetPartitioning const * target,
+        Graph const * graph);
+
+    /**
+     * @brief Aggregate and contract a graph. The aggregation is released
+     * before returning, leaving only the coarse graph and its coarse map.
+     *
+     * @param level The level number of the graph (counting from 0).
+     * @param params The aggregation parameters.
+     * @param graph The graph to coarsen.
+     *
+     * @return The coarse graph.
+     */
+    std::unique_ptr<ICoarseGraph> coarsen(
+        int level,
+        AggregationParameters params,
+        Graph const * graph);
+
+    /**
+     * @brief Check if a graph is part of the coarsening hierarchy.
+     *
+     * @param level The level number of the graph (counting from 0).
+     * @param graph The graph.
+     *
+     * @return True if coarsening the graph should use the hierarchy.
+     */
+    bool inHierarchy(
+        int level,
+        Graph const * graph) const noexcept;
+
   private:
     std::unique_ptr<IAggregator> m_aggregator;
+    std::unique_ptr<IContractor> m_contractor;
     std::unique_ptr<IBisector> m_initialBisector;
     std::unique_ptr<ITwoWayRefiner> m_refiner;
     std::shared_ptr<TimeKeeper> m_timeKeeper;
+    CoarseningHierarchy * m_hierarchy;
+    LevelStatistics * m_statistics;
+    ProgressMonitor * m_progress;
+    vtx_type m_targetNumVertices;
+    double m_edgeRatio;
+    double m_maxVertexWeightFactor;
+
+    // disable copying
+    MultilevelBisector(
+        MultilevelBisector const & rhs) = delete;
+    MultilevelBisector & operator=(
+        MultilevelBisector const & rhs) = delete;
 };
 
 
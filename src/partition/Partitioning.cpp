@@ -27,6 +27,7 @@
 
 
 #include "Partitioning.hpp"
+#include "util/MemoryPolicy.hpp"
 
 
 namespace poros
@@ -87,8 +88,10 @@ Partitioning::Partitioning(
     Graph const * const graph) :
   m_cutEdgeWeight(0),
   m_partitionWeight(numParts, 0),
-  m_assignment(graph->numVertices(), NULL_PID),
-  m_graph(graph)
+  m_assignment(MemoryPolicy::allocate<pid_type>(graph->numVertices(), \
+      NULL_PID)),
+  m_graph(graph),
+  m_memory(numParts*sizeof(wgt_type) + graph->numVertices()*sizeof(pid_type))
 {
   ASSERT_GREATER(numParts, 0);
 }
@@ -101,7 +104,8 @@ Partitioning::Partitioning(
   m_cutEdgeWeight(0),
   m_partitionWeight(numParts, 0),
   m_assignment(std::move(partitionLabels)),
-  m_graph(graph)
+  m_graph(graph),
+  m_memory(numParts*sizeof(wgt_type) + m_assignment.size()*sizeof(pid_type))
 {
   ASSERT_GREATER(numParts, 0);
 
@@ -33,6 +33,7 @@
 #include "Base.hpp"
 #include "Partition.hpp"
 #include "graph/Graph.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/Debug.hpp"
 #include "solidutils/Array.hpp"
 
@@ -447,6 +448,8 @@ class Partitioning
 
     Graph const * m_graph;
 
+    TrackedMemory m_memory;
+
 
 
 };
@@ -32,8 +32,13 @@
 #include "graph/SubgraphExtractor.hpp"
 #include "partition/TargetPartitioning.hpp"
 #include "partition/PartitioningAnalyzer.hpp"
+#include "util/MemoryScope.hpp"
+#include "util/TimeScope.hpp"
+#include "util/MemoryPolicy.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/VectorMath.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -41,18 +46,159 @@ namespace poros
 {
 
 
+/******************************************************************************
+* TYPES ***********************************************************************
+******************************************************************************/
+
+/**
+* @brief The working buffers for in-place recursion. A slice starting at
+* vertex v and partition offset p uses the prefix slots starting at v+p, so
+* that each of the at most k slices at a level has its own extra slot.
+*/
+struct RecursiveBisectionPartitioner::workspace_struct
+{
+  struct buffer_struct
+  {
+    sl::Array<adj_type> edgePrefix;
+    sl::Array<vtx_type> edgeList;
+    sl::Array<wgt_type> vertexWeight;
+    sl::Array<wgt_type> edgeWeight;
+    sl::Array<vtx_type> labels;
+
+    buffer_struct() :
+      edgePrefix(),
+      edgeList(),
+      vertexWeight(),
+      edgeWeight(),
+      labels()
+    {
+      // do nothing
+    }
+  };
+
+  buffer_struct buffers[2];
+  sl::Array<vtx_type> subMap;
+  TrackedMemory memory;
+  vtx_type numVertices;
+  adj_type numEdges;
+  pid_type numParts;
+  bool hasVertexWeights;
+  bool hasEdgeWeights;
+
+  workspace_struct(
+      vtx_type const maxNumVertices,
+      adj_type const maxNumEdges,
+      pid_type const maxNumParts,
+      bool const vertexWeights,
+      bool const edgeWeights) :
+    buffers(),
+    subMap(maxNumVertices),
+    memory(),
+    numVertices(maxNumVertices),
+    numEdges(maxNumEdges),
+    numParts(maxNumParts),
+    hasVertexWeights(vertexWeights),
+    hasEdgeWeights(edgeWeights)
+  {
+    MemoryScope memoryScope(MemoryKeeper::EXTRACTION);
+
+    size_t bytes = numVertices*sizeof(vtx_type);
+    for (buffer_struct & buffer : buffers) {
+      buffer.edgePrefix = sl::Array<adj_type>(numVertices+numParts+1);
+      buffer.edgeList = MemoryPolicy::allocate<vtx_type>(numEdges);
+      buffer.labels = sl::Array<vtx_type>(numVertices);
+      if (hasVertexWeights) {
+        buffer.vertexWeight = sl::Array<wgt_type>(numVertices);
+      }
+      if (hasEdgeWeights) {
+        buffer.edgeWeight = MemoryPolicy::allocate<wgt_type>(numEdges);
+      }
+
+      bytes += buffer.edgePrefix.size()*sizeof(adj_type) + \
+          buffer.edgeList.size()*sizeof(vtx_type) + \
+          buffer.labels.size()*sizeof(vtx_type) + \
+          buffer.vertexWeight.size()*sizeof(wgt_type) + \
+          buffer.edgeWeight.size()*sizeof(wgt_type);
+    }
+
+    memory.add(bytes);
+  }
+
+  bool fits(
+      Graph const * const graph,
+      pid_type const maxNumParts) const noexcept
+  {
+    return graph->numVertices() <= numVertices && \
+        graph->numEdges() <= numEdges && maxNumParts <= numParts && \
+        (graph->hasUnitVertexWeight() || hasVertexWeights) && \
+        (graph->hasUnitEdgeWeight() || hasEdgeWeights);
+  }
+};
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+std::vector<Subgraph> extractPartitions(
+    Graph const * const graph,
+    Partitioning const * const bisection,
+    vtx_type const * const superMap)
+{
+  MemoryScope memoryScope(MemoryKeeper::EXTRACTION);
+  TimeScope timeScope("Extraction");
+  return SubgraphExtractor::partitions(graph, bisection, superMap);
+}
+
+
+Subgraph extractPartition(
+    Graph const * const graph,
+    Partitioning const * const bisection,
+    pid_type const part,
+    vtx_type const * const superMap)
+{
+  MemoryScope memoryScope(MemoryKeeper::EXTRACTION);
+  TimeScope timeScope("Extraction");
+  return SubgraphExtractor::partition(graph, bisection, part, superMap);
+}
+
+
+TargetPartitioning makeHalfTarget(
+    TargetPartitioning const * const target,
+    pid_type const * const numPartsPrefix,
+    pid_type const part)
+{
+  pid_type const numHalfParts = numPartsPrefix[part+1] - \
+      numPartsPrefix[part];
+
+  sl::Array<wgt_type> halfWeights(numHalfParts);
+  sl::Array<wgt_type> halfMaxs(numHalfParts);
+  for (pid_type pid = 0; pid < numHalfParts; ++pid) {
+    pid_type const offset = numPartsPrefix[part];
+    halfWeights[pid] = target->getTargetWeight(pid+offset);
+    halfMaxs[pid] = target->getMaxWeight(pid+offset);
+  }
+
+  return TargetPartitioning(numHalfParts, std::move(halfWeights), \
+      std::move(halfMaxs));
+}
+
+}
+
+
 /******************************************************************************
 * PRIVATE METHODS *************************************************************
 ******************************************************************************/
 
-void RecursiveBisectionPartitioner::recurse(
-    pid_type * const partitionLabels,
+Partitioning RecursiveBisectionPartitioner::bisect(
     TargetPartitioning const * const target,
-    IMappedGraph const * const mappedGraph,
-    pid_type const offset)
+    Graph const * const graph,
+    int const depth,
+    pid_type * const numPartsPrefix)
 {
-  Graph const * const graph = mappedGraph->getGraph();
-  
   pid_type const numParts = target->numPartitions();
 
   // We don't want to use the k-way imbalance tolerance, as if one half of the
@@ -63,8 +209,7 @@ void RecursiveBisectionPartitioner::recurse(
   double const toleranceFactor = 1.0 / std::log2(target->numPartitions());
 
   // calculate target fractions
-  sl::Array<pid_type> numPartsPrefix(3);
-  numPartsPrefix.set(0);
+  std::fill(numPartsPrefix, numPartsPrefix+3, 0);
 
   sl::Array<wgt_type> targetBisectWeights(NUM_BISECTION_PARTS, 0);
   sl::Array<wgt_type> maxBisectWeights(NUM_BISECTION_PARTS, 0);
@@ -77,13 +222,16 @@ void RecursiveBisectionPartitioner::recurse(
     ++numPartsPrefix[half];
   }
 
-  sl::VectorMath::prefixSumExclusive(numPartsPrefix.data(), \
-      numPartsPrefix.size());
+  sl::VectorMath::prefixSumExclusive(numPartsPrefix, 3);
 
   // build parameters for bisection
   TargetPartitioning bisectTarget(NUM_BISECTION_PARTS, \
       std::move(targetBisectWeights), std::move(maxBisectWeights));
 
+  if (m_progress != nullptr) {
+    m_progress->setDepth(depth);
+  }
+
   // calculate the target weight for each side bisect
   Partitioning bisection = m_bisector->execute(&bisectTarget, graph);
   PartitioningAnalyzer analyzer(&bisection, &bisectTarget);
@@ -102,6 +250,26 @@ void RecursiveBisectionPartitioner::recurse(
   // NOTE: this requires that for uneven number of parts, latter half has more
   ASSERT_GREATEREQUAL(numPartsPrefix[2]-numPartsPrefix[1], \
       numPartsPrefix[1]-numPartsPrefix[0]);
+
+  return bisection;
+}
+
+
+void RecursiveBisectionPartitioner::recurse(
+    pid_type * const partitionLabels,
+    TargetPartitioning const * const target,
+    IMappedGraph const * const mappedGraph,
+    pid_type const offset,
+    int const depth)
+{
+  Graph const * const graph = mappedGraph->getGraph();
+  
+  pid_type const numParts = target->numPartitions();
+  TimeScope nodeScope("Partitions", offset, offset+numParts-1);
+
+  pid_type numPartsPrefix[3];
+  Partitioning bisection = bisect(target, graph, depth, numPartsPrefix);
+
   mappedGraph->mapPartitioning(&bisection, partitionLabels, offset);
 
   if (numParts > 2) {
@@ -111,31 +279,163 @@ void RecursiveBisectionPartitioner::recurse(
     if ( (subgraphPtr = dynamic_cast<Subgraph const *>(mappedGraph)) ) {
       superMap = subgraphPtr->getSuperMap();
     }
-    std::vector<Subgraph> parts = SubgraphExtractor::partitions(graph, \
-        &bisection, superMap);
 
-    ASSERT_EQUAL(parts.size(), NUM_BISECTION_PARTS);
+    std::vector<Subgraph> parts;
+    if (m_extraction == EXTRACT_TOGETHER) {
+      parts = extractPartitions(graph, &bisection, superMap);
+      ASSERT_EQUAL(parts.size(), NUM_BISECTION_PARTS);
+    }
 
-    for (pid_type part = 0; part < parts.size(); ++part) {
+    for (pid_type part = 0; part < NUM_BISECTION_PARTS; ++part) {
       pid_type const numHalfParts = numPartsPrefix[part+1] - \
           numPartsPrefix[part];
 
       if (numHalfParts > 1) {
         // recursively call execute
-        sl::Array<wgt_type> halfWeights(numHalfParts);
-        sl::Array<wgt_type> halfMaxs(numHalfParts);
-        for (pid_type pid = 0; pid < numHalfParts; ++pid) {
-          pid_type const offset = numPartsPrefix[part];
-          halfWeights[pid] = target->getTargetWeight(pid+offset);
-          halfMaxs[pid] = target->getMaxWeight(pid+offset);
+        TargetPartitioning const subTarget = makeHalfTarget(target, \
+            numPartsPrefix, part);
+
+        if (m_extraction == EXTRACT_SEQUENTIALLY) {
+          Subgraph const half = extractPartition(graph, &bisection, part, \
+              superMap);
+          recurse(partitionLabels, &subTarget, &half, \
+              offset+numPartsPrefix[part], depth+1);
+        } else {
+          recurse(partitionLabels, &subTarget, &(parts[part]), \
+              offset+numPartsPrefix[part], depth+1);
         }
-        TargetPartitioning subTarget(numHalfParts, \
-            std::move(halfWeights),
-            std::move(halfMaxs));
+      }
+    }
+  }
+}
+
+
+void RecursiveBisectionPartitioner::recurseInPlace(
+    pid_type * const partitionLabels,
+    TargetPartitioning const * const target,
+    Graph const * const graph,
+    vtx_type const * const labels,
+    vtx_type const vertexStart,
+    adj_type const edgeStart,
+    pid_type const offset,
+    workspace_struct * const workspace,
+    size_t const output,
+    int const depth)
+{
+  pid_type const numParts = target->numPartitions();
+  TimeScope nodeScope("Partitions", offset, offset+numParts-1);
 
-        recurse(partitionLabels, &subTarget, &(parts[part]), \
-            offset+numPartsPrefix[part]);
+  pid_type numPartsPrefix[3];
+  Partitioning const bisection = bisect(target, graph, depth, \
+      numPartsPrefix);
+
+  for (Vertex const vertex : graph->vertices()) {
+    vtx_type const super = labels ? labels[vertex.index] : vertex.index;
+    partitionLabels[super] = bisection.getAssignment(vertex) + offset;
+  }
+
+  if (numParts <= 2) {
+    return;
+  }
+
+  workspace_struct::buffer_struct & buffer = workspace->buffers[output];
+
+  // number the vertices of each half in order, so the halves match those
+  // made by the SubgraphExtractor
+  vtx_type * const subMap = workspace->subMap.data() + vertexStart;
+  vtx_type halfVertices[NUM_BISECTION_PARTS] = {0, 0};
+  for (Vertex const vertex : graph->vertices()) {
+    subMap[vertex.index] = halfVertices[bisection.getAssignment(vertex)]++;
+  }
+
+  vtx_type halfVertexStart[NUM_BISECTION_PARTS];
+  adj_type halfEdgeStart[NUM_BISECTION_PARTS];
+  adj_type halfEdges[NUM_BISECTION_PARTS] = {0, 0};
+  pid_type halfOffset[NUM_BISECTION_PARTS];
+
+  {
+    TimeScope timeScope("Extraction");
+
+    // copy out each half which needs to be partitioned further -- both must be
+    // copied before either is recursed on, as the recursion overwrites this
+    // graph's slice
+    vtx_type nextVertex = vertexStart;
+    adj_type nextEdge = edgeStart;
+    for (pid_type part = 0; part < NUM_BISECTION_PARTS; ++part) {
+      halfVertexStart[part] = nextVertex;
+      halfEdgeStart[part] = nextEdge;
+      halfOffset[part] = offset + numPartsPrefix[part];
+      nextVertex += halfVertices[part];
+
+      pid_type const numHalfParts = numPartsPrefix[part+1] - \
+          numPartsPrefix[part];
+      if (numHalfParts <= 1) {
+        continue;
+      }
+
+      adj_type * const prefix = buffer.edgePrefix.data() + \
+          halfVertexStart[part] + halfOffset[part];
+      vtx_type * const edgeList = buffer.edgeList.data() + nextEdge;
+      wgt_type * const edgeWeight = graph->hasUnitEdgeWeight() ? nullptr : \
+          buffer.edgeWeight.data() + nextEdge;
+      wgt_type * const vertexWeight = graph->hasUnitVertexWeight() ? \
+          nullptr : buffer.vertexWeight.data() + halfVertexStart[part];
+      vtx_type * const halfLabels = buffer.labels.data() + \
+          halfVertexStart[part];
+
+      adj_type numEdges = 0;
+      prefix[0] = 0;
+      for (Vertex const vertex : graph->vertices()) {
+        if (bisection.getAssignment(vertex) == part) {
+          vtx_type const subV = subMap[vertex.index];
+
+          halfLabels[subV] = labels ? labels[vertex.index] : vertex.index;
+          if (vertexWeight) {
+            vertexWeight[subV] = graph->weightOf<true>(vertex);
+          }
+
+          for (Edge const edge : graph->edgesOf(vertex)) {
+            Vertex const u = graph->destinationOf(edge);
+            if (bisection.getAssignment(u) == part) {
+              edgeList[numEdges] = subMap[u.index];
+              if (edgeWeight) {
+                edgeWeight[numEdges] = graph->weightOf<true>(edge);
+              }
+              ++numEdges;
+            }
+          }
+
+          prefix[subV+1] = numEdges;
+        }
       }
+
+      halfEdges[part] = numEdges;
+      nextEdge += numEdges;
+    }
+  }
+
+  for (pid_type part = 0; part < NUM_BISECTION_PARTS; ++part) {
+    pid_type const numHalfParts = numPartsPrefix[part+1] - \
+        numPartsPrefix[part];
+
+    if (numHalfParts > 1) {
+      vtx_type const start = halfVertexStart[part];
+      adj_type const edge = halfEdgeStart[part];
+
+      Graph const half(halfVertices[part], halfEdges[part], \
+          buffer.edgePrefix.data() + start + halfOffset[part], \
+          buffer.edgeList.data() + edge, \
+          graph->hasUnitVertexWeight() ? nullptr : \
+              buffer.vertexWeight.data() + start, \
+          graph->hasUnitEdgeWeight() ? nullptr : \
+              buffer.edgeWeight.data() + edge);
+
+      TargetPartitioning const subTarget = makeHalfTarget(target, \
+          numPartsPrefix, part);
+
+      recurseInPlace(partitionLabels, &subTarget, &half, \
+          buffer.labels.data() + start, start, edge, halfOffset[part], \
+          workspace, 1 - output, depth+1);
     }
   }
 }
@@ -148,7 +448,25 @@ void RecursiveBisectionPartitioner::recurse(
 
 RecursiveBisectionPartitioner::RecursiveBisectionPartitioner(
     IBisector * const bisector) :
-  m_bisector(bisector)
+  RecursiveBisectionPartitioner(bisector, EXTRACT_TOGETHER)
+{
+  // do nothing
+}
+
+
+RecursiveBisectionPartitioner::RecursiveBisectionPartitioner(
+    IBisector * const bisector,
+    extraction_type const extraction) :
+  m_bisector(bisector),
+  m_extraction(extraction),
+  m_progress(nullptr),
+  m_workspace()
+{
+  // do nothing
+}
+
+
+RecursiveBisectionPartitioner::~RecursiveBisectionPartitioner()
 {
   // do nothing
 }
@@ -166,13 +484,45 @@ Partitioning RecursiveBisectionPartitioner::execute(
 {
   sl::Array<pid_type> partitionLabels(graph->numVertices());
 
-  MappedGraphWrapper mappedGraph(graph);
-  recurse(partitionLabels.data(), target, &mappedGraph, 0);
+  pid_type const numParts = target->numPartitions();
+  if (m_extraction == EXTRACT_IN_PLACE && numParts > 2) {
+    if (!m_workspace || !m_workspace->fits(graph, numParts)) {
+      // grow the buffers to fit both this graph and any seen before
+      vtx_type numVertices = graph->numVertices();
+      adj_type numEdges = graph->numEdges();
+      pid_type maxNumParts = numParts;
+      bool hasVertexWeights = !graph->hasUnitVertexWeight();
+      bool hasEdgeWeights = !graph->hasUnitEdgeWeight();
+      if (m_workspace) {
+        numVertices = std::max(numVertices, m_workspace->numVertices);
+        numEdges = std::max(numEdges, m_workspace->numEdges);
+        maxNumParts = std::max(maxNumParts, m_workspace->numParts);
+        hasVertexWeights |= m_workspace->hasVertexWeights;
+        hasEdgeWeights |= m_workspace->hasEdgeWeights;
+        m_workspace.reset();
+      }
+      m_workspace.reset(new workspace_struct(numVertices, numEdges, \
+          maxNumParts, hasVertexWeights, hasEdgeWeights));
+    }
+    recurseInPlace(partitionLabels.data(), target, graph, nullptr, 0, 0, 0, \
+        m_workspace.get(), 0, 0);
+  } else {
+    MappedGraphWrapper mappedGraph(graph);
+    recurse(partitionLabels.data(), target, &mappedGraph, 0, 0);
+  }
 
-  Partitioning part(target->numPartitions(), graph, std::move(partitionLabels));
+  Partitioning part(numParts, graph, std::move(partitionLabels));
   part.recalcCutEdgeWeight();
 
   return part;
 }
 
+
+void RecursiveBisectionPartitioner::setProgress(
+    ProgressMonitor * const progress) noexcept
+{
+  m_progress = progress;
+}
+
+
 }
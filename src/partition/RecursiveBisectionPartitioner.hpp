@@ -34,6 +34,9 @@
 #include "partition/IPartitioner.hpp"
 #include "partition/IBisector.hpp"
 #include "graph/IMappedGraph.hpp"
+#include "util/ProgressMonitor.hpp"
+
+#include <memory>
 
 
 namespace poros
@@ -44,6 +47,32 @@ class RecursiveBisectionPartitioner :
   public IPartitioner
 {
   public:
+    /**
+    * @brief The ways in which the halves of each bisection can be separated
+    * before recursing on them.
+    */
+    enum extraction_type {
+      /**
+      * @brief Extract both halves as new subgraphs in a single pass.
+      */
+      EXTRACT_TOGETHER,
+      /**
+      * @brief Extract the halves as new subgraphs one at a time, such that
+      * the second half is only extracted after the first has been
+      * partitioned. This lowers peak memory usage at the cost of an extra
+      * pass over the graph per bisection.
+      */
+      EXTRACT_SEQUENTIALLY,
+      /**
+      * @brief Permute the halves into contiguous ranges of two working
+      * buffers allocated once up front, alternating between the buffers at
+      * each level of recursion. The buffers are kept for later calls, and
+      * only grown when a larger graph is partitioned.
+      */
+      EXTRACT_IN_PLACE
+    };
+
+
     /**
     * @brief Create a new recursive bisection partitioner given the parameters.
     *
@@ -54,6 +83,23 @@ class RecursiveBisectionPartitioner :
         IBisector * bisector);
 
 
+    /**
+    * @brief Create a new recursive bisection partitioner.
+    *
+    * @param bisector The bisector to use.
+    * @param extraction How to separate the halves of each bisection.
+    */
+    RecursiveBisectionPartitioner(
+        IBisector * bisector,
+        extraction_type extraction);
+
+
+    /**
+    * @brief Destructor.
+    */
+    ~RecursiveBisectionPartitioner();
+
+
     /**
      * @brief Create a partitioning of the graph.
      *
@@ -66,9 +112,42 @@ class RecursiveBisectionPartitioner :
         TargetPartitioning const * target,
         Graph const * graph) override;
 
+    /**
+    * @brief Set the monitor to report the depth of each bisection to.
+    *
+    * @param progress The monitor (may be null to stop reporting). It must
+    * outlive this partitioner.
+    */
+    void setProgress(
+        ProgressMonitor * progress) noexcept;
+
 
   private:
+    struct workspace_struct;
+
     IBisector * m_bisector;
+    extraction_type m_extraction;
+    ProgressMonitor * m_progress;
+    std::unique_ptr<workspace_struct> m_workspace;
+
+
+    /**
+     * @brief Bisect a graph such that each half can be recursively
+     * partitioned into its share of the target partitions.
+     *
+     * @param target The target partitioning to achieve.
+     * @param graph The graph to bisect.
+     * @param depth The depth of the recursion.
+     * @param numPartsPrefix The prefix sum of the number of partitions in
+     * each half (output, of length 3).
+     *
+     * @return The bisection.
+     */
+    Partitioning bisect(
+        TargetPartitioning const * target,
+        Graph const * graph,
+        int depth,
+        pid_type * numPartsPrefix);
 
 
     /**
@@ -78,12 +157,45 @@ class RecursiveBisectionPartitioner :
      * @param target The target partitioning to achieve.
      * @param subGraph The subgraph to recursively partition.
      * @param offset The partition ID offset to assign.
+     * @param depth The depth of the recursion.
      */
     void recurse(
         pid_type * partitionLabels,
         TargetPartitioning const * target,
         IMappedGraph const * subGraph,
-        pid_type const offset);
+        pid_type const offset,
+        int depth);
+
+
+    /**
+     * @brief Recursively execute on a slice of one of the working buffers.
+     * The halves are written to the same range of the other buffer that the
+     * slice occupies in its own, and their halves in turn are written back to
+     * the slice's buffer.
+     *
+     * @param partitionLabels The partitioning to populate.
+     * @param target The target partitioning to achieve.
+     * @param graph The graph of the slice.
+     * @param labels The vertex in the original graph of each vertex in the
+     * slice (null at the root).
+     * @param vertexStart The first vertex of the slice.
+     * @param edgeStart The first edge of the slice.
+     * @param offset The partition ID offset to assign.
+     * @param workspace The working buffers.
+     * @param output The index of the buffer to write the halves to.
+     * @param depth The depth of the recursion.
+     */
+    void recurseInPlace(
+        pid_type * partitionLabels,
+        TargetPartitioning const * target,
+        Graph const * graph,
+        vtx_type const * labels,
+        vtx_type vertexStart,
+        adj_type edgeStart,
+        pid_type offset,
+        workspace_struct * workspace,
+        size_t output,
+        int depth);
 
 
     // disable copying
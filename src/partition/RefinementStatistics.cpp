@@ -0,0 +1,182 @@
+/**
+* @file RefinementStatistics.cpp
+* @brief Implementation of the RefinementStatistics class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-27
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RefinementStatistics.hpp"
+
+#include "solidutils/Debug.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+constexpr size_t const RefinementStatistics::NUM_GAIN_BUCKETS;
+
+
+namespace
+{
+
+std::string const GAIN_BUCKET_NAMES[RefinementStatistics::NUM_GAIN_BUCKETS] = {
+  "..-64",
+  "-63..-16",
+  "-15..-4",
+  "-3..-1",
+  "0",
+  "1..3",
+  "4..15",
+  "16..63",
+  "64.."
+};
+
+std::string const STOP_REASON_NAMES[RefinementStatistics::NUM_STOP_REASONS] = {
+  "max_passes",
+  "no_improvement",
+  "deadline"
+};
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+RefinementStatistics::RefinementStatistics() noexcept :
+  m_numPasses(0),
+  m_numMoves(0),
+  m_numRolledBack(0),
+  m_maxRollback(0),
+  m_numLimitedPasses(0),
+  m_borderVertices(0),
+  m_maxBorderSize(0),
+  m_gains(),
+  m_stops()
+{
+  m_gains.fill(0);
+  m_stops.fill(0);
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void RefinementStatistics::reportPassEnd(
+    vtx_type const rollback,
+    bool const limited) noexcept
+{
+  m_numRolledBack += rollback;
+  m_maxRollback = std::max(m_maxRollback, static_cast<uint64_t>(rollback));
+  if (limited) {
+    ++m_numLimitedPasses;
+  }
+}
+
+
+void RefinementStatistics::reportStop(
+    int const reason) noexcept
+{
+  ASSERT_LESS(reason, NUM_STOP_REASONS);
+  ++m_stops[reason];
+}
+
+
+void RefinementStatistics::add(
+    RefinementStatistics const & other) noexcept
+{
+  m_numPasses += other.m_numPasses;
+  m_numMoves += other.m_numMoves;
+  m_numRolledBack += other.m_numRolledBack;
+  m_maxRollback = std::max(m_maxRollback, other.m_maxRollback);
+  m_numLimitedPasses += other.m_numLimitedPasses;
+  m_borderVertices += other.m_borderVertices;
+  m_maxBorderSize = std::max(m_maxBorderSize, other.m_maxBorderSize);
+  for (size_t i = 0; i < m_gains.size(); ++i) {
+    m_gains[i] += other.m_gains[i];
+  }
+  for (size_t i = 0; i < m_stops.size(); ++i) {
+    m_stops[i] += other.m_stops[i];
+  }
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+size_t RefinementStatistics::gainBucket(
+    wgt_diff_type const gain) noexcept
+{
+  size_t const middle = NUM_GAIN_BUCKETS / 2;
+  if (gain == 0) {
+    return middle;
+  }
+
+  // each bucket covers four times the magnitudes of the one before it
+  uint32_t magnitude = static_cast<uint32_t>(gain < 0 ? -gain : gain);
+  size_t offset = 1;
+  while (magnitude >= 4 && offset < middle) {
+    magnitude >>= 2;
+    ++offset;
+  }
+
+  return gain < 0 ? middle - offset : middle + offset;
+}
+
+
+std::string const & RefinementStatistics::gainBucketName(
+    size_t const bucket)
+{
+  if (bucket >= NUM_GAIN_BUCKETS) {
+    throw std::runtime_error("Got bucket " + std::to_string(bucket) + "/" + \
+        std::to_string(NUM_GAIN_BUCKETS));
+  }
+
+  return GAIN_BUCKET_NAMES[bucket];
+}
+
+
+std::string const & RefinementStatistics::stopReasonName(
+    int const reason)
+{
+  if (reason < 0 || reason >= NUM_STOP_REASONS) {
+    throw std::runtime_error("Got reason " + std::to_string(reason) + "/" + \
+        std::to_string(NUM_STOP_REASONS));
+  }
+
+  return STOP_REASON_NAMES[reason];
+}
+
+
+}
@@ -0,0 +1,276 @@
+/**
+* @file RefinementStatistics.hpp
+* @brief The RefinementStatistics class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-27
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_REFINEMENTSTATISTICS_HPP
+#define POROS_SRC_REFINEMENTSTATISTICS_HPP
+
+#include "Base.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace poros
+{
+
+/**
+* @brief A record of the work done by a call to two way refinement. Records
+* may be added together to summarize several calls.
+*/
+class RefinementStatistics
+{
+  public:
+    /**
+    * @brief The reasons refinement stops making passes.
+    */
+    enum {
+      STOP_MAX_PASSES,
+      STOP_NO_IMPROVEMENT,
+      STOP_DEADLINE,
+      NUM_STOP_REASONS
+    };
+
+    /**
+    * @brief The number of buckets moves are counted in by their gain. The
+    * middle bucket holds moves with a gain of zero, and the buckets either
+    * side of it cover gains up to 3, 15, 63, and beyond, in magnitude.
+    */
+    static constexpr size_t const NUM_GAIN_BUCKETS = 9;
+
+    /**
+    * @brief Create an empty record.
+    */
+    RefinementStatistics() noexcept;
+
+    /**
+    * @brief Record the start of a pass.
+    *
+    * @param borderSize The number of vertices on the border.
+    */
+    void reportPass(
+        vtx_type borderSize) noexcept
+    {
+      ++m_numPasses;
+      m_borderVertices += borderSize;
+      if (borderSize > m_maxBorderSize) {
+        m_maxBorderSize = borderSize;
+      }
+    }
+
+    /**
+    * @brief Record a move.
+    *
+    * @param gain The reduction in the cut made by the move (negative if it
+    * increased the cut).
+    */
+    void reportMove(
+        wgt_diff_type gain) noexcept
+    {
+      ++m_numMoves;
+      ++m_gains[gainBucket(gain)];
+    }
+
+    /**
+    * @brief Record the end of a pass.
+    *
+    * @param rollback The number of moves undone.
+    * @param limited Whether the pass stopped because it made too many moves
+    * without improvement, rather than running out of vertices to move.
+    */
+    void reportPassEnd(
+        vtx_type rollback,
+        bool limited) noexcept;
+
+    /**
+    * @brief Record why refinement stopped.
+    *
+    * @param reason The reason.
+    */
+    void reportStop(
+        int reason) noexcept;
+
+    /**
+    * @brief Add another record to this one.
+    *
+    * @param other The other record.
+    */
+    void add(
+        RefinementStatistics const & other) noexcept;
+
+    /**
+    * @brief Get the number of passes made.
+    *
+    * @return The number of passes.
+    */
+    uint64_t numPasses() const noexcept
+    {
+      return m_numPasses;
+    }
+
+    /**
+    * @brief Get the number of moves made, including those undone.
+    *
+    * @return The number of moves.
+    */
+    uint64_t numMoves() const noexcept
+    {
+      return m_numMoves;
+    }
+
+    /**
+    * @brief Get the number of moves kept.
+    *
+    * @return The number of moves.
+    */
+    uint64_t numKeptMoves() const noexcept
+    {
+      return m_numMoves - m_numRolledBack;
+    }
+
+    /**
+    * @brief Get the number of moves undone at the end of passes.
+    *
+    * @return The number of moves.
+    */
+    uint64_t numRolledBack() const noexcept
+    {
+      return m_numRolledBack;
+    }
+
+    /**
+    * @brief Get the largest number of moves undone at the end of a pass.
+    *
+    * @return The number of moves.
+    */
+    uint64_t maxRollback() const noexcept
+    {
+      return m_maxRollback;
+    }
+
+    /**
+    * @brief Get the number of passes which stopped because they made too
+    * many moves without improvement.
+    *
+    * @return The number of passes.
+    */
+    uint64_t numLimitedPasses() const noexcept
+    {
+      return m_numLimitedPasses;
+    }
+
+    /**
+    * @brief Get the total size of the border at the start of each pass.
+    *
+    * @return The number of vertices.
+    */
+    uint64_t borderVertices() const noexcept
+    {
+      return m_borderVertices;
+    }
+
+    /**
+    * @brief Get the largest size of the border at the start of a pass.
+    *
+    * @return The number of vertices.
+    */
+    uint64_t maxBorderSize() const noexcept
+    {
+      return m_maxBorderSize;
+    }
+
+    /**
+    * @brief Get the number of moves with a gain in a bucket.
+    *
+    * @param bucket The bucket.
+    *
+    * @return The number of moves.
+    */
+    uint64_t numGains(
+        size_t bucket) const noexcept
+    {
+      return m_gains[bucket];
+    }
+
+    /**
+    * @brief Get the number of calls which stopped for a reason.
+    *
+    * @param reason The reason.
+    *
+    * @return The number of calls.
+    */
+    uint64_t numStops(
+        int reason) const noexcept
+    {
+      return m_stops[reason];
+    }
+
+    /**
+    * @brief Get the bucket a gain is counted in.
+    *
+    * @param gain The gain.
+    *
+    * @return The bucket.
+    */
+    static size_t gainBucket(
+        wgt_diff_type gain) noexcept;
+
+    /**
+    * @brief Get the name of a gain bucket (e.g., "4..15").
+    *
+    * @param bucket The bucket.
+    *
+    * @return The name.
+    */
+    static std::string const & gainBucketName(
+        size_t bucket);
+
+    /**
+    * @brief Get the name of a reason for stopping.
+    *
+    * @param reason The reason.
+    *
+    * @return The name.
+    */
+    static std::string const & stopReasonName(
+        int reason);
+
+  private:
+    uint64_t m_numPasses;
+    uint64_t m_numMoves;
+    uint64_t m_numRolledBack;
+    uint64_t m_maxRollback;
+    uint64_t m_numLimitedPasses;
+    uint64_t m_borderVertices;
+    uint64_t m_maxBorderSize;
+    std::array<uint64_t, NUM_GAIN_BUCKETS> m_gains;
+    std::array<uint64_t, NUM_STOP_REASONS> m_stops;
+};
+
+}
+
+#endif
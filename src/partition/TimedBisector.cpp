@@ -27,6 +27,8 @@
 
 #include "TimedBisector.hpp"
 
+#include "util/TimeScope.hpp"
+
 #include "solidutils/Timer.hpp"
 
 namespace poros
@@ -53,6 +55,10 @@ Partitioning TimedBisector::execute(
     TargetPartitioning const * target,
     Graph const * graph)
 {
+  TimeScope scope(TimeKeeper::INITIAL_PARTITIONING);
+
+  PerfCounters::sample_type const counts = startCounting();
+
   sl::Timer tmr;
   tmr.start();
 
@@ -61,6 +67,7 @@ Partitioning TimedBisector::execute(
   tmr.stop();
 
   reportTime(TimeKeeper::INITIAL_PARTITIONING, tmr.poll());
+  reportCounts(TimeKeeper::INITIAL_PARTITIONING, counts);
 
   return bisection;
 }
@@ -28,6 +28,8 @@
 
 #include "TimedTwoWayRefiner.hpp"
 
+#include "util/TimeScope.hpp"
+
 #include "solidutils/Timer.hpp"
 
 namespace poros
@@ -49,20 +51,28 @@ TimedTwoWayRefiner::TimedTwoWayRefiner(
 * PUBLIC METHODS **************************************************************
 ******************************************************************************/
 
-void TimedTwoWayRefiner::refine(
+RefinementStatistics TimedTwoWayRefiner::refine(
     TargetPartitioning const * target,
     TwoWayConnectivity * connectivity,
     Partitioning * partitioning,
     Graph const * graph)
 {
+  TimeScope scope(TimeKeeper::REFINEMENT);
+
+  PerfCounters::sample_type const counts = startCounting();
+
   sl::Timer tmr;
   tmr.start();
 
-  m_refiner->refine(target, connectivity, partitioning, graph);
+  RefinementStatistics const stats = \
+      m_refiner->refine(target, connectivity, partitioning, graph);
 
   tmr.stop();
 
   reportTime(TimeKeeper::REFINEMENT, tmr.poll());
+  reportCounts(TimeKeeper::REFINEMENT, counts);
+
+  return stats;
 }
 
 
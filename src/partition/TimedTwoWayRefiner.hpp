@@ -53,8 +53,10 @@ class TimedTwoWayRefiner : public ITwoWayRefiner, public TimedProcess
     * @param partitioning The partitioning (input and output).
     * @param connectivity The connectivity of vertices to the partitions.
     * @param graph The graph.
+    *
+    * @return A record of the work done.
     */
-    void refine(
+    RefinementStatistics refine(
         TargetPartitioning const * target,
         TwoWayConnectivity * connectivity,
         Partitioning * partitioning,
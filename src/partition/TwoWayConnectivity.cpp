@@ -28,6 +28,7 @@
 
 
 #include "TwoWayConnectivity.hpp"
+#include "util/MemoryPolicy.hpp"
 
 #include <string>
 
@@ -110,7 +111,8 @@ TwoWayConnectivity TwoWayConnectivity::fromPartitioning(
     Graph const * const graph,
     Partitioning const * const partitioning)
 {
-  sl::Array<vertex_struct> connectivity(graph->numVertices());
+  sl::Array<vertex_struct> connectivity = \
+      MemoryPolicy::allocate<vertex_struct>(graph->numVertices());
 
   // populate connectivity vector
   if (graph->hasUnitEdgeWeight()) {
@@ -131,7 +133,8 @@ TwoWayConnectivity TwoWayConnectivity::fromPartitioning(
 TwoWayConnectivity::TwoWayConnectivity(
     sl::Array<vertex_struct> connectivity) :
   m_border(connectivity.size()),
-  m_connectivity(std::move(connectivity))
+  m_connectivity(std::move(connectivity)),
+  m_memory(m_connectivity.size()*(sizeof(vertex_struct)+2*sizeof(vtx_type)))
 {
   // fill in border
   for (vtx_type v = 0; v < m_connectivity.size(); ++v) {
@@ -35,6 +35,7 @@
 #include "Base.hpp"
 #include "graph/Graph.hpp"
 #include "Partitioning.hpp"
+#include "util/TrackedMemory.hpp"
 #include "solidutils/FixedSet.hpp"
 #include "solidutils/Array.hpp"
 
@@ -306,6 +307,7 @@ class TwoWayConnectivity
   private:
     sl::FixedSet<vtx_type> m_border;
     sl::Array<vertex_struct> m_connectivity;
+    TrackedMemory m_memory;
 
     /**
     * @brief Create a string of the connectivity of the vertex.
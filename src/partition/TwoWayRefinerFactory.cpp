@@ -30,21 +30,44 @@
 #include "FMRefiner.hpp"
 #include "TimedTwoWayRefiner.hpp"
 
+#include <limits>
+
 
 namespace poros
 {
 
 
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief The maximum number of bad moves FM refinement makes before undoing
+* them.
+*/
+vtx_type const FM_MAX_BAD_MOVES = 150;
+
+}
+
+
 /******************************************************************************
 * PUBLIC STATIC METHODS *******************************************************
 ******************************************************************************/
 
 std::unique_ptr<ITwoWayRefiner> TwoWayRefinerFactory::make(
-    int const scheme)
+    int const scheme,
+    int const maxIterations,
+    Deadline const * const deadline)
 {
+  int const maxIters = maxIterations < 0 ? \
+      std::numeric_limits<int>::max() : maxIterations;
+
   std::unique_ptr<ITwoWayRefiner> ptr;
   if (scheme == FM_TWOWAY_REFINEMENT) {
-    ptr.reset(new FMRefiner(8, 150));
+    ptr.reset(new FMRefiner(maxIters, FM_MAX_BAD_MOVES, deadline));
   } else {
     throw std::runtime_error("Unknown two way refinement type: " +
         std::to_string(scheme));
@@ -56,10 +79,12 @@ std::unique_ptr<ITwoWayRefiner> TwoWayRefinerFactory::make(
 
 std::unique_ptr<ITwoWayRefiner> TwoWayRefinerFactory::make(
     int const scheme,
-    std::shared_ptr<TimeKeeper> timeKeeper)
+    int const maxIterations,
+    std::shared_ptr<TimeKeeper> timeKeeper,
+    Deadline const * const deadline)
 {
   std::unique_ptr<TimedTwoWayRefiner> ptr( \
-      new TimedTwoWayRefiner(make(scheme)));
+      new TimedTwoWayRefiner(make(scheme, maxIterations, deadline)));
 
   ptr->setTimeKeeper(timeKeeper);
 
@@ -32,6 +32,7 @@
 
 #include "ITwoWayRefiner.hpp"
 #include "util/TimeKeeper.hpp"
+#include "util/Deadline.hpp"
 
 #include <memory>
 
@@ -45,23 +46,35 @@ class TwoWayRefinerFactory
   * @brief Create a new ITwoWayRefiner object.
   *
   * @param scheme The scheme to instantiate.
+  * @param maxIterations The maximum number of refinement passes to make (-1
+  * for no maximum).
+  * @param deadline The deadline to stop refining by (may be null). It must
+  * outlive the refiner.
   *
   * @return The instantiated scheme.
   */
   static std::unique_ptr<ITwoWayRefiner> make(
-      int scheme);
+      int scheme,
+      int maxIterations,
+      Deadline const * deadline = nullptr);
 
   /**
   * @brief Create a new ITwoWayRefiner object.
   *
   * @param scheme The scheme to instantiate.
+  * @param maxIterations The maximum number of refinement passes to make (-1
+  * for no maximum).
   * @param timeKeeper The TimeKeeper to report time to.
+  * @param deadline The deadline to stop refining by (may be null). It must
+  * outlive the refiner.
   *
   * @return The instantiated scheme.
   */
   static std::unique_ptr<ITwoWayRefiner> make(
       int scheme,
-      std::shared_ptr<TimeKeeper> timeKeeper);
+      int maxIterations,
+      std::shared_ptr<TimeKeeper> timeKeeper,
+      Deadline const * deadline = nullptr);
 };
 
 
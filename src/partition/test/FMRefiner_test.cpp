@@ -34,6 +34,8 @@
 #include "util/RandomEngineFactory.hpp"
 #include "solidutils/UnitTest.hpp"
 
+#include <thread>
+
 namespace poros
 {
 
@@ -57,10 +59,27 @@ UNITTEST(FMRefiner, RefineRandomGridCut)
   TwoWayConnectivity conn = \
       TwoWayConnectivity::fromPartitioning(&graph, &part);
 
-  fm.refine(&target, &conn, &part, &graph);
+  wgt_type const initialCut = part.getCutEdgeWeight();
+  RefinementStatistics const stats = \
+      fm.refine(&target, &conn, &part, &graph);
 
   testLess(part.getCutEdgeWeight(), 100u);
 
+  testGreater(stats.numPasses(), 1u);
+  testLessOrEqual(stats.numPasses(), 25u);
+  testGreater(stats.numKeptMoves(), 0u);
+  testLess(stats.numKeptMoves(), stats.numMoves());
+  testGreater(stats.maxBorderSize(), 0u);
+  testEqual(stats.numStops(RefinementStatistics::STOP_MAX_PASSES) + \
+      stats.numStops(RefinementStatistics::STOP_NO_IMPROVEMENT), 1u);
+  testLess(part.getCutEdgeWeight(), initialCut);
+
+  uint64_t numGains = 0;
+  for (size_t i = 0; i < RefinementStatistics::NUM_GAIN_BUCKETS; ++i) {
+    numGains += stats.numGains(i);
+  }
+  testEqual(numGains, stats.numMoves());
+
   PartitioningAnalyzer analyzer(&part, &target);
 
   testLess(analyzer.calcMaxImbalance(), 0.03005);
@@ -97,4 +116,35 @@ UNITTEST(FMRefiner, RefineUnbalancedCut)
   testLess(analyzer.calcMaxImbalance(), 0.03005);
 }
 
+
+UNITTEST(FMRefiner, RefinePastDeadline)
+{
+  GridGraphGenerator gen(5, 6, 7); 
+
+  Graph graph = gen.generate();
+
+  TargetPartitioning target(2, graph.getTotalVertexWeight(), 0.03);
+
+  Deadline deadline;
+  deadline.restart(1e-6);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  FMRefiner fm(25, graph.numVertices(), &deadline);
+
+  RandomEngineHandle engine = RandomEngineFactory::make(0);
+  RandomBisector bisector(engine);
+  Partitioning part = bisector.execute(&target, &graph); 
+
+  TwoWayConnectivity conn = \
+      TwoWayConnectivity::fromPartitioning(&graph, &part);
+
+  wgt_type const initialCut = part.getCutEdgeWeight();
+  RefinementStatistics const stats = \
+      fm.refine(&target, &conn, &part, &graph);
+
+  testEqual(stats.numPasses(), 0u);
+  testEqual(stats.numStops(RefinementStatistics::STOP_DEADLINE), 1u);
+  testEqual(part.getCutEdgeWeight(), initialCut);
+}
+
 }
@@ -37,6 +37,8 @@
 
 #include "solidutils/UnitTest.hpp"
 
+#include <cstdio>
+
 namespace poros
 {
 
@@ -75,4 +77,53 @@ UNITTEST(MultilevelBisector, ExecuteFullCoarsen8Part)
   testLess(analyzer.calcMaxImbalance(), 0.0051);
 }
 
+
+UNITTEST(MultilevelBisector, ReuseHierarchy)
+{
+  GridGraphGenerator gen(40, 40, 1);
+  Graph graph = gen.generate();
+
+  TargetPartitioning target(2, graph.getTotalVertexWeight(), 0.005);
+  std::shared_ptr<TimeKeeper> timeKeeper(new TimeKeeper);
+
+  std::string const filename("MultilevelBisector_test.hier");
+  {
+    RandomEngineHandle engine = RandomEngineFactory::make(0);
+    MultilevelBisector mb( \
+        std::unique_ptr<IAggregator>(new RandomMatchingAggregator(engine)), \
+        std::unique_ptr<IBisector>(new BFSBisector(engine)), \
+        std::unique_ptr<ITwoWayRefiner>(new FMRefiner(8, 20)), timeKeeper);
+
+    CoarseningHierarchy hierarchy(&graph);
+    mb.setHierarchy(&hierarchy);
+    mb.execute(&target, &graph);
+
+    testGreater(hierarchy.numLevels(), 0u);
+    testLess(hierarchy.graph(hierarchy.numLevels()-1)->numVertices(), \
+        graph.numVertices());
+    hierarchy.save(filename);
+  }
+
+  std::unique_ptr<CoarseningHierarchy> hierarchy = \
+      CoarseningHierarchy::load(filename);
+  std::remove(filename.c_str());
+  size_t const numLevels = hierarchy->numLevels();
+
+  // a different seed, which only affects initial partitioning and
+  // refinement when the hierarchy is re-used
+  RandomEngineHandle engine = RandomEngineFactory::make(1);
+  MultilevelBisector mb( \
+      std::unique_ptr<IAggregator>(new RandomMatchingAggregator(engine)), \
+      std::unique_ptr<IBisector>(new BFSBisector(engine)), \
+      std::unique_ptr<ITwoWayRefiner>(new FMRefiner(8, 20)), timeKeeper);
+  mb.setHierarchy(hierarchy.get());
+
+  Partitioning part = mb.execute(&target, &graph);
+  testEqual(hierarchy->numLevels(), numLevels);
+
+  PartitioningAnalyzer analyzer(&part, &target);
+  testLessOrEqual(part.getCutEdgeWeight(), 80u);
+  testLess(analyzer.calcMaxImbalance(), 0.0051);
+}
+
 }
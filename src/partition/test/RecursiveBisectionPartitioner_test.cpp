@@ -166,6 +166,70 @@ UNITTEST(RecursiveBisectionPartitioner, Execute7Way1To3)
 }
 
 
+UNITTEST(RecursiveBisectionPartitioner, ExtractSequentially)
+{
+  RandomEngineHandle engine = RandomEngineFactory::make(0);
+
+  // create bisector
+  RandomFMBisector b(8, engine);
+
+  // create partitioner
+  RecursiveBisectionPartitioner rb(&b, \
+      RecursiveBisectionPartitioner::EXTRACT_SEQUENTIALLY);
+
+  // generate graph
+  GridGraphGenerator gen(10, 6, 5);
+
+  for (pid_type k = 2; k < 10; ++k) {
+    Graph graph = gen.generate();
+
+    TargetPartitioning target(k, graph.getTotalVertexWeight(), \
+        0.03);
+
+    // partition 
+    Partitioning part = rb.execute(&target, &graph);
+    testEqual(part.numPartitions(), k);
+
+    PartitioningAnalyzer analyzer(&part, &target);
+
+    double const imbalance = analyzer.calcMaxImbalance();
+    testLess(imbalance, 0.03005) << "Num partitions = " << k;
+  }
+}
+
+UNITTEST(RecursiveBisectionPartitioner, ExtractInPlaceMatches)
+{
+  // generate graph
+  GridGraphGenerator gen(9, 5, 7);
+  gen.setRandomVertexWeight(1, 5);
+  gen.setRandomEdgeWeight(1, 3);
+
+  Graph graph = gen.generate();
+
+  for (pid_type k = 2; k < 12; ++k) {
+    TargetPartitioning target(k, graph.getTotalVertexWeight(), \
+        0.03);
+
+    // the halves are numbered the same way by both, so the same bisector
+    // state must produce the same partitioning
+    RandomFMBisector b1(8, RandomEngineFactory::make(k));
+    RecursiveBisectionPartitioner extracted(&b1);
+    Partitioning expected = extracted.execute(&target, &graph);
+
+    RandomFMBisector b2(8, RandomEngineFactory::make(k));
+    RecursiveBisectionPartitioner inPlace(&b2, \
+        RecursiveBisectionPartitioner::EXTRACT_IN_PLACE);
+    Partitioning actual = inPlace.execute(&target, &graph);
+
+    testEqual(actual.numPartitions(), k);
+    testEqual(actual.getCutEdgeWeight(), expected.getCutEdgeWeight());
+    for (Vertex const v : graph.vertices()) {
+      testEqual(actual.getAssignment(v), expected.getAssignment(v)) << \
+          "Num partitions = " << k;
+    }
+  }
+}
+
 
 
 }
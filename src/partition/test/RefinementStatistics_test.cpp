@@ -0,0 +1,96 @@
+/**
+* @file RefinementStatistics_test.cpp
+* @brief Unit tests for the RefinementStatistics class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-27
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "partition/RefinementStatistics.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <string>
+
+namespace poros
+{
+
+UNITTEST(RefinementStatistics, GainBuckets)
+{
+  testEqual(RefinementStatistics::gainBucket(0), 4u);
+  testEqual(RefinementStatistics::gainBucket(1), 5u);
+  testEqual(RefinementStatistics::gainBucket(3), 5u);
+  testEqual(RefinementStatistics::gainBucket(4), 6u);
+  testEqual(RefinementStatistics::gainBucket(63), 7u);
+  testEqual(RefinementStatistics::gainBucket(64), 8u);
+  testEqual(RefinementStatistics::gainBucket(100000), 8u);
+  testEqual(RefinementStatistics::gainBucket(-1), 3u);
+  testEqual(RefinementStatistics::gainBucket(-15), 2u);
+  testEqual(RefinementStatistics::gainBucket(-16), 1u);
+  testEqual(RefinementStatistics::gainBucket(-64), 0u);
+
+  for (size_t i = 0; i < RefinementStatistics::NUM_GAIN_BUCKETS; ++i) {
+    std::string const & name = RefinementStatistics::gainBucketName(i);
+    testFalse(name.empty());
+  }
+  testEqual(RefinementStatistics::gainBucketName(6), std::string("4..15"));
+}
+
+UNITTEST(RefinementStatistics, Add)
+{
+  RefinementStatistics a;
+  a.reportPass(10);
+  a.reportMove(2);
+  a.reportMove(-1);
+  a.reportMove(-1);
+  a.reportPassEnd(2, true);
+  a.reportPass(6);
+  a.reportMove(-5);
+  a.reportPassEnd(1, false);
+  a.reportStop(RefinementStatistics::STOP_NO_IMPROVEMENT);
+
+  testEqual(a.numPasses(), 2u);
+  testEqual(a.numMoves(), 4u);
+  testEqual(a.numKeptMoves(), 1u);
+  testEqual(a.maxRollback(), 2u);
+  testEqual(a.numLimitedPasses(), 1u);
+  testEqual(a.borderVertices(), 16u);
+  testEqual(a.maxBorderSize(), 10u);
+  testEqual(a.numGains(RefinementStatistics::gainBucket(-1)), 2u);
+
+  RefinementStatistics b;
+  b.reportPass(20);
+  b.reportMove(0);
+  b.reportPassEnd(0, false);
+  b.reportStop(RefinementStatistics::STOP_MAX_PASSES);
+
+  a.add(b);
+  testEqual(a.numPasses(), 3u);
+  testEqual(a.numMoves(), 5u);
+  testEqual(a.numKeptMoves(), 2u);
+  testEqual(a.maxBorderSize(), 20u);
+  testEqual(a.numGains(RefinementStatistics::gainBucket(0)), 1u);
+  testEqual(a.numStops(RefinementStatistics::STOP_MAX_PASSES), 1u);
+  testEqual(a.numStops(RefinementStatistics::STOP_NO_IMPROVEMENT), 1u);
+}
+
+}
@@ -0,0 +1,290 @@
+/**
+* @file PorosPipeline_test.cpp
+* @brief Unit tests for the PorosPipeline class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "PorosPipeline.hpp"
+#include "graph/GridGraphGenerator.hpp"
+#include "partition/TargetPartitioning.hpp"
+#include "partition/PartitioningAnalyzer.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace poros
+{
+
+namespace
+{
+
+bool isRejected(
+    poros_options_struct const & options,
+    Graph const * const graph)
+{
+  PorosPipeline pipeline(options);
+  try {
+    pipeline.execute(graph, 2, nullptr);
+  } catch (std::runtime_error const &) {
+    return true;
+  }
+
+  return false;
+}
+
+}
+
+
+UNITTEST(PorosPipeline, RecordsTimes)
+{
+  GridGraphGenerator gen(20, 20, 20);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  PorosPipeline pipeline(opts);
+
+  Partitioning part = pipeline.execute(&graph, 4, nullptr);
+  testEqual(part.numPartitions(), 4u);
+  testGreater(part.getCutEdgeWeight(), 0u);
+  testFalse(pipeline.lowMemory());
+
+  std::vector<std::pair<std::string, double>> const times = \
+      pipeline.timeKeeper()->times();
+  testEqual(times[TimeKeeper::TOTAL].first, std::string("Total"));
+  testGreater(times[TimeKeeper::TOTAL].second, 0.0);
+  testGreater(times[TimeKeeper::COARSENING].second, 0.0);
+}
+
+
+UNITTEST(PorosPipeline, CountsEvents)
+{
+  GridGraphGenerator gen(20, 20, 20);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.hardwareCounters = true;
+  PorosPipeline pipeline(opts);
+
+  pipeline.execute(&graph, 4, nullptr);
+
+  // the counters may not be available on this machine
+  std::vector<std::pair<std::string, PerfCounters::sample_type>> const \
+      counts = pipeline.timeKeeper()->counts();
+  for (uint32_t i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+    if (PerfCounters::local().isAvailable(i)) {
+      testGreater(counts[TimeKeeper::AGGREGATION].second[i] + \
+          counts[TimeKeeper::REFINEMENT].second[i], 0u) << \
+          PerfCounters::name(i);
+    } else {
+      testEqual(counts[TimeKeeper::AGGREGATION].second[i], 0u);
+    }
+  }
+}
+
+
+
+UNITTEST(PorosPipeline, CountsAllocations)
+{
+  GridGraphGenerator gen(20, 20, 20);
+  Graph graph = gen.generate();
+
+  PorosPipeline pipeline(POROS_defaultOptions());
+  pipeline.execute(&graph, 16, nullptr);
+
+  std::vector<std::pair<std::string, AllocationCounter::sample_struct>> const \
+      allocations = pipeline.timeKeeper()->allocations();
+  AllocationCounter::sample_struct const total = \
+      allocations[TimeKeeper::TOTAL].second;
+  if (AllocationCounter::isEnabled()) {
+    // each phase is part of the total
+    for (uint32_t i = 0; i < TimeKeeper::NUM_TIME_CATEGORIES; ++i) {
+      testLessOrEqual(allocations[i].second.count, total.count) << \
+          allocations[i].first;
+      testLessOrEqual(allocations[i].second.bytes, total.bytes) << \
+          allocations[i].first;
+    }
+    testGreater(allocations[TimeKeeper::COARSENING].second.count, 0u);
+    testGreater(allocations[TimeKeeper::REFINEMENT].second.count, 0u);
+  } else {
+    testEqual(total.count, 0u);
+  }
+}
+
+
+
+UNITTEST(PorosPipeline, MatchesWithSameSeed)
+{
+  GridGraphGenerator gen(15, 10, 12);
+  gen.setRandomVertexWeight(1, 3);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.randomSeed = 7;
+
+  PorosPipeline pipeline1(opts);
+  Partitioning part1 = pipeline1.execute(&graph, 5, nullptr);
+
+  PorosPipeline pipeline2(opts);
+  Partitioning part2 = pipeline2.execute(&graph, 5, nullptr);
+
+  testEqual(part1.getCutEdgeWeight(), part2.getCutEdgeWeight());
+  for (Vertex const v : graph.vertices()) {
+    testEqual(part1.getAssignment(v), part2.getAssignment(v));
+  }
+}
+
+
+UNITTEST(PorosPipeline, NumGlobalCuts)
+{
+  GridGraphGenerator gen(10, 10, 10);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.numGlobalCuts = 3;
+  PorosPipeline pipeline(opts);
+
+  pipeline.execute(&graph, 4, nullptr);
+  testEqual(pipeline.numTrials(), 3);
+}
+
+
+UNITTEST(PorosPipeline, TimeLimit)
+{
+  GridGraphGenerator gen(10, 10, 10);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.timeLimitSeconds = 0.5;
+  PorosPipeline pipeline(opts);
+
+  Partitioning part = pipeline.execute(&graph, 8, nullptr);
+
+  // the graph is small enough for many partitionings to fit in the limit,
+  // and the best is balanced
+  testGreater(pipeline.numTrials(), 1);
+  testLess(pipeline.timeKeeper()->times()[TimeKeeper::TOTAL].second, 1.0);
+
+  TargetPartitioning target(8, graph.getTotalVertexWeight(), \
+      opts.imbalanceTolerance);
+  PartitioningAnalyzer analyzer(&part, &target);
+  testTrue(analyzer.isBalanced());
+}
+
+
+UNITTEST(PorosPipeline, ExpiredTimeLimit)
+{
+  GridGraphGenerator gen(50, 50, 50);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.timeLimitSeconds = 1e-6;
+  PorosPipeline pipeline(opts);
+
+  Partitioning part = pipeline.execute(&graph, 16, nullptr);
+
+  // the limit passes during the first partitioning, which must still be
+  // refined until balanced
+  testEqual(pipeline.numTrials(), 1);
+
+  TargetPartitioning target(16, graph.getTotalVertexWeight(), \
+      opts.imbalanceTolerance);
+  PartitioningAnalyzer analyzer(&part, &target);
+  testTrue(analyzer.isBalanced());
+}
+
+
+UNITTEST(PorosPipeline, RefinementIterations)
+{
+  GridGraphGenerator gen(10, 10, 10);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.refinementIterations = 0;
+  PorosPipeline unrefined(opts);
+  unrefined.execute(&graph, 4, nullptr);
+
+  for (LevelStatistics::level_struct const & level : \
+      unrefined.statistics()->levels()) {
+    testEqual(level.refinement.numPasses(), 0u);
+  }
+
+  opts.refinementIterations = 1;
+  PorosPipeline refined(opts);
+  refined.execute(&graph, 4, nullptr);
+
+  uint64_t numPasses = 0;
+  for (LevelStatistics::level_struct const & level : \
+      refined.statistics()->levels()) {
+    testLessOrEqual(level.refinement.numPasses(), level.numBisections);
+    numPasses += level.refinement.numPasses();
+  }
+  testGreater(numPasses, 0u);
+}
+
+
+UNITTEST(PorosPipeline, CoarsestNumVertices)
+{
+  GridGraphGenerator gen(10, 10, 10);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.coarsestNumVertices = 200;
+  PorosPipeline pipeline(opts);
+  pipeline.execute(&graph, 2, nullptr);
+
+  // coarsening stops at the first graph of no more than 200 vertices
+  std::vector<LevelStatistics::level_struct> const & levels = \
+      pipeline.statistics()->levels();
+  testLessOrEqual(levels.back().numVertices, 200u);
+  testGreater(levels[levels.size()-2].numVertices, 200u);
+}
+
+
+UNITTEST(PorosPipeline, InvalidOptions)
+{
+  GridGraphGenerator gen(5, 5, 5);
+  Graph graph = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.numInitialBisections = 0;
+  testTrue(isRejected(opts, &graph));
+
+  opts = POROS_defaultOptions();
+  opts.refinementIterations = -2;
+  testTrue(isRejected(opts, &graph));
+
+  opts = POROS_defaultOptions();
+  opts.coarseningEdgeRatio = 0.0;
+  testTrue(isRejected(opts, &graph));
+
+  opts = POROS_defaultOptions();
+  opts.refinementIterations = -1;
+  testFalse(isRejected(opts, &graph));
+}
+
+}
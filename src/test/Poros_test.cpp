@@ -35,6 +35,12 @@
 #include "solidutils/Array.hpp"
 #include "solidutils/UnitTest.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
 
 namespace poros
 {
@@ -262,4 +268,516 @@ UNITTEST(Poros, PartGraphNullWeights)
   testEqual(r, 1);
 }
 
+UNITTEST(Poros, PartGraphMemoryBudget)
+{
+  GridGraphGenerator gen(15, 15, 15);
+
+  Graph g = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+
+  // a budget this small forces the low memory configuration
+  opts.randomSeed = static_cast<unsigned int>(0);
+  opts.memoryBudget = 1024;
+
+  wgt_type cutEdgeWeight;
+  sl::Array<pid_type> where(g.numVertices());
+  int r = POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+      7, &opts, &cutEdgeWeight, where.data());
+
+  testEqual(r, 1);
+
+  Partitioning part(7, &g, std::move(where)); 
+  TargetPartitioning target(part.numPartitions(), \
+      g.getTotalVertexWeight(), 0.03);
+  PartitioningAnalyzer analyzer(&part, &target);
+
+  testLess(analyzer.calcMaxImbalance(), 0.03005);
+  testEqual(part.getCutEdgeWeight(), cutEdgeWeight);
+}
+
+
+UNITTEST(Poros, PartGraphHierarchyFile)
+{
+  GridGraphGenerator gen(15, 15, 15);
+
+  Graph g = gen.generate();
+
+  std::string const filename("Poros_test.hier");
+  std::remove(filename.c_str());
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.hierarchyFile = filename.c_str();
+
+  // the first call builds and saves the hierarchy, and the rest load it
+  for (pid_type k = 2; k < 8; k += 2) {
+    opts.randomSeed = static_cast<unsigned int>(k);
+
+    wgt_type cutEdgeWeight;
+    sl::Array<pid_type> where(g.numVertices());
+    int r = POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+        g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+        k, &opts, &cutEdgeWeight, where.data());
+
+    testEqual(r, 1);
+    testTrue(std::ifstream(filename).good());
+
+    Partitioning part(k, &g, std::move(where)); 
+    TargetPartitioning target(part.numPartitions(), \
+        g.getTotalVertexWeight(), 0.03);
+    PartitioningAnalyzer analyzer(&part, &target);
+
+    testLess(analyzer.calcMaxImbalance(), 0.03005);
+    testEqual(part.getCutEdgeWeight(), cutEdgeWeight);
+  }
+
+  // a hierarchy of a different graph is rejected
+  Graph other = GridGraphGenerator(10, 10, 10).generate();
+  wgt_type cutEdgeWeight;
+  sl::Array<pid_type> where(other.numVertices());
+  int r = POROS_PartGraphRecursive(other.numVertices(), \
+      other.getEdgePrefix(), other.getEdgeList(), other.getVertexWeight(), \
+      other.getEdgeWeight(), 4, &opts, &cutEdgeWeight, where.data());
+  testEqual(r, 0);
+
+  std::remove(filename.c_str());
+}
+
+
+UNITTEST(Poros, PartGraphMemoryBudgetHierarchyFile)
+{
+  GridGraphGenerator gen(15, 15, 15);
+
+  Graph g = gen.generate();
+
+  std::string const filename("Poros_test_budget.hier");
+  std::remove(filename.c_str());
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.hierarchyFile = filename.c_str();
+  opts.memoryBudget = 1024;
+
+  // in the low memory configuration no hierarchy is kept to be saved, but a
+  // saved one is still loaded
+  for (int pass = 0; pass < 3; ++pass) {
+    if (pass == 1) {
+      opts.memoryBudget = 0;
+    } else if (pass == 2) {
+      opts.memoryBudget = 1024;
+    }
+
+    wgt_type cutEdgeWeight;
+    sl::Array<pid_type> where(g.numVertices());
+    int r = POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+        g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+        4, &opts, &cutEdgeWeight, where.data());
+
+    testEqual(r, 1);
+    testEqual(std::ifstream(filename).good(), pass > 0) << "Pass " << pass;
+
+    Partitioning part(4, &g, std::move(where));
+    TargetPartitioning target(part.numPartitions(), \
+        g.getTotalVertexWeight(), 0.03);
+    PartitioningAnalyzer analyzer(&part, &target);
+
+    testLess(analyzer.calcMaxImbalance(), 0.03005);
+    testEqual(part.getCutEdgeWeight(), cutEdgeWeight);
+  }
+
+  std::remove(filename.c_str());
+}
+
+
+UNITTEST(Poros, StreamPartGraphRecursive)
+{
+  GridGraphGenerator gen(15, 15, 15);
+  gen.setRandomVertexWeight(1, 3);
+  gen.setRandomEdgeWeight(1, 5);
+
+  Graph g = gen.generate();
+
+  poros_stream_struct * stream = POROS_StreamCreate(g.numVertices(), \
+      g.numEdges(), 1, 1);
+
+  // stream the graph in blocks with local edge prefixes
+  vtx_type const blockSize = 1000;
+  for (vtx_type start = 0; start < g.numVertices(); start += blockSize) {
+    vtx_type const end = std::min(start + blockSize, g.numVertices());
+    std::vector<adj_type> prefix(end-start+1);
+    for (vtx_type v = start; v <= end; ++v) {
+      prefix[v-start] = g.getEdgePrefix()[v] - g.getEdgePrefix()[start];
+    }
+    int r = POROS_StreamAddVertices(stream, end-start, prefix.data(), \
+        g.getEdgeList() + g.getEdgePrefix()[start], \
+        g.getVertexWeight() + start, \
+        g.getEdgeWeight() + g.getEdgePrefix()[start]);
+    testEqual(r, 1);
+  }
+
+  poros_options_struct opts = POROS_defaultOptions();
+  for (pid_type k = 3; k < 9; k += 4) {
+    wgt_type cutEdgeWeight;
+    sl::Array<pid_type> where(g.numVertices());
+    int r = POROS_StreamPartGraphRecursive(stream, k, &opts, \
+        &cutEdgeWeight, where.data());
+
+    testEqual(r, 1);
+
+    Partitioning part(k, &g, std::move(where)); 
+    TargetPartitioning target(part.numPartitions(), \
+        g.getTotalVertexWeight(), 0.03);
+    PartitioningAnalyzer analyzer(&part, &target);
+
+    testLess(analyzer.calcMaxImbalance(), 0.03005);
+    testEqual(part.getCutEdgeWeight(), cutEdgeWeight);
+  }
+
+  // no more vertices can be added once partitioned
+  adj_type const prefix[] = {0, 0};
+  testEqual(POROS_StreamAddVertices(stream, 1, prefix, nullptr, nullptr, \
+      nullptr), 0);
+
+  POROS_StreamFree(stream);
+}
+
+
+
+UNITTEST(Poros, PartGraphRecursiveStatistics)
+{
+  GridGraphGenerator gen(20, 20, 20);
+  Graph g = gen.generate();
+
+  poros_stats_struct stats;
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.statistics = &stats;
+
+  wgt_type cutEdgeWeight;
+  sl::Array<pid_type> where(g.numVertices());
+  int r = POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+      4, &opts, &cutEdgeWeight, where.data());
+  testEqual(r, 1);
+
+  testGreater(stats.numLevels, 1);
+
+  // the graph and then each of its halves are bisected at the finest level,
+  // and the cuts of the bisections make up the total cut
+  poros_level_stats_struct const & finest = stats.levels[0];
+  testEqual(finest.numBisections, 3U);
+  testEqual(finest.numVertices, 2U*g.numVertices());
+  testEqual(finest.refinedCut, static_cast<uint64_t>(cutEdgeWeight));
+
+  for (int i = 0; i+1 < stats.numLevels; ++i) {
+    poros_level_stats_struct const & fine = stats.levels[i];
+    poros_level_stats_struct const & coarse = stats.levels[i+1];
+    testLessOrEqual(coarse.numBisections, fine.numBisections);
+    testLess(coarse.numVertices, fine.numVertices);
+    testLessOrEqual(fine.refinedCut, fine.initialCut);
+    testLessOrEqual(fine.numKeptMoves, fine.numMoves);
+    testGreater(fine.numPasses, 0U);
+  }
+
+  // the coarsest level is only bisected, not refined
+  poros_level_stats_struct const & coarsest = stats.levels[stats.numLevels-1];
+  testEqual(coarsest.initialCut, coarsest.refinedCut);
+  testEqual(coarsest.numMoves, 0U);
+  testEqual(coarsest.numPasses, 0U);
+}
+
+UNITTEST(Poros, PartGraphWithContext)
+{
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.randomSeed = 5;
+  opts.numGlobalCuts = 2;
+
+  poros_context_struct * context = POROS_ContextCreate(&opts);
+
+  // the working buffers must both grow and be re-used as the graphs change
+  std::vector<Graph> graphs;
+  GridGraphGenerator medium(12, 12, 12);
+  graphs.emplace_back(medium.generate());
+  GridGraphGenerator small(6, 9, 4);
+  small.setRandomVertexWeight(1, 5);
+  graphs.emplace_back(small.generate());
+  GridGraphGenerator large(20, 15, 10);
+  large.setRandomEdgeWeight(1, 3);
+  graphs.emplace_back(large.generate());
+
+  for (Graph const & g : graphs) {
+    for (pid_type const k : {2, 7, 16}) {
+      wgt_type expectedCut;
+      sl::Array<pid_type> expected(g.numVertices());
+      testEqual(POROS_PartGraphRecursive(g.numVertices(), \
+          g.getEdgePrefix(), g.getEdgeList(), g.getVertexWeight(), \
+          g.getEdgeWeight(), k, &opts, &expectedCut, expected.data()), 1);
+
+      wgt_type actualCut;
+      sl::Array<pid_type> actual(g.numVertices());
+      testEqual(POROS_PartGraphWithContext(context, g.numVertices(), \
+          g.getEdgePrefix(), g.getEdgeList(), g.getVertexWeight(), \
+          g.getEdgeWeight(), k, &actualCut, actual.data()), 1);
+
+      testEqual(actualCut, expectedCut);
+      for (Vertex const v : g.vertices()) {
+        testEqual(actual[v.index], expected[v.index]) << "k = " << k;
+      }
+    }
+  }
+
+  POROS_ContextDestroy(context);
+}
+
+UNITTEST(Poros, ContextCreateNullOptions)
+{
+  testEqual(POROS_ContextCreate(nullptr), \
+      static_cast<poros_context_struct*>(nullptr));
+  POROS_ContextDestroy(nullptr);
+}
+
+namespace
+{
+
+struct progress_record_struct
+{
+  std::vector<poros_progress_struct> reports;
+  size_t cancelAfter;
+};
+
+int recordProgress(
+    poros_progress_struct const * const progress,
+    void * const data)
+{
+  progress_record_struct * const record = \
+      static_cast<progress_record_struct*>(data);
+  record->reports.emplace_back(*progress);
+  return record->reports.size() >= record->cancelAfter;
+}
+
+}
+
+UNITTEST(Poros, PartGraphProgress)
+{
+  GridGraphGenerator gen(15, 15, 15);
+  Graph g = gen.generate();
+
+  progress_record_struct record{{}, static_cast<size_t>(-1)};
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.numGlobalCuts = 2;
+  opts.progressCallback = recordProgress;
+  opts.progressData = &record;
+
+  wgt_type cutEdgeWeight;
+  sl::Array<pid_type> where(g.numVertices());
+  int r = POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+      8, &opts, &cutEdgeWeight, where.data());
+  testEqual(r, 1);
+
+  // each trial ends with a report of the best cut so far, and bisections
+  // reach a depth of 2 for 8 partitions
+  int numTrials = 0;
+  int maxDepth = 0;
+  for (poros_progress_struct const & progress : record.reports) {
+    testEqual(progress.trial, numTrials);
+    maxDepth = std::max(maxDepth, progress.depth);
+    if (progress.phase == PARTITIONING_PHASE) {
+      testEqual(progress.hasBestCut, 1);
+      ++numTrials;
+    } else {
+      testEqual(progress.hasBestCut, numTrials > 0 ? 1 : 0);
+    }
+  }
+  testEqual(numTrials, 2);
+  testEqual(maxDepth, 2);
+  testEqual(record.reports.back().phase, \
+      static_cast<int>(PARTITIONING_PHASE));
+  testEqual(record.reports.back().bestCut, cutEdgeWeight);
+}
+
+UNITTEST(Poros, PartGraphCancel)
+{
+  GridGraphGenerator gen(15, 15, 15);
+  Graph g = gen.generate();
+
+  progress_record_struct record{{}, 5};
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.progressCallback = recordProgress;
+  opts.progressData = &record;
+
+  wgt_type cutEdgeWeight;
+  sl::Array<pid_type> where(g.numVertices());
+  int r = POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+      8, &opts, &cutEdgeWeight, where.data());
+  testEqual(r, 0);
+  testEqual(record.reports.size(), 5u);
+
+  // a context is left usable by a cancelled partitioning
+  poros_context_struct * context = POROS_ContextCreate(&opts);
+  record.reports.clear();
+  testEqual(POROS_PartGraphWithContext(context, g.numVertices(), \
+      g.getEdgePrefix(), g.getEdgeList(), g.getVertexWeight(), \
+      g.getEdgeWeight(), 8, &cutEdgeWeight, where.data()), 0);
+
+  record.reports.clear();
+  record.cancelAfter = static_cast<size_t>(-1);
+  testEqual(POROS_PartGraphWithContext(context, g.numVertices(), \
+      g.getEdgePrefix(), g.getEdgeList(), g.getVertexWeight(), \
+      g.getEdgeWeight(), 8, &cutEdgeWeight, where.data()), 1);
+  POROS_ContextDestroy(context);
+
+  opts.progressCallback = nullptr;
+  wgt_type expectedCut;
+  sl::Array<pid_type> expected(g.numVertices());
+  testEqual(POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+      8, &opts, &expectedCut, expected.data()), 1);
+  testEqual(cutEdgeWeight, expectedCut);
+  for (Vertex const v : g.vertices()) {
+    testEqual(where[v.index], expected[v.index]);
+  }
+}
+
+UNITTEST(Poros, PartGraphBatch)
+{
+  // graphs of several sizes and weightings, each with its own number of
+  // partitions
+  std::vector<Graph> graphs;
+  for (vtx_type i = 0; i < 12; ++i) {
+    GridGraphGenerator gen(4+i, 5+(i%3), 3+(i%4));
+    if (i % 3 == 1) {
+      gen.setRandomVertexWeight(1, 4);
+    } else if (i % 3 == 2) {
+      gen.setRandomEdgeWeight(1, 3);
+    }
+    graphs.emplace_back(gen.generate());
+  }
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.randomSeed = 3;
+
+  std::vector<sl::Array<pid_type>> where;
+  std::vector<poros_batch_graph_struct> batch;
+  for (size_t i = 0; i < graphs.size(); ++i) {
+    Graph const & g = graphs[i];
+    where.emplace_back(g.numVertices());
+    batch.emplace_back(poros_batch_graph_struct{g.numVertices(), \
+        g.getEdgePrefix(), g.getEdgeList(), g.getVertexWeight(), \
+        g.getEdgeWeight(), static_cast<pid_type>(2+(i%7)), 0, \
+        where.back().data(), 0});
+  }
+
+  testEqual(POROS_PartGraphBatch(batch.data(), batch.size(), &opts), 1);
+
+  for (size_t i = 0; i < graphs.size(); ++i) {
+    Graph const & g = graphs[i];
+    testEqual(batch[i].status, 1);
+
+    wgt_type expectedCut;
+    sl::Array<pid_type> expected(g.numVertices());
+    testEqual(POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+        g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), \
+        batch[i].numPartitions, &opts, &expectedCut, expected.data()), 1);
+
+    testEqual(batch[i].totalCutEdgeWeight, expectedCut);
+    for (Vertex const v : g.vertices()) {
+      testEqual(where[i][v.index], expected[v.index]) << "Graph " << i;
+    }
+  }
+}
+
+UNITTEST(Poros, PartGraphBatchInvalidOptions)
+{
+  GridGraphGenerator gen(5, 5, 5);
+  Graph g = gen.generate();
+
+  sl::Array<pid_type> where(g.numVertices());
+  poros_batch_graph_struct desc{g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), nullptr, nullptr, 2, 0, where.data(), 0};
+
+  poros_stats_struct stats;
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.statistics = &stats;
+  testEqual(POROS_PartGraphBatch(&desc, 1, &opts), 0);
+  testEqual(POROS_PartGraphBatch(&desc, 1, nullptr), 0);
+  testEqual(desc.status, 0);
+
+  // an empty batch succeeds
+  opts.statistics = nullptr;
+  testEqual(POROS_PartGraphBatch(nullptr, 0, &opts), 1);
+}
+
+UNITTEST(Poros, StreamIncomplete)
+{
+  poros_stream_struct * stream = POROS_StreamCreate(3, 4, 0, 0);
+
+  adj_type const prefix[] = {0, 1, 3};
+  vtx_type const edges[] = {1, 0, 2};
+  testEqual(POROS_StreamAddVertices(stream, 2, prefix, edges, nullptr, \
+      nullptr), 1);
+
+  poros_options_struct opts = POROS_defaultOptions();
+  wgt_type cutEdgeWeight;
+  pid_type where[3];
+  testEqual(POROS_StreamPartGraphRecursive(stream, 2, &opts, \
+      &cutEdgeWeight, where), 0);
+
+  POROS_StreamFree(stream);
+}
+
+UNITTEST(Poros, PresetOptions)
+{
+  poros_options_struct const defaults = POROS_defaultOptions();
+  poros_options_struct const preset = POROS_presetOptions(DEFAULT_PRESET);
+  testEqual(preset.refinementIterations, defaults.refinementIterations);
+  testEqual(preset.numInitialBisections, defaults.numInitialBisections);
+  testEqual(preset.coarsestNumVertices, defaults.coarsestNumVertices);
+  testEqual(preset.numGlobalCuts, defaults.numGlobalCuts);
+
+  poros_options_struct const fast = POROS_presetOptions(FAST_PRESET);
+  poros_options_struct const quality = POROS_presetOptions(QUALITY_PRESET);
+  testLess(fast.numInitialBisections, defaults.numInitialBisections);
+  testLess(fast.refinementIterations, defaults.refinementIterations);
+  testGreater(quality.numInitialBisections, defaults.numInitialBisections);
+  testGreater(quality.refinementIterations, defaults.refinementIterations);
+
+  GridGraphGenerator gen(15, 15, 15);
+  Graph g = gen.generate();
+
+  for (int const p : {FAST_PRESET, DEFAULT_PRESET, QUALITY_PRESET}) {
+    poros_options_struct opts = POROS_presetOptions(p);
+
+    wgt_type cutEdgeWeight;
+    sl::Array<pid_type> where(g.numVertices());
+    testEqual(POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+        g.getEdgeList(), g.getVertexWeight(), g.getEdgeWeight(), 8, &opts, \
+        &cutEdgeWeight, where.data()), 1);
+
+    Partitioning part(8, &g, std::move(where));
+    TargetPartitioning target(part.numPartitions(), \
+        g.getTotalVertexWeight(), opts.imbalanceTolerance);
+    PartitioningAnalyzer analyzer(&part, &target);
+    testEqual(part.getCutEdgeWeight(), cutEdgeWeight);
+    testTrue(analyzer.isBalanced()) << "Preset " << p;
+  }
+}
+
+UNITTEST(Poros, PartGraphInvalidPresetValues)
+{
+  GridGraphGenerator gen(5, 5, 5);
+  Graph g = gen.generate();
+
+  poros_options_struct opts = POROS_defaultOptions();
+  opts.coarsestNumVertices = 0;
+
+  wgt_type cutEdgeWeight;
+  sl::Array<pid_type> where(g.numVertices());
+  testEqual(POROS_PartGraphRecursive(g.numVertices(), g.getEdgePrefix(), \
+      g.getEdgeList(), nullptr, nullptr, 2, &opts, &cutEdgeWeight, \
+      where.data()), 0);
+}
+
 }
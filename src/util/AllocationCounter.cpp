@@ -0,0 +1,175 @@
+/**
+* @file AllocationCounter.cpp
+* @brief Implementation of the AllocationCounter class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-28
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "AllocationCounter.hpp"
+
+#ifdef POROS_ALLOCATION_COUNTING
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+// plain integers need no thread_local initialization, so they can be
+// touched from within operator new at any time
+thread_local uint64_t s_count = 0;
+thread_local uint64_t s_bytes = 0;
+
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+AllocationCounter::sample_struct AllocationCounter::read() noexcept
+{
+  return sample_struct{s_count, s_bytes};
+}
+
+
+void AllocationCounter::reportAllocation(
+    size_t const bytes) noexcept
+{
+  ++s_count;
+  s_bytes += bytes;
+}
+
+
+}
+
+
+#ifdef POROS_ALLOCATION_COUNTING
+
+/******************************************************************************
+* REPLACEMENT ALLOCATION FUNCTIONS ********************************************
+******************************************************************************/
+
+namespace
+{
+
+void * countedAllocate(
+    size_t const bytes) noexcept
+{
+  poros::AllocationCounter::reportAllocation(bytes);
+  // malloc(0) may return null, but operator new may not
+  return std::malloc(bytes > 0 ? bytes : 1);
+}
+
+}
+
+
+void * operator new(
+    size_t const bytes)
+{
+  void * const ptr = countedAllocate(bytes);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+
+void * operator new[](
+    size_t const bytes)
+{
+  return operator new(bytes);
+}
+
+
+void * operator new(
+    size_t const bytes,
+    std::nothrow_t const &) noexcept
+{
+  return countedAllocate(bytes);
+}
+
+
+void * operator new[](
+    size_t const bytes,
+    std::nothrow_t const &) noexcept
+{
+  return countedAllocate(bytes);
+}
+
+
+void operator delete(
+    void * const ptr) noexcept
+{
+  std::free(ptr);
+}
+
+
+void operator delete[](
+    void * const ptr) noexcept
+{
+  std::free(ptr);
+}
+
+
+void operator delete(
+    void * const ptr,
+    std::nothrow_t const &) noexcept
+{
+  std::free(ptr);
+}
+
+
+void operator delete[](
+    void * const ptr,
+    std::nothrow_t const &) noexcept
+{
+  std::free(ptr);
+}
+
+
+void operator delete(
+    void * const ptr,
+    size_t) noexcept
+{
+  std::free(ptr);
+}
+
+
+void operator delete[](
+    void * const ptr,
+    size_t) noexcept
+{
+  std::free(ptr);
+}
+
+#endif
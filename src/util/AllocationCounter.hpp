@@ -0,0 +1,88 @@
+/**
+* @file AllocationCounter.hpp
+* @brief The AllocationCounter class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-28
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_ALLOCATIONCOUNTER_HPP
+#define POROS_SRC_UTIL_ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace poros
+{
+
+/**
+* @brief Counts the number and bytes of the allocations made through
+* `operator new` on each thread. The counting is only compiled in when built
+* with POROS_ALLOCATION_COUNTING, as it replaces the global allocation
+* functions of the process; otherwise the counts are always zero.
+*/
+class AllocationCounter
+{
+  public:
+    /**
+    * @brief The allocations made by a thread up to a point in time.
+    */
+    struct sample_struct
+    {
+      uint64_t count;
+      uint64_t bytes;
+    };
+
+    /**
+    * @brief Check whether allocations are counted in this build.
+    *
+    * @return True if they are.
+    */
+    static constexpr bool isEnabled() noexcept
+    {
+      #ifdef POROS_ALLOCATION_COUNTING
+      return true;
+      #else
+      return false;
+      #endif
+    }
+
+    /**
+    * @brief Read the allocations made by the calling thread so far.
+    *
+    * @return The number and bytes of the allocations.
+    */
+    static sample_struct read() noexcept;
+
+    /**
+    * @brief Count an allocation on the calling thread.
+    *
+    * @param bytes The size of the allocation.
+    */
+    static void reportAllocation(
+        size_t bytes) noexcept;
+};
+
+}
+
+#endif
@@ -0,0 +1,96 @@
+/**
+* @file Deadline.cpp
+* @brief Implementation of the Deadline class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Deadline.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+Deadline::Deadline() noexcept :
+  m_isSet(false),
+  m_start(clock_type::now()),
+  m_end(m_start)
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void Deadline::restart(
+    double const seconds) noexcept
+{
+  m_isSet = seconds > 0;
+  m_start = clock_type::now();
+
+  // limits too long for the clock (including infinite ones) never pass,
+  // and the margin keeps rounding from overflowing the conversion below
+  std::chrono::duration<double> const maxSeconds = \
+      clock_type::time_point::max() - m_start;
+  if (!m_isSet) {
+    m_end = m_start;
+  } else if (seconds >= maxSeconds.count() - 1.0) {
+    m_end = clock_type::time_point::max();
+  } else {
+    m_end = m_start + std::chrono::duration_cast<clock_type::duration>( \
+        std::chrono::duration<double>(seconds));
+  }
+}
+
+
+bool Deadline::hasPassed() const noexcept
+{
+  return m_isSet && clock_type::now() >= m_end;
+}
+
+
+double Deadline::elapsed() const noexcept
+{
+  return std::chrono::duration<double>(clock_type::now() - m_start).count();
+}
+
+
+double Deadline::remaining() const noexcept
+{
+  if (!m_isSet) {
+    return 0.0;
+  }
+
+  return std::chrono::duration<double>(m_end - clock_type::now()).count();
+}
+
+
+}
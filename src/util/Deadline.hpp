@@ -0,0 +1,104 @@
+/**
+* @file Deadline.hpp
+* @brief The Deadline class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_DEADLINE_HPP
+#define POROS_SRC_UTIL_DEADLINE_HPP
+
+
+#include <chrono>
+
+
+namespace poros
+{
+
+/**
+* @brief A point in time by which work should finish. A deadline may be unset,
+* in which case it never passes.
+*/
+class Deadline
+{
+  public:
+    /**
+    * @brief Create an unset deadline.
+    */
+    Deadline() noexcept;
+
+    /**
+    * @brief Restart the deadline, so that it passes a number of seconds from
+    * now.
+    *
+    * @param seconds The number of seconds (if not positive, the deadline is
+    * unset, and if too many for the clock, it never passes).
+    */
+    void restart(
+        double seconds) noexcept;
+
+    /**
+    * @brief Check whether the deadline is set.
+    *
+    * @return True if it is set.
+    */
+    bool isSet() const noexcept
+    {
+      return m_isSet;
+    }
+
+    /**
+    * @brief Check whether the deadline has passed. This reads the clock, and
+    * so should not be called for every small unit of work.
+    *
+    * @return True if it is set and has passed.
+    */
+    bool hasPassed() const noexcept;
+
+    /**
+    * @brief Get the number of seconds since the deadline was last restarted.
+    *
+    * @return The number of seconds.
+    */
+    double elapsed() const noexcept;
+
+    /**
+    * @brief Get the number of seconds left until the deadline passes.
+    *
+    * @return The number of seconds (negative once it has passed, and 0 if
+    * it is unset).
+    */
+    double remaining() const noexcept;
+
+  private:
+    using clock_type = std::chrono::steady_clock;
+
+    bool m_isSet;
+    clock_type::time_point m_start;
+    clock_type::time_point m_end;
+};
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+/**
+* @file LineParser.cpp
+* @brief Implementation of the LineParser class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "LineParser.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief The smallest chunk worth handing to a thread.
+*/
+size_t const MIN_CHUNK_BYTES = 1 << 20;
+
+/**
+* @brief The number of chunks to make per thread, to even out differences in
+* line lengths.
+*/
+int const CHUNKS_PER_THREAD = 4;
+
+/**
+* @brief The longest excerpt of a line to put in an error message.
+*/
+size_t const MAX_EXCERPT_LENGTH = 64;
+
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+std::vector<LineParser::range_type> LineParser::split(
+    char const * const begin,
+    char const * const end)
+{
+  size_t const numBytes = end - begin;
+
+  size_t maxChunks = 1;
+  #ifdef _OPENMP
+  maxChunks = static_cast<size_t>(omp_get_max_threads()*CHUNKS_PER_THREAD);
+  #endif
+  size_t const numChunks = std::max<size_t>(1, \
+      std::min(maxChunks, numBytes / MIN_CHUNK_BYTES));
+
+  std::vector<range_type> chunks;
+  chunks.reserve(numChunks);
+
+  char const * chunkBegin = begin;
+  for (size_t i = 1; i <= numChunks; ++i) {
+    char const * chunkEnd = end;
+    if (i < numChunks) {
+      chunkEnd = std::max(chunkBegin, begin + (numBytes*i)/numChunks);
+      chunkEnd = nextLine(findLineEnd(chunkEnd, end), end);
+    }
+    chunks.emplace_back(chunkBegin, chunkEnd);
+    chunkBegin = chunkEnd;
+  }
+
+  return chunks;
+}
+
+
+size_t LineParser::countTokens(
+    char const * ptr,
+    char const * const end) noexcept
+{
+  size_t numTokens = 0;
+  ptr = skipSpace(ptr, end);
+  while (ptr < end) {
+    ++numTokens;
+    while (ptr < end && !isSpace(*ptr)) {
+      ++ptr;
+    }
+    ptr = skipSpace(ptr, end);
+  }
+  return numTokens;
+}
+
+
+bool LineParser::parseReal(
+    char const ** const ptr,
+    char const * const end,
+    double * const value) noexcept
+{
+  char const * pos = *ptr;
+
+  bool negative = false;
+  if (pos < end && (*pos == '-' || *pos == '+')) {
+    negative = *pos == '-';
+    ++pos;
+  }
+
+  double number = 0;
+  size_t numDigits = 0;
+  while (pos < end && *pos >= '0' && *pos <= '9') {
+    number = number*10 + (*pos - '0');
+    ++pos;
+    ++numDigits;
+  }
+
+  int exponent = 0;
+  if (pos < end && *pos == '.') {
+    ++pos;
+    while (pos < end && *pos >= '0' && *pos <= '9') {
+      number = number*10 + (*pos - '0');
+      --exponent;
+      ++pos;
+      ++numDigits;
+    }
+  }
+
+  if (numDigits == 0) {
+    return false;
+  }
+
+  if (pos < end && (*pos == 'e' || *pos == 'E')) {
+    ++pos;
+    bool negativeExponent = false;
+    if (pos < end && (*pos == '-' || *pos == '+')) {
+      negativeExponent = *pos == '-';
+      ++pos;
+    }
+    int explicitExponent;
+    if (!parseUnsigned(&pos, end, &explicitExponent)) {
+      return false;
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  } else if (pos < end && !isSpace(*pos)) {
+    return false;
+  }
+
+  number *= std::pow(10.0, exponent);
+
+  *value = negative ? -number : number;
+  *ptr = skipSpace(pos, end);
+  return true;
+}
+
+
+std::string LineParser::excerpt(
+    char const * const line,
+    char const * const end)
+{
+  return std::string(line, std::min<size_t>(end - line, MAX_EXCERPT_LENGTH));
+}
+
+
+}
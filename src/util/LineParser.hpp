@@ -0,0 +1,207 @@
+/**
+* @file LineParser.hpp
+* @brief The LineParser class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_LINEPARSER_HPP
+#define POROS_SRC_UTIL_LINEPARSER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace poros
+{
+
+/**
+* @brief Helpers for parsing line oriented text which is not null terminated
+* (such as memory mapped files), split into line aligned chunks which can be
+* parsed independently.
+*/
+class LineParser
+{
+  public:
+    /**
+    * @brief A range of text.
+    */
+    typedef std::pair<char const *, char const *> range_type;
+
+    /**
+    * @brief Split text into line aligned chunks. The number of chunks is
+    * chosen based on the size of the text and the number of threads
+    * available.
+    *
+    * @param begin The start of the text.
+    * @param end The end of the text.
+    *
+    * @return The chunks, in order.
+    */
+    static std::vector<range_type> split(
+        char const * begin,
+        char const * end);
+
+    /**
+    * @brief Check if a character is whitespace within a line.
+    *
+    * @param c The character.
+    *
+    * @return True if it is whitespace.
+    */
+    static bool isSpace(
+        char const c) noexcept
+    {
+      return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    /**
+    * @brief Skip whitespace within a line.
+    *
+    * @param ptr The current position.
+    * @param end The end of the line.
+    *
+    * @return The first position which is not whitespace.
+    */
+    static char const * skipSpace(
+        char const * ptr,
+        char const * const end) noexcept
+    {
+      while (ptr < end && isSpace(*ptr)) {
+        ++ptr;
+      }
+      return ptr;
+    }
+
+    /**
+    * @brief Find the end of a line.
+    *
+    * @param ptr The start of the line.
+    * @param end The end of the text.
+    *
+    * @return The position of the newline, or the end of the text.
+    */
+    static char const * findLineEnd(
+        char const * const ptr,
+        char const * const end) noexcept
+    {
+      void const * const newline = std::memchr(ptr, '\n', end - ptr);
+      return newline ? static_cast<char const *>(newline) : end;
+    }
+
+    /**
+    * @brief Get the start of the next line.
+    *
+    * @param lineEnd The end of the current line.
+    * @param end The end of the text.
+    *
+    * @return The start of the next line, or the end of the text.
+    */
+    static char const * nextLine(
+        char const * const lineEnd,
+        char const * const end) noexcept
+    {
+      return lineEnd < end ? lineEnd + 1 : end;
+    }
+
+    /**
+    * @brief Count the whitespace separated tokens in a line.
+    *
+    * @param ptr The start of the line.
+    * @param end The end of the line.
+    *
+    * @return The number of tokens.
+    */
+    static size_t countTokens(
+        char const * ptr,
+        char const * end) noexcept;
+
+    /**
+    * @brief Parse an unsigned integer and advance past it and any whitespace
+    * which follows.
+    *
+    * @tparam T The type of integer.
+    * @param ptr The current position (updated on success).
+    * @param end The end of the line.
+    * @param value The parsed value (output).
+    *
+    * @return True if a number was parsed.
+    */
+    template<typename T>
+    static bool parseUnsigned(
+        char const ** const ptr,
+        char const * const end,
+        T * const value) noexcept
+    {
+      char const * pos = *ptr;
+
+      T number = 0;
+      char const * const start = pos;
+      while (pos < end && *pos >= '0' && *pos <= '9') {
+        number = number*10 + static_cast<T>(*pos - '0');
+        ++pos;
+      }
+
+      if (pos == start || (pos < end && !isSpace(*pos))) {
+        return false;
+      }
+
+      *value = number;
+      *ptr = skipSpace(pos, end);
+      return true;
+    }
+
+    /**
+    * @brief Parse a real number (in fixed or scientific notation) and advance
+    * past it and any whitespace which follows.
+    *
+    * @param ptr The current position (updated on success).
+    * @param end The end of the line.
+    * @param value The parsed value (output).
+    *
+    * @return True if a number was parsed.
+    */
+    static bool parseReal(
+        char const ** ptr,
+        char const * end,
+        double * value) noexcept;
+
+    /**
+    * @brief Get the start of a line for use in error messages.
+    *
+    * @param line The start of the line.
+    * @param end The end of the line.
+    *
+    * @return The line, truncated.
+    */
+    static std::string excerpt(
+        char const * line,
+        char const * end);
+};
+
+}
+
+#endif
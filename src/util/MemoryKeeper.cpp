@@ -0,0 +1,159 @@
+/**
+* @file MemoryKeeper.cpp
+* @brief Implementation of the MemoryKeeper class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-12
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MemoryKeeper.hpp"
+#include "solidutils/Debug.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+thread_local std::shared_ptr<MemoryKeeper> s_currentKeeper;
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+MemoryKeeper::MemoryKeeper() :
+  m_phase(TOTAL),
+  m_live(0),
+  m_allocated(NUM_MEMORY_CATEGORIES, 0),
+  m_peak(NUM_MEMORY_CATEGORIES, 0),
+  m_names{
+    "Total",
+    "Coarsening",
+    "Initial Partitioning",
+    "Refinement",
+    "Extraction"
+  }
+{
+  ASSERT_EQUAL(m_allocated.size(), m_names.size());
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void MemoryKeeper::reportAllocation(
+    size_t const bytes) noexcept
+{
+  m_live += bytes;
+
+  m_allocated[m_phase] += bytes;
+  m_peak[m_phase] = std::max(m_peak[m_phase], m_live);
+  if (m_phase != TOTAL) {
+    m_allocated[TOTAL] += bytes;
+    m_peak[TOTAL] = std::max(m_peak[TOTAL], m_live);
+  }
+}
+
+
+void MemoryKeeper::reportRelease(
+    size_t const bytes) noexcept
+{
+  ASSERT_LESSEQUAL(bytes, m_live);
+  m_live -= bytes;
+}
+
+
+void MemoryKeeper::setPhase(
+    uint32_t const key)
+{
+  if (key >= m_names.size()) {
+    throw std::runtime_error("Got key " + std::to_string(key) + "/" +
+        std::to_string(m_names.size()));
+  }
+
+  m_phase = key;
+}
+
+
+size_t MemoryKeeper::getPeakBytes(
+    uint32_t const key) const
+{
+  if (key >= m_peak.size()) {
+    throw std::runtime_error("Got key " + std::to_string(key) + "/" +
+        std::to_string(m_peak.size()));
+  }
+
+  return m_peak[key];
+}
+
+
+void MemoryKeeper::clear() noexcept
+{
+  std::fill(m_allocated.begin(), m_allocated.end(), 0);
+  std::fill(m_peak.begin(), m_peak.end(), m_live);
+}
+
+
+std::vector<MemoryKeeper::usage_struct> MemoryKeeper::usage() const
+{
+  std::vector<usage_struct> data;
+  data.reserve(m_names.size());
+
+  for (size_t i = 0; i < m_names.size(); ++i) {
+    data.push_back(usage_struct{m_names[i], m_allocated[i], m_peak[i]});
+  }
+
+  return data;
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+std::shared_ptr<MemoryKeeper> MemoryKeeper::current()
+{
+  return s_currentKeeper;
+}
+
+
+void MemoryKeeper::setCurrent(
+    std::shared_ptr<MemoryKeeper> keeper)
+{
+  s_currentKeeper = std::move(keeper);
+}
+
+
+}
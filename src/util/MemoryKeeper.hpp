@@ -0,0 +1,188 @@
+/**
+* @file MemoryKeeper.hpp
+* @brief The MemoryKeeper class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-12
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_MEMORYKEEPER_HPP
+#define POROS_SRC_UTIL_MEMORYKEEPER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace poros
+{
+
+/**
+* @brief Keeps track of the number of bytes allocated by poros containers,
+* and the peak number of bytes live, for each phase of partitioning.
+* Allocations are attributed to the phase which is current when they are
+* made (see MemoryScope), and containers report them through TrackedMemory.
+*/
+class MemoryKeeper
+{
+  public:
+    enum {
+      TOTAL,
+      COARSENING,
+      INITIAL_PARTITIONING,
+      REFINEMENT,
+      EXTRACTION,
+      NUM_MEMORY_CATEGORIES
+    };
+
+    /**
+    * @brief The bytes recorded for a single phase.
+    */
+    struct usage_struct
+    {
+      std::string name;
+      size_t allocated;
+      size_t peak;
+    };
+
+    /**
+    * @brief Default constructor.
+    */
+    MemoryKeeper();
+
+    /**
+    * @brief Deleted copy constructor.
+    *
+    * @param rhs The MemoryKeeper to copy.
+    */
+    MemoryKeeper(
+        MemoryKeeper const & rhs) = delete;
+
+    /**
+    * @brief Deleted copy-assignment operator.
+    *
+    * @param rhs The MemoryKeeper to copy.
+    *
+    * @return This MemoryKeeper.
+    */
+    MemoryKeeper& operator=(
+        MemoryKeeper const & rhs) = delete;
+
+    /**
+    * @brief Record an allocation in the current phase.
+    *
+    * @param bytes The number of bytes allocated.
+    */
+    void reportAllocation(
+        size_t bytes) noexcept;
+
+    /**
+    * @brief Record the release of memory.
+    *
+    * @param bytes The number of bytes released.
+    */
+    void reportRelease(
+        size_t bytes) noexcept;
+
+    /**
+    * @brief Set the phase new allocations will be attributed to.
+    *
+    * @param key The phase.
+    *
+    * @throws An exception if the key is not a valid phase.
+    */
+    void setPhase(
+        uint32_t key);
+
+    /**
+    * @brief Get the phase new allocations are attributed to.
+    *
+    * @return The phase.
+    */
+    uint32_t getPhase() const noexcept
+    {
+      return m_phase;
+    }
+
+    /**
+    * @brief Get the number of bytes currently live.
+    *
+    * @return The number of bytes.
+    */
+    size_t getLiveBytes() const noexcept
+    {
+      return m_live;
+    }
+
+    /**
+    * @brief Get the peak number of bytes live during a phase.
+    *
+    * @param key The phase.
+    *
+    * @return The number of bytes.
+    */
+    size_t getPeakBytes(
+        uint32_t key) const;
+
+    /**
+    * @brief Discard the allocations and peaks recorded so far. Memory which
+    * is still live remains counted, and is where the new peaks start from.
+    */
+    void clear() noexcept;
+
+    /**
+    * @brief Get the usage for each phase.
+    *
+    * @return The usage.
+    */
+    std::vector<usage_struct> usage() const;
+
+    /**
+    * @brief Get the memory keeper that allocations on this thread are
+    * reported to.
+    *
+    * @return The memory keeper (may be null).
+    */
+    static std::shared_ptr<MemoryKeeper> current();
+
+    /**
+    * @brief Set the memory keeper that allocations on this thread are
+    * reported to.
+    *
+    * @param keeper The memory keeper (may be null).
+    */
+    static void setCurrent(
+        std::shared_ptr<MemoryKeeper> keeper);
+
+  private:
+    uint32_t m_phase;
+    size_t m_live;
+    std::vector<size_t> m_allocated;
+    std::vector<size_t> m_peak;
+    std::vector<std::string> m_names;
+};
+
+}
+
+#endif
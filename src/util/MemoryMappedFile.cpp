@@ -0,0 +1,124 @@
+/**
+* @file MemoryMappedFile.cpp
+* @brief Implementation of the MemoryMappedFile class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MemoryMappedFile.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POROS_HAS_MMAP 1
+#endif
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+std::runtime_error fileError(
+    std::string const & action,
+    std::string const & filename)
+{
+  return std::runtime_error("Failed to " + action + " '" + filename + "': " + \
+      std::strerror(errno));
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+MemoryMappedFile::MemoryMappedFile(
+    std::string const & filename,
+    bool const sequential) :
+  m_data(nullptr),
+  m_size(0)
+{
+  #ifdef POROS_HAS_MMAP
+  int const fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw fileError("open", filename);
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    std::runtime_error const error = fileError("stat", filename);
+    close(fd);
+    throw error;
+  }
+
+  m_size = static_cast<size_t>(info.st_size);
+  if (m_size > 0) {
+    void * const ptr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr == MAP_FAILED) {
+      std::runtime_error const error = fileError("map", filename);
+      close(fd);
+      throw error;
+    }
+
+    if (sequential) {
+      madvise(ptr, m_size, MADV_SEQUENTIAL);
+    }
+
+    m_data = static_cast<char const *>(ptr);
+  }
+
+  // the mapping remains valid after the descriptor is closed
+  close(fd);
+  #else
+  (void)sequential;
+  throw std::runtime_error("Memory mapping '" + filename + "' is not " \
+      "supported on this platform.");
+  #endif
+}
+
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  #ifdef POROS_HAS_MMAP
+  if (m_data != nullptr) {
+    munmap(const_cast<char*>(m_data), m_size);
+  }
+  #endif
+}
+
+
+}
@@ -0,0 +1,99 @@
+/**
+* @file MemoryMappedFile.hpp
+* @brief The MemoryMappedFile class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_MEMORYMAPPEDFILE_HPP
+#define POROS_SRC_UTIL_MEMORYMAPPEDFILE_HPP
+
+#include "util/IAllocatedData.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace poros
+{
+
+/**
+* @brief A read-only mapping of a file into memory. The mapping is removed
+* when the object is destroyed.
+*/
+class MemoryMappedFile :
+  public IAllocatedData
+{
+  public:
+    /**
+    * @brief Map a file into memory.
+    *
+    * @param filename The name of the file.
+    * @param sequential Whether the file will be read once front to back, so
+    * that the kernel can read ahead aggressively and drop pages behind.
+    *
+    * @throws std::runtime_error If the file cannot be opened or mapped.
+    */
+    MemoryMappedFile(
+        std::string const & filename,
+        bool sequential = true);
+
+    /**
+    * @brief Destructor, which unmaps the file.
+    */
+    ~MemoryMappedFile();
+
+    /**
+    * @brief Get the contents of the file.
+    *
+    * @return The start of the contents (null if the file is empty).
+    */
+    char const * data() const noexcept
+    {
+      return m_data;
+    }
+
+    /**
+    * @brief Get the size of the file.
+    *
+    * @return The number of bytes.
+    */
+    size_t size() const noexcept
+    {
+      return m_size;
+    }
+
+  private:
+    char const * m_data;
+    size_t m_size;
+
+    // disable copying
+    MemoryMappedFile(
+        MemoryMappedFile const & rhs) = delete;
+    MemoryMappedFile & operator=(
+        MemoryMappedFile const & rhs) = delete;
+};
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+/**
+* @file MemoryPolicy.cpp
+* @brief Implementation of the MemoryPolicy class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-20
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MemoryPolicy.hpp"
+
+#include <cstdint>
+
+#if defined(POROS_HUGE_PAGES) && defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief Get the size of a page of memory.
+*
+* @return The number of bytes per page.
+*/
+size_t pageSize() noexcept
+{
+  #if defined(__unix__)
+  long const bytes = sysconf(_SC_PAGESIZE);
+  if (bytes > 0) {
+    return static_cast<size_t>(bytes);
+  }
+  #endif
+  return 4096;
+}
+
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+constexpr size_t const MemoryPolicy::MIN_HUGE_PAGE_BYTES;
+
+
+void MemoryPolicy::prepare(
+    void * const ptr,
+    size_t const bytes) noexcept
+{
+  if (ptr == nullptr || bytes < MIN_HUGE_PAGE_BYTES) {
+    return;
+  }
+
+  adviseHugePages(ptr, bytes);
+
+  #ifdef _OPENMP
+  // touch one byte of each page from the thread which will be given that
+  // block under a static schedule
+  size_t const bytesPerPage = pageSize();
+  size_t const numPages = (bytes + bytesPerPage - 1) / bytesPerPage;
+  char * const data = static_cast<char*>(ptr);
+  #pragma omp parallel for schedule(static)
+  for (size_t page = 0; page < numPages; ++page) {
+    data[page*bytesPerPage] = 0;
+  }
+  #endif
+}
+
+
+void MemoryPolicy::adviseHugePages(
+    void const * const ptr,
+    size_t const bytes) noexcept
+{
+  #if defined(POROS_HUGE_PAGES) && defined(__linux__) && \
+      defined(MADV_HUGEPAGE)
+  if (ptr == nullptr || bytes < MIN_HUGE_PAGE_BYTES) {
+    return;
+  }
+
+  // madvise() requires a page aligned range, so only the pages wholly
+  // within the memory are advised
+  uintptr_t const bytesPerPage = static_cast<uintptr_t>(pageSize());
+  uintptr_t const begin = reinterpret_cast<uintptr_t>(ptr);
+  uintptr_t const start = (begin + bytesPerPage - 1) & ~(bytesPerPage - 1);
+  uintptr_t const end = (begin + bytes) & ~(bytesPerPage - 1);
+  if (start < end) {
+    // this is only advice, so failure is not an error
+    madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE);
+  }
+  #else
+  (void)ptr;
+  (void)bytes;
+  #endif
+}
+
+
+}
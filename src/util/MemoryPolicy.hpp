@@ -0,0 +1,117 @@
+/**
+* @file MemoryPolicy.hpp
+* @brief The MemoryPolicy class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-20
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_MEMORYPOLICY_HPP
+#define POROS_SRC_UTIL_MEMORYPOLICY_HPP
+
+#include "solidutils/Array.hpp"
+
+#include <cstddef>
+
+namespace poros
+{
+
+/**
+* @brief The placement policy for large arrays which are accessed randomly
+* during partitioning (edge arrays, partition assignments, connectivity).
+* When built with POROS_HUGE_PAGES, such arrays are marked as candidates for
+* transparent huge pages, and when built with OpenMP, their pages are first
+* touched by the threads which statically own each block, so that they are
+* placed on those threads' NUMA nodes. Otherwise, this is a plain allocation.
+*/
+class MemoryPolicy
+{
+  public:
+    /**
+    * @brief The size of allocations below which no policy is applied.
+    */
+    static constexpr size_t const MIN_HUGE_PAGE_BYTES = 2*1024*1024;
+
+    /**
+    * @brief Allocate an uninitialized array and apply the policy to it.
+    *
+    * @tparam T The type of element.
+    * @param size The number of elements.
+    *
+    * @return The array.
+    */
+    template<typename T>
+    static sl::Array<T> allocate(
+        size_t const size)
+    {
+      sl::Array<T> array(size);
+      prepare(array.data(), array.size()*sizeof(T));
+      return array;
+    }
+
+    /**
+    * @brief Allocate an array filled with a value, applying the policy before
+    * it is filled.
+    *
+    * @tparam T The type of element.
+    * @param size The number of elements.
+    * @param value The value to fill it with.
+    *
+    * @return The array.
+    */
+    template<typename T>
+    static sl::Array<T> allocate(
+        size_t const size,
+        T const value)
+    {
+      sl::Array<T> array = allocate<T>(size);
+      array.set(value);
+      return array;
+    }
+
+    /**
+    * @brief Apply the policy to memory which has not yet been written to.
+    *
+    * @param ptr The start of the memory.
+    * @param bytes The number of bytes.
+    */
+    static void prepare(
+        void * ptr,
+        size_t bytes) noexcept;
+
+    /**
+    * @brief Request transparent huge pages for memory which may already be
+    * populated (e.g., user supplied arrays). The kernel may then collapse it
+    * into huge pages in the background.
+    *
+    * @param ptr The start of the memory.
+    * @param bytes The number of bytes.
+    */
+    static void adviseHugePages(
+        void const * ptr,
+        size_t bytes) noexcept;
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+/**
+* @file MemoryScope.cpp
+* @brief Implementation of the MemoryScope class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-12
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MemoryScope.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+MemoryScope::MemoryScope(
+    std::shared_ptr<MemoryKeeper> keeper,
+    uint32_t const phase) :
+  m_keeper(std::move(keeper)),
+  m_previousKeeper(MemoryKeeper::current()),
+  m_previousPhase(MemoryKeeper::TOTAL)
+{
+  if (m_keeper) {
+    m_previousPhase = m_keeper->getPhase();
+    m_keeper->setPhase(phase);
+  }
+  MemoryKeeper::setCurrent(m_keeper);
+}
+
+
+MemoryScope::MemoryScope(
+    uint32_t const phase) :
+  MemoryScope(MemoryKeeper::current(), phase)
+{
+  // do nothing
+}
+
+
+MemoryScope::~MemoryScope()
+{
+  if (m_keeper) {
+    m_keeper->setPhase(m_previousPhase);
+  }
+  MemoryKeeper::setCurrent(std::move(m_previousKeeper));
+}
+
+
+}
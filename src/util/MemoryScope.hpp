@@ -0,0 +1,85 @@
+/**
+* @file MemoryScope.hpp
+* @brief The MemoryScope class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-12
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_MEMORYSCOPE_HPP
+#define POROS_SRC_UTIL_MEMORYSCOPE_HPP
+
+#include "MemoryKeeper.hpp"
+
+#include <memory>
+
+namespace poros
+{
+
+/**
+* @brief Makes a memory keeper current on this thread, and sets the phase
+* allocations are attributed to, for the lifetime of the scope. The previous
+* keeper and phase are restored when the scope ends.
+*/
+class MemoryScope
+{
+  public:
+    /**
+    * @brief Enter a new phase of the given keeper.
+    *
+    * @param keeper The memory keeper (may be null, in which case allocations
+    * are not recorded).
+    * @param phase The phase.
+    */
+    MemoryScope(
+        std::shared_ptr<MemoryKeeper> keeper,
+        uint32_t phase);
+
+    /**
+    * @brief Enter a new phase of the current keeper.
+    *
+    * @param phase The phase.
+    */
+    MemoryScope(
+        uint32_t phase);
+
+    /**
+    * @brief Destructor, which restores the previous keeper and phase.
+    */
+    ~MemoryScope();
+
+  private:
+    std::shared_ptr<MemoryKeeper> m_keeper;
+    std::shared_ptr<MemoryKeeper> m_previousKeeper;
+    uint32_t m_previousPhase;
+
+    // disable copying
+    MemoryScope(
+        MemoryScope const & rhs) = delete;
+    MemoryScope & operator=(
+        MemoryScope const & rhs) = delete;
+};
+
+}
+
+#endif
@@ -0,0 +1,201 @@
+/**
+* @file PerfCounters.cpp
+* @brief Implementation of the PerfCounters class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-25
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "PerfCounters.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define POROS_HAS_PERF_EVENTS 1
+#endif
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+std::string const COUNTER_NAMES[PerfCounters::NUM_COUNTERS] = {
+  "cycles",
+  "instructions",
+  "llc_misses",
+  "dtlb_misses",
+  "branch_misses"
+};
+
+
+#ifdef POROS_HAS_PERF_EVENTS
+/**
+* @brief Open a counter of user space events on the calling thread.
+*
+* @param type The type of event.
+* @param config The event.
+* @param leader The file descriptor of the group to join (or -1 to start a
+* new group).
+*
+* @return The file descriptor of the counter, or -1 if it could not be
+* opened.
+*/
+int openCounter(
+    uint32_t const type,
+    uint64_t const config,
+    int const leader)
+{
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, \
+      leader, 0));
+}
+#endif
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+PerfCounters::PerfCounters() :
+  m_leader(-1),
+  m_numOpen(0),
+  m_fds(),
+  m_position()
+{
+  m_fds.fill(-1);
+  m_position.fill(-1);
+
+  #ifdef POROS_HAS_PERF_EVENTS
+  uint64_t const dtlbReadMiss = PERF_COUNT_HW_CACHE_DTLB | \
+      (PERF_COUNT_HW_CACHE_OP_READ << 8) | \
+      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  std::pair<uint32_t, uint64_t> const events[NUM_COUNTERS] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HW_CACHE, dtlbReadMiss},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+  };
+
+  // put every counter in one group, so that they are all read with a single
+  // system call
+  for (uint32_t i = 0; i < NUM_COUNTERS; ++i) {
+    int const fd = openCounter(events[i].first, events[i].second, m_leader);
+    if (fd >= 0) {
+      if (m_leader < 0) {
+        m_leader = fd;
+      }
+      m_fds[i] = fd;
+      m_position[i] = m_numOpen;
+      ++m_numOpen;
+    }
+  }
+  #endif
+}
+
+
+PerfCounters::~PerfCounters()
+{
+  #ifdef POROS_HAS_PERF_EVENTS
+  for (int const fd : m_fds) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  #endif
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+PerfCounters::sample_type PerfCounters::read() const noexcept
+{
+  sample_type sample;
+  sample.fill(0);
+
+  #ifdef POROS_HAS_PERF_EVENTS
+  if (m_leader >= 0) {
+    // the group is read as the number of counters followed by their values
+    uint64_t buffer[NUM_COUNTERS+1];
+    ssize_t const size = ::read(m_leader, buffer, sizeof(buffer));
+    if (size >= static_cast<ssize_t>((m_numOpen+1)*sizeof(uint64_t))) {
+      for (uint32_t i = 0; i < NUM_COUNTERS; ++i) {
+        if (m_position[i] >= 0) {
+          sample[i] = buffer[m_position[i]+1];
+        }
+      }
+    }
+  }
+  #endif
+
+  return sample;
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+std::string const & PerfCounters::name(
+    uint32_t const counter)
+{
+  if (counter >= NUM_COUNTERS) {
+    throw std::runtime_error("Got counter " + std::to_string(counter) + "/" + \
+        std::to_string(NUM_COUNTERS));
+  }
+
+  return COUNTER_NAMES[counter];
+}
+
+
+PerfCounters const & PerfCounters::local()
+{
+  thread_local PerfCounters counters;
+  return counters;
+}
+
+
+}
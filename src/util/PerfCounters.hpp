@@ -0,0 +1,140 @@
+/**
+* @file PerfCounters.hpp
+* @brief The PerfCounters class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-25
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_PERFCOUNTERS_HPP
+#define POROS_SRC_UTIL_PERFCOUNTERS_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace poros
+{
+
+/**
+* @brief A set of hardware event counters for the calling thread, read
+* through `perf_event_open()` on Linux. Counters the kernel or processor does
+* not provide (or any, on other platforms) are unavailable and always read
+* as zero.
+*/
+class PerfCounters
+{
+  public:
+    enum {
+      CYCLES,
+      INSTRUCTIONS,
+      LLC_MISSES,
+      DTLB_MISSES,
+      BRANCH_MISSES,
+      NUM_COUNTERS
+    };
+
+    /**
+    * @brief The value of each counter at a point in time.
+    */
+    using sample_type = std::array<uint64_t, NUM_COUNTERS>;
+
+    /**
+    * @brief Open the counters for the calling thread. They only count events
+    * on this thread.
+    */
+    PerfCounters();
+
+    /**
+    * @brief Destructor.
+    */
+    ~PerfCounters();
+
+    /**
+    * @brief Deleted copy constructor.
+    *
+    * @param rhs The counters to copy.
+    */
+    PerfCounters(
+        PerfCounters const & rhs) = delete;
+
+    /**
+    * @brief Deleted copy-assignment operator.
+    *
+    * @param rhs The counters to copy.
+    *
+    * @return These counters.
+    */
+    PerfCounters & operator=(
+        PerfCounters const & rhs) = delete;
+
+    /**
+    * @brief Check whether a counter could be opened.
+    *
+    * @param counter The counter.
+    *
+    * @return True if it counts events.
+    */
+    bool isAvailable(
+        uint32_t counter) const noexcept
+    {
+      return m_position[counter] >= 0;
+    }
+
+    /**
+    * @brief Read the current value of every counter.
+    *
+    * @return The values.
+    */
+    sample_type read() const noexcept;
+
+    /**
+    * @brief Get the name of a counter.
+    *
+    * @param counter The counter.
+    *
+    * @return The name.
+    *
+    * @throws An exception if the counter is not valid.
+    */
+    static std::string const & name(
+        uint32_t counter);
+
+    /**
+    * @brief Get the counters of the calling thread, opening them the first
+    * time this is called on it.
+    *
+    * @return The counters.
+    */
+    static PerfCounters const & local();
+
+  private:
+    int m_leader;
+    int m_numOpen;
+    std::array<int, NUM_COUNTERS> m_fds;
+    std::array<int, NUM_COUNTERS> m_position;
+};
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+/**
+* @file ProgressMonitor.cpp
+* @brief Implementation of the ProgressMonitor class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ProgressMonitor.hpp"
+
+#include <stdexcept>
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+ProgressMonitor::ProgressMonitor(
+    poros_progress_callback const callback,
+    void * const data) noexcept :
+  m_callback(callback),
+  m_data(data),
+  m_progress{0, 0, 0, 0, 0, 0}
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void ProgressMonitor::clear() noexcept
+{
+  m_progress = poros_progress_struct{0, 0, 0, 0, 0, 0};
+}
+
+
+void ProgressMonitor::startTrial(
+    int const trial) noexcept
+{
+  m_progress.trial = trial;
+  m_progress.depth = 0;
+}
+
+
+void ProgressMonitor::setDepth(
+    int const depth) noexcept
+{
+  m_progress.depth = depth;
+}
+
+
+void ProgressMonitor::report(
+    int const phase,
+    int const level)
+{
+  if (m_callback == nullptr) {
+    return;
+  }
+
+  m_progress.phase = phase;
+  m_progress.level = level;
+  if (m_callback(&m_progress, m_data) != 0) {
+    throw std::runtime_error("Partitioning was cancelled.");
+  }
+}
+
+
+void ProgressMonitor::reportTrial(
+    wgt_type const bestCut)
+{
+  m_progress.hasBestCut = 1;
+  m_progress.bestCut = bestCut;
+  m_progress.depth = 0;
+  report(PARTITIONING_PHASE, 0);
+}
+
+
+}
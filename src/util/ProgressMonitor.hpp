@@ -0,0 +1,119 @@
+/**
+* @file ProgressMonitor.hpp
+* @brief The ProgressMonitor class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_PROGRESSMONITOR_HPP
+#define POROS_SRC_UTIL_PROGRESSMONITOR_HPP
+
+
+#include "Base.hpp"
+
+
+namespace poros
+{
+
+/**
+* @brief Reports the progress of a partitioning to a callback, and cancels the
+* partitioning if the callback asks it to. Cancelling throws an exception, so
+* that everything allocated so far is released as it unwinds.
+*/
+class ProgressMonitor
+{
+  public:
+    /**
+    * @brief Create a new progress monitor.
+    *
+    * @param callback The function to report progress to (may be null, in
+    * which case nothing is reported).
+    * @param data The data to pass to the callback.
+    */
+    ProgressMonitor(
+        poros_progress_callback callback,
+        void * data) noexcept;
+
+    /**
+    * @brief Check whether progress is reported.
+    *
+    * @return True if there is a callback.
+    */
+    bool isEnabled() const noexcept
+    {
+      return m_callback != nullptr;
+    }
+
+    /**
+    * @brief Forget the best cut, ahead of a new partitioning.
+    */
+    void clear() noexcept;
+
+    /**
+    * @brief Start a new partitioning of the whole graph.
+    *
+    * @param trial The index of the partitioning.
+    */
+    void startTrial(
+        int trial) noexcept;
+
+    /**
+    * @brief Set the depth in the recursion of the bisection being made.
+    *
+    * @param depth The depth.
+    */
+    void setDepth(
+        int depth) noexcept;
+
+    /**
+    * @brief Report that a point of a bisection has been reached.
+    *
+    * @param phase The point (a member of `progress_phase_type`).
+    * @param level The level of coarsening.
+    *
+    * @throws std::runtime_error If the callback cancels the partitioning.
+    */
+    void report(
+        int phase,
+        int level);
+
+    /**
+    * @brief Report that a partitioning of the whole graph has been made.
+    *
+    * @param bestCut The cut of the best partitioning made so far.
+    *
+    * @throws std::runtime_error If the callback cancels the partitioning.
+    */
+    void reportTrial(
+        wgt_type bestCut);
+
+  private:
+    poros_progress_callback m_callback;
+    void * m_data;
+    poros_progress_struct m_progress;
+};
+
+}
+
+#endif
@@ -29,12 +29,49 @@
 #include "TimeKeeper.hpp"
 #include "solidutils/Debug.hpp"
 
+#include <algorithm>
+#include <ostream>
 #include <stdexcept>
 
 namespace poros
 {
 
 
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+constexpr size_t const TimeKeeper::ROOT_NODE;
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+thread_local TimeKeeper * s_currentKeeper = nullptr;
+thread_local size_t s_currentNode = TimeKeeper::ROOT_NODE;
+
+
+void writeNode(
+    std::vector<TimeKeeper::node_struct> const & nodes,
+    std::vector<std::vector<size_t>> const & children,
+    size_t const node,
+    size_t const depth,
+    std::ostream * const stream)
+{
+  *stream << std::string(2*depth, ' ') << nodes[node].name << ": " << \
+      nodes[node].seconds << " (" << nodes[node].calls << ")" << std::endl;
+  for (size_t const child : children[node]) {
+    writeNode(nodes, children, child, depth+1, stream);
+  }
+}
+
+}
+
+
 
 /******************************************************************************
 * CONSTRUCTORS / DESTRUCTOR ***************************************************
@@ -51,7 +88,16 @@ TimeKeeper::TimeKeeper() :
     "Uncoarsening",
     "Refinement",
     "Projection"
-  }
+  },
+  m_countersEnabled(false),
+  m_counts(NUM_TIME_CATEGORIES, PerfCounters::sample_type{}),
+  m_allocationLock(),
+  m_allocations(NUM_TIME_CATEGORIES, AllocationCounter::sample_struct{0, 0}),
+  m_trace(),
+  m_treeEnabled(false),
+  m_treeLock(),
+  m_nodes{node_struct{"Total", ROOT_NODE, 0.0, 0}},
+  m_children()
 {
   ASSERT_EQUAL(m_times.size(), m_names.size());
 }
@@ -86,6 +132,201 @@ std::vector<std::pair<std::string, double>> TimeKeeper::times() const
 }
 
 
+void TimeKeeper::clear()
+{
+  std::fill(m_times.begin(), m_times.end(), 0.0);
+  std::fill(m_counts.begin(), m_counts.end(), PerfCounters::sample_type{});
+  {
+    std::lock_guard<std::mutex> lock(m_allocationLock);
+    std::fill(m_allocations.begin(), m_allocations.end(), \
+        AllocationCounter::sample_struct{0, 0});
+  }
+  if (m_trace) {
+    m_trace.reset(new TraceSink);
+  }
+
+  std::lock_guard<std::mutex> lock(m_treeLock);
+  m_nodes.resize(1);
+  m_nodes[ROOT_NODE].seconds = 0.0;
+  m_nodes[ROOT_NODE].calls = 0;
+  m_children.clear();
+}
+
+
+void TimeKeeper::enableCounters(
+    bool const enable) noexcept
+{
+  m_countersEnabled = enable;
+}
+
+
+void TimeKeeper::reportCounts(
+    uint32_t const key,
+    PerfCounters::sample_type const & counts)
+{
+  if (key >= m_counts.size()) {
+    throw std::runtime_error("Got key " + std::to_string(key) + "/" +
+        std::to_string(m_counts.size()));
+  }
+
+  for (size_t i = 0; i < counts.size(); ++i) {
+    m_counts[key][i] += counts[i];
+  }
+}
+
+
+std::vector<std::pair<std::string, PerfCounters::sample_type>> \
+    TimeKeeper::counts() const
+{
+  std::vector<std::pair<std::string, PerfCounters::sample_type>> data;
+  data.reserve(m_counts.size());
+
+  for (size_t i = 0; i < m_counts.size(); ++i) {
+    data.emplace_back(m_names[i], m_counts[i]);
+  }
+
+  return data;
+}
+
+
+void TimeKeeper::reportAllocations(
+    uint32_t const key,
+    AllocationCounter::sample_struct const & allocations)
+{
+  if (key >= m_allocations.size()) {
+    throw std::runtime_error("Got key " + std::to_string(key) + "/" +
+        std::to_string(m_allocations.size()));
+  }
+
+  // phases on different threads may finish at the same time
+  std::lock_guard<std::mutex> lock(m_allocationLock);
+  m_allocations[key].count += allocations.count;
+  m_allocations[key].bytes += allocations.bytes;
+}
+
+
+std::vector<std::pair<std::string, AllocationCounter::sample_struct>> \
+    TimeKeeper::allocations() const
+{
+  std::vector<std::pair<std::string, AllocationCounter::sample_struct>> data;
+  data.reserve(m_allocations.size());
+
+  std::lock_guard<std::mutex> lock(m_allocationLock);
+  for (size_t i = 0; i < m_allocations.size(); ++i) {
+    data.emplace_back(m_names[i], m_allocations[i]);
+  }
+
+  return data;
+}
+
+
+std::string const & TimeKeeper::name(
+    uint32_t const key) const
+{
+  if (key >= m_names.size()) {
+    throw std::runtime_error("Got key " + std::to_string(key) + "/" +
+        std::to_string(m_names.size()));
+  }
+
+  return m_names[key];
+}
+
+
+void TimeKeeper::enableTree(
+    bool const enable) noexcept
+{
+  m_treeEnabled = enable;
+}
+
+
+void TimeKeeper::enableTrace(
+    bool const enable)
+{
+  if (!enable) {
+    m_trace.reset();
+  } else if (!m_trace) {
+    m_trace.reset(new TraceSink);
+  }
+}
+
+
+size_t TimeKeeper::enterNode(
+    size_t const parent,
+    std::string const & name)
+{
+  std::lock_guard<std::mutex> lock(m_treeLock);
+
+  ASSERT_LESS(parent, m_nodes.size());
+
+  auto const result = m_children.emplace(std::make_pair(parent, name), \
+      m_nodes.size());
+  if (result.second) {
+    m_nodes.emplace_back(node_struct{name, parent, 0.0, 0});
+  }
+
+  return result.first->second;
+}
+
+
+void TimeKeeper::reportNodeTime(
+    size_t const node,
+    double const seconds)
+{
+  std::lock_guard<std::mutex> lock(m_treeLock);
+
+  ASSERT_LESS(node, m_nodes.size());
+
+  m_nodes[node].seconds += seconds;
+  ++m_nodes[node].calls;
+}
+
+
+std::vector<TimeKeeper::node_struct> TimeKeeper::tree() const
+{
+  std::lock_guard<std::mutex> lock(m_treeLock);
+  return m_nodes;
+}
+
+
+void TimeKeeper::writeTree(
+    std::ostream * const stream) const
+{
+  std::vector<node_struct> const nodes = tree();
+
+  std::vector<std::vector<size_t>> children(nodes.size());
+  for (size_t node = ROOT_NODE+1; node < nodes.size(); ++node) {
+    children[nodes[node].parent].emplace_back(node);
+  }
+
+  writeNode(nodes, children, ROOT_NODE, 0, stream);
+}
+
+
+/******************************************************************************
+* PUBLIC STATIC METHODS *******************************************************
+******************************************************************************/
+
+TimeKeeper * TimeKeeper::current() noexcept
+{
+  return s_currentKeeper;
+}
+
+
+void TimeKeeper::setCurrent(
+    TimeKeeper * const keeper,
+    size_t const node) noexcept
+{
+  s_currentKeeper = keeper;
+  s_currentNode = node;
+}
+
+
+size_t TimeKeeper::currentNode() noexcept
+{
+  return s_currentNode;
+}
+
+
 
 
 }
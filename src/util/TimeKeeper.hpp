@@ -29,7 +29,16 @@
 #ifndef POROS_SRC_UTIL_TIMEKEEPER_HPP
 #define POROS_SRC_UTIL_TIMEKEEPER_HPP
 
+#include "AllocationCounter.hpp"
+#include "PerfCounters.hpp"
+#include "TraceSink.hpp"
+
 #include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <iosfwd>
+#include <mutex>
 #include <vector>
 #include <utility>
 #include <string>
@@ -37,9 +46,45 @@
 namespace poros
 {
 
+/**
+* @brief Keeps track of the time spent in each category of partitioning, and
+* optionally a tree of the time spent in each recursion node, level, and
+* phase (see TimeScope). The tree may be added to from multiple threads.
+* Hardware events may also be counted for each category (see TimedProcess),
+* and a timeline of the phases traced (see TraceSink).
+*/
 class TimeKeeper
 {
   public:
+    /**
+    * @brief The index of the root node of the timing tree.
+    */
+    static constexpr size_t const ROOT_NODE = 0;
+
+    /**
+    * @brief A node of the timing tree.
+    */
+    struct node_struct
+    {
+      std::string name;
+      size_t parent;
+      double seconds;
+      size_t calls;
+
+      node_struct(
+          std::string const & nodeName = std::string(),
+          size_t const parentNode = ROOT_NODE,
+          double const nodeSeconds = 0.0,
+          size_t const nodeCalls = 0) :
+        name(nodeName),
+        parent(parentNode),
+        seconds(nodeSeconds),
+        calls(nodeCalls)
+      {
+        // do nothing
+      }
+    };
+
     enum {
       TOTAL,
       COARSENING,
@@ -94,9 +139,200 @@ class TimeKeeper
      */
     std::vector<std::pair<std::string, double>> times() const;
 
+    /**
+     * @brief Get the name of a category.
+     *
+     * @param key The category.
+     *
+     * @return The name.
+     */
+    std::string const & name(
+        uint32_t key) const;
+
+    /**
+     * @brief Discard the times, counts, tree, and trace recorded so far, so
+     * the keeper can be used again. Whether each is recorded is unchanged.
+     */
+    void clear();
+
+    /**
+     * @brief Set whether the timing tree is recorded. This is off by default,
+     * in which case time scopes cost only a check of this flag.
+     *
+     * @param enable True to record the tree.
+     */
+    void enableTree(
+        bool enable) noexcept;
+
+    /**
+     * @brief Check whether the timing tree is recorded.
+     *
+     * @return True if it is.
+     */
+    bool treeEnabled() const noexcept
+    {
+      return m_treeEnabled;
+    }
+
+    /**
+     * @brief Set whether hardware events are counted for each category. This
+     * is off by default.
+     *
+     * @param enable True to count events.
+     */
+    void enableCounters(
+        bool enable) noexcept;
+
+    /**
+     * @brief Check whether hardware events are counted.
+     *
+     * @return True if they are.
+     */
+    bool countersEnabled() const noexcept
+    {
+      return m_countersEnabled;
+    }
+
+    /**
+     * @brief Add the hardware events counted to a given key.
+     *
+     * @param key The key.
+     * @param counts The number of each event.
+     *
+     * @throws An exception if key has not been added before.
+     */
+    void reportCounts(
+        uint32_t key,
+        PerfCounters::sample_type const & counts);
+
+    /**
+     * @brief Get the hardware events counted for each category. Events which
+     * could not be counted are zero (see PerfCounters::isAvailable()).
+     *
+     * @return The counts.
+     */
+    std::vector<std::pair<std::string, PerfCounters::sample_type>> \
+        counts() const;
+
+    /**
+     * @brief Add the allocations made to a given key.
+     *
+     * @param key The key.
+     * @param allocations The number and bytes of the allocations.
+     *
+     * @throws An exception if key has not been added before.
+     */
+    void reportAllocations(
+        uint32_t key,
+        AllocationCounter::sample_struct const & allocations);
+
+    /**
+     * @brief Get the allocations made in each category. These are all zero
+     * unless built with allocation counting (see
+     * AllocationCounter::isEnabled()).
+     *
+     * @return The allocations.
+     */
+    std::vector<std::pair<std::string, AllocationCounter::sample_struct>> \
+        allocations() const;
+
+    /**
+     * @brief Set whether a timeline of each phase is traced. This is off by
+     * default. Enabling it again keeps the events already traced.
+     *
+     * @param enable True to trace phases.
+     */
+    void enableTrace(
+        bool enable);
+
+    /**
+     * @brief Get the trace of phases.
+     *
+     * @return The trace (null if tracing is not enabled).
+     */
+    TraceSink * trace() const noexcept
+    {
+      return m_trace.get();
+    }
+
+    /**
+     * @brief Get the child of a node of the timing tree with a given name,
+     * adding it if it does not exist.
+     *
+     * @param parent The parent node.
+     * @param name The name of the child.
+     *
+     * @return The child node.
+     */
+    size_t enterNode(
+        size_t parent,
+        std::string const & name);
+
+    /**
+     * @brief Add a call to a node of the timing tree.
+     *
+     * @param node The node.
+     * @param seconds The time the call took.
+     */
+    void reportNodeTime(
+        size_t node,
+        double seconds);
+
+    /**
+     * @brief Get the timing tree. Each node comes after its parent, and the
+     * first node is the root.
+     *
+     * @return The nodes of the tree.
+     */
+    std::vector<node_struct> tree() const;
+
+    /**
+     * @brief Write the timing tree, with the children of each node indented
+     * below it.
+     *
+     * @param stream The stream to write to.
+     */
+    void writeTree(
+        std::ostream * stream) const;
+
+    /**
+     * @brief Get the time keeper that time scopes on this thread report to.
+     *
+     * @return The time keeper (may be null).
+     */
+    static TimeKeeper * current() noexcept;
+
+    /**
+     * @brief Set the time keeper that time scopes on this thread report to,
+     * and the node of its tree which new scopes are children of.
+     *
+     * @param keeper The time keeper (may be null).
+     * @param node The current node.
+     */
+    static void setCurrent(
+        TimeKeeper * keeper,
+        size_t node) noexcept;
+
+    /**
+     * @brief Get the node of the current time keeper's tree which new scopes
+     * on this thread are children of.
+     *
+     * @return The node.
+     */
+    static size_t currentNode() noexcept;
+
   private:
     std::vector<double> m_times;
     std::vector<std::string> m_names;
+    bool m_countersEnabled;
+    std::vector<PerfCounters::sample_type> m_counts;
+    mutable std::mutex m_allocationLock;
+    std::vector<AllocationCounter::sample_struct> m_allocations;
+    std::unique_ptr<TraceSink> m_trace;
+    bool m_treeEnabled;
+    mutable std::mutex m_treeLock;
+    std::vector<node_struct> m_nodes;
+    std::map<std::pair<size_t, std::string>, size_t> m_children;
 };
 
 }
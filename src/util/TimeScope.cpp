@@ -0,0 +1,319 @@
+/**
+* @file TimeScope.cpp
+* @brief Implementation of the TimeScope class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "TimeScope.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+thread_local long s_level = TraceSink::NO_TAG;
+thread_local long s_firstPartition = TraceSink::NO_TAG;
+thread_local long s_lastPartition = TraceSink::NO_TAG;
+
+// the categories whose allocations are counted by a scope on this thread
+thread_local uint32_t s_countedCategories = 0;
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+TimeScope::TimeScope(
+    std::shared_ptr<TimeKeeper> keeper) :
+  TimeScope(keeper.get(), TimeKeeper::ROOT_NODE)
+{
+  m_owner = std::move(keeper);
+  if (m_keeper != nullptr) {
+    m_recording = m_keeper->treeEnabled();
+    if (m_keeper->trace() != nullptr) {
+      m_tracing = true;
+      m_name = m_keeper->name(TimeKeeper::TOTAL);
+      m_start = m_keeper->trace()->now();
+      tag(TraceSink::NO_TAG, TraceSink::NO_TAG, TraceSink::NO_TAG);
+    }
+    m_timer.start();
+  }
+}
+
+
+TimeScope::TimeScope(
+    TimeKeeper * const keeper,
+    size_t const node) :
+  m_owner(),
+  m_keeper(keeper),
+  m_previousKeeper(TimeKeeper::current()),
+  m_previousNode(TimeKeeper::currentNode()),
+  m_node(node),
+  m_restore(true),
+  m_recording(false),
+  m_tracing(false),
+  m_tagged(false),
+  m_previousLevel(TraceSink::NO_TAG),
+  m_previousFirst(TraceSink::NO_TAG),
+  m_previousLast(TraceSink::NO_TAG),
+  m_name(),
+  m_start(0.0),
+  m_timer(),
+  m_allocationKeeper(nullptr),
+  m_category(0),
+  m_allocationStart{0, 0}
+{
+  TimeKeeper::setCurrent(keeper, node);
+  if (keeper != nullptr) {
+    countAllocations(keeper, TimeKeeper::TOTAL);
+  }
+}
+
+
+TimeScope::TimeScope(
+    uint32_t const category) :
+  m_owner(),
+  m_keeper(nullptr),
+  m_previousKeeper(nullptr),
+  m_previousNode(TimeKeeper::ROOT_NODE),
+  m_node(TimeKeeper::ROOT_NODE),
+  m_restore(false),
+  m_recording(false),
+  m_tracing(false),
+  m_tagged(false),
+  m_previousLevel(TraceSink::NO_TAG),
+  m_previousFirst(TraceSink::NO_TAG),
+  m_previousLast(TraceSink::NO_TAG),
+  m_name(),
+  m_start(0.0),
+  m_timer(),
+  m_allocationKeeper(nullptr),
+  m_category(0),
+  m_allocationStart{0, 0}
+{
+  if (isRecording()) {
+    enter(TimeKeeper::current()->name(category));
+  }
+  if (TimeKeeper::current() != nullptr) {
+    countAllocations(TimeKeeper::current(), category);
+  }
+}
+
+
+TimeScope::TimeScope(
+    char const * const name) :
+  m_owner(),
+  m_keeper(nullptr),
+  m_previousKeeper(nullptr),
+  m_previousNode(TimeKeeper::ROOT_NODE),
+  m_node(TimeKeeper::ROOT_NODE),
+  m_restore(false),
+  m_recording(false),
+  m_tracing(false),
+  m_tagged(false),
+  m_previousLevel(TraceSink::NO_TAG),
+  m_previousFirst(TraceSink::NO_TAG),
+  m_previousLast(TraceSink::NO_TAG),
+  m_name(),
+  m_start(0.0),
+  m_timer(),
+  m_allocationKeeper(nullptr),
+  m_category(0),
+  m_allocationStart{0, 0}
+{
+  if (isRecording()) {
+    enter(name);
+  }
+}
+
+
+TimeScope::TimeScope(
+    char const * const name,
+    size_t const index) :
+  m_owner(),
+  m_keeper(nullptr),
+  m_previousKeeper(nullptr),
+  m_previousNode(TimeKeeper::ROOT_NODE),
+  m_node(TimeKeeper::ROOT_NODE),
+  m_restore(false),
+  m_recording(false),
+  m_tracing(false),
+  m_tagged(false),
+  m_previousLevel(TraceSink::NO_TAG),
+  m_previousFirst(TraceSink::NO_TAG),
+  m_previousLast(TraceSink::NO_TAG),
+  m_name(),
+  m_start(0.0),
+  m_timer(),
+  m_allocationKeeper(nullptr),
+  m_category(0),
+  m_allocationStart{0, 0}
+{
+  if (isRecording()) {
+    enter(std::string(name) + " " + std::to_string(index));
+    tag(static_cast<long>(index), s_firstPartition, s_lastPartition);
+  }
+}
+
+
+TimeScope::TimeScope(
+    char const * const name,
+    size_t const first,
+    size_t const last) :
+  m_owner(),
+  m_keeper(nullptr),
+  m_previousKeeper(nullptr),
+  m_previousNode(TimeKeeper::ROOT_NODE),
+  m_node(TimeKeeper::ROOT_NODE),
+  m_restore(false),
+  m_recording(false),
+  m_tracing(false),
+  m_tagged(false),
+  m_previousLevel(TraceSink::NO_TAG),
+  m_previousFirst(TraceSink::NO_TAG),
+  m_previousLast(TraceSink::NO_TAG),
+  m_name(),
+  m_start(0.0),
+  m_timer(),
+  m_allocationKeeper(nullptr),
+  m_category(0),
+  m_allocationStart{0, 0}
+{
+  if (isRecording()) {
+    enter(std::string(name) + " " + std::to_string(first) + "-" + \
+        std::to_string(last));
+    tag(TraceSink::NO_TAG, static_cast<long>(first), \
+        static_cast<long>(last));
+  }
+}
+
+
+TimeScope::~TimeScope()
+{
+  if (m_recording || m_tracing) {
+    m_timer.stop();
+  }
+  if (m_recording) {
+    m_keeper->reportNodeTime(m_node, m_timer.poll());
+  }
+  if (m_tracing) {
+    m_keeper->trace()->record(m_name, m_start, m_timer.poll(), s_level, \
+        s_firstPartition, s_lastPartition);
+  }
+  if (m_allocationKeeper != nullptr) {
+    AllocationCounter::sample_struct const end = AllocationCounter::read();
+    m_allocationKeeper->reportAllocations(m_category, \
+        AllocationCounter::sample_struct{end.count - m_allocationStart.count, \
+        end.bytes - m_allocationStart.bytes});
+    s_countedCategories &= ~(1u << m_category);
+  }
+  if (m_tagged) {
+    s_level = m_previousLevel;
+    s_firstPartition = m_previousFirst;
+    s_lastPartition = m_previousLast;
+  }
+  if (m_restore) {
+    TimeKeeper::setCurrent(m_previousKeeper, m_previousNode);
+  }
+}
+
+
+/******************************************************************************
+* PRIVATE METHODS *************************************************************
+******************************************************************************/
+
+void TimeScope::enter(
+    std::string const & name)
+{
+  m_keeper = TimeKeeper::current();
+  m_previousKeeper = m_keeper;
+  m_previousNode = TimeKeeper::currentNode();
+  m_node = m_previousNode;
+  m_restore = true;
+
+  if (m_keeper->treeEnabled()) {
+    m_node = m_keeper->enterNode(m_previousNode, name);
+    m_recording = true;
+    TimeKeeper::setCurrent(m_keeper, m_node);
+  }
+
+  TraceSink * const trace = m_keeper->trace();
+  if (trace != nullptr) {
+    m_tracing = true;
+    m_name = name;
+    m_start = trace->now();
+  }
+
+  m_timer.start();
+}
+
+
+void TimeScope::countAllocations(
+    TimeKeeper * const keeper,
+    uint32_t const category) noexcept
+{
+  if (!AllocationCounter::isEnabled() || \
+      category >= TimeKeeper::NUM_TIME_CATEGORIES) {
+    return;
+  }
+
+  uint32_t const bit = 1u << category;
+  if ((s_countedCategories & bit) != 0) {
+    return;
+  }
+
+  s_countedCategories |= bit;
+  m_allocationKeeper = keeper;
+  m_category = category;
+  m_allocationStart = AllocationCounter::read();
+}
+
+
+void TimeScope::tag(
+    long const level,
+    long const first,
+    long const last) noexcept
+{
+  m_previousLevel = s_level;
+  m_previousFirst = s_firstPartition;
+  m_previousLast = s_lastPartition;
+  m_tagged = true;
+
+  s_level = level;
+  s_firstPartition = first;
+  s_lastPartition = last;
+}
+
+
+}
@@ -0,0 +1,199 @@
+/**
+* @file TimeScope.hpp
+* @brief The TimeScope class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_TIMESCOPE_HPP
+#define POROS_SRC_UTIL_TIMESCOPE_HPP
+
+#include "TimeKeeper.hpp"
+#include "AllocationCounter.hpp"
+
+#include "solidutils/Timer.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace poros
+{
+
+/**
+* @brief Times a node of the timing tree for the lifetime of the scope. The
+* node is a child of the node of the enclosing scope on the same thread, so
+* nested scopes build the path through the recursion, levels, and phases.
+* If the current time keeper is tracing, the scope is also added to the
+* trace as an event, tagged with the level and recursion node it is in.
+* Nothing is recorded unless the current time keeper has its tree or trace
+* enabled. When built with allocation counting, the allocations made on this
+* thread within a scope of a category (or of a keeper, for the total) are
+* added to that category of the keeper.
+*/
+class TimeScope
+{
+  public:
+    /**
+    * @brief Make a time keeper current on this thread, and time the root of
+    * its tree. The previous keeper is restored when the scope ends.
+    *
+    * @param keeper The time keeper (may be null).
+    */
+    TimeScope(
+        std::shared_ptr<TimeKeeper> keeper);
+
+    /**
+    * @brief Continue a path of the timing tree on this thread (e.g., from a
+    * task started by another thread).
+    *
+    * @param keeper The time keeper (may be null).
+    * @param node The node new scopes are children of.
+    */
+    TimeScope(
+        TimeKeeper * keeper,
+        size_t node);
+
+    /**
+    * @brief Time a node named after a category of the current keeper.
+    *
+    * @param category The category.
+    */
+    TimeScope(
+        uint32_t category);
+
+    /**
+    * @brief Time a node with a name.
+    *
+    * @param name The name of the node.
+    */
+    TimeScope(
+        char const * name);
+
+    /**
+    * @brief Time a level of coarsening (e.g., "Level 2"). Traced events
+    * within the scope are tagged with the level.
+    *
+    * @param name The name of the node.
+    * @param index The level.
+    */
+    TimeScope(
+        char const * name,
+        size_t index);
+
+    /**
+    * @brief Time a node of the recursion, making a range of partitions
+    * (e.g., "Partitions 0-7"). Traced events within the scope are tagged
+    * with the range, and no longer with a level.
+    *
+    * @param name The name of the node.
+    * @param first The first partition.
+    * @param last The last partition (inclusive).
+    */
+    TimeScope(
+        char const * name,
+        size_t first,
+        size_t last);
+
+    /**
+    * @brief Destructor, which records the time and restores the previous
+    * node.
+    */
+    ~TimeScope();
+
+  private:
+    std::shared_ptr<TimeKeeper> m_owner;
+    TimeKeeper * m_keeper;
+    TimeKeeper * m_previousKeeper;
+    size_t m_previousNode;
+    size_t m_node;
+    bool m_restore;
+    bool m_recording;
+    bool m_tracing;
+    bool m_tagged;
+    long m_previousLevel;
+    long m_previousFirst;
+    long m_previousLast;
+    std::string m_name;
+    double m_start;
+    sl::Timer m_timer;
+    TimeKeeper * m_allocationKeeper;
+    uint32_t m_category;
+    AllocationCounter::sample_struct m_allocationStart;
+
+    /**
+    * @brief Check whether scopes on this thread are being recorded.
+    *
+    * @return True if they are.
+    */
+    static bool isRecording() noexcept
+    {
+      TimeKeeper const * const keeper = TimeKeeper::current();
+      return keeper != nullptr && \
+          (keeper->treeEnabled() || keeper->trace() != nullptr);
+    }
+
+    /**
+    * @brief Start timing a child of the current node.
+    *
+    * @param name The name of the child.
+    */
+    void enter(
+        std::string const & name);
+
+    /**
+    * @brief Count the allocations made on this thread until the scope ends
+    * in a category, unless an enclosing scope on this thread already counts
+    * them in it.
+    *
+    * @param keeper The time keeper to add them to.
+    * @param category The category.
+    */
+    void countAllocations(
+        TimeKeeper * keeper,
+        uint32_t category) noexcept;
+
+    /**
+    * @brief Set the tags of events traced on this thread until the scope
+    * ends.
+    *
+    * @param level The level (or TraceSink::NO_TAG).
+    * @param first The first partition (or TraceSink::NO_TAG).
+    * @param last The last partition (or TraceSink::NO_TAG).
+    */
+    void tag(
+        long level,
+        long first,
+        long last) noexcept;
+
+    // disable copying
+    TimeScope(
+        TimeScope const & rhs) = delete;
+    TimeScope & operator=(
+        TimeScope const & rhs) = delete;
+};
+
+}
+
+#endif
@@ -69,5 +69,29 @@ void TimedProcess::reportTime(
 }
 
 
+PerfCounters::sample_type TimedProcess::startCounting() const
+{
+  if (m_timeKeeper.get() != nullptr && m_timeKeeper->countersEnabled()) {
+    return PerfCounters::local().read();
+  } else {
+    return PerfCounters::sample_type{};
+  }
+}
+
+
+void TimedProcess::reportCounts(
+    int const category,
+    PerfCounters::sample_type const & start)
+{
+  if (m_timeKeeper.get() != nullptr && m_timeKeeper->countersEnabled()) {
+    PerfCounters::sample_type counts = PerfCounters::local().read();
+    for (size_t i = 0; i < counts.size(); ++i) {
+      counts[i] -= start[i];
+    }
+    m_timeKeeper->reportCounts(category, counts);
+  }
+}
+
+
 }
 
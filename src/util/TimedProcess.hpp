@@ -31,6 +31,7 @@
 #define POROS_SRC_TIMEDPROCESS_HPP
 
 #include "TimeKeeper.hpp"
+#include "PerfCounters.hpp"
 
 #include <memory>
 
@@ -69,6 +70,25 @@ class TimedProcess
       int category,
       double time);
 
+  /**
+  * @brief Start counting hardware events for this process, if the time keeper
+  * counts them.
+  *
+  * @return The counts at the start (zero if events are not counted).
+  */
+  PerfCounters::sample_type startCounting() const;
+
+  /**
+  * @brief Report the hardware events counted for this process since
+  * `startCounting()` was called on this thread.
+  *
+  * @param category The category of time.
+  * @param start The counts returned by `startCounting()`.
+  */
+  void reportCounts(
+      int category,
+      PerfCounters::sample_type const & start);
+
   private:
   std::shared_ptr<TimeKeeper> m_timeKeeper;
 };
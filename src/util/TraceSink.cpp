@@ -0,0 +1,160 @@
+/**
+* @file TraceSink.cpp
+* @brief Implementation of the TraceSink class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "TraceSink.hpp"
+
+#include <iomanip>
+#include <ostream>
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTANTS *******************************************************************
+******************************************************************************/
+
+constexpr long const TraceSink::NO_TAG;
+
+
+/******************************************************************************
+* HELPER FUNCTIONS ************************************************************
+******************************************************************************/
+
+namespace
+{
+
+/**
+* @brief Write a string as a JSON string.
+*
+* @param str The string.
+* @param stream The stream to write to.
+*/
+void writeString(
+    std::string const & str,
+    std::ostream * const stream)
+{
+  *stream << '"';
+  for (char const c : str) {
+    if (c == '"' || c == '\\') {
+      *stream << '\\' << c;
+    } else if (static_cast<unsigned char>(c) >= 0x20) {
+      *stream << c;
+    }
+  }
+  *stream << '"';
+}
+
+}
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+TraceSink::TraceSink() :
+  m_origin(std::chrono::steady_clock::now()),
+  m_lock(),
+  m_events(),
+  m_threads()
+{
+  // do nothing
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+double TraceSink::now() const noexcept
+{
+  return std::chrono::duration<double>( \
+      std::chrono::steady_clock::now() - m_origin).count();
+}
+
+
+void TraceSink::record(
+    std::string const & name,
+    double const start,
+    double const duration,
+    long const level,
+    long const firstPartition,
+    long const lastPartition)
+{
+  std::lock_guard<std::mutex> lock(m_lock);
+
+  size_t const thread = m_threads.emplace(std::this_thread::get_id(), \
+      m_threads.size()).first->second;
+
+  m_events.emplace_back(event_struct{name, start, duration, thread, level, \
+      firstPartition, lastPartition});
+}
+
+
+std::vector<TraceSink::event_struct> TraceSink::events() const
+{
+  std::lock_guard<std::mutex> lock(m_lock);
+  return m_events;
+}
+
+
+void TraceSink::write(
+    std::ostream * const stream) const
+{
+  std::vector<event_struct> const data = events();
+
+  // complete ("X") events, with times in microseconds
+  std::ios::fmtflags const flags = stream->flags();
+  std::streamsize const precision = stream->precision();
+  *stream << std::fixed << std::setprecision(3);
+  *stream << "{\"traceEvents\": [";
+  for (size_t i = 0; i < data.size(); ++i) {
+    event_struct const & event = data[i];
+    *stream << (i == 0 ? "" : ",") << std::endl << "  {\"name\": ";
+    writeString(event.name, stream);
+    *stream << ", \"cat\": \"poros\", \"ph\": \"X\", \"ts\": " << \
+        event.start*1e6 << ", \"dur\": " << event.duration*1e6 << \
+        ", \"pid\": 0, \"tid\": " << event.thread << ", \"args\": {";
+    bool first = true;
+    if (event.level != NO_TAG) {
+      *stream << "\"level\": " << event.level;
+      first = false;
+    }
+    if (event.firstPartition != NO_TAG) {
+      *stream << (first ? "" : ", ") << "\"partitions\": \"" << \
+          event.firstPartition << "-" << event.lastPartition << "\"";
+    }
+    *stream << "}}";
+  }
+  *stream << std::endl << "], \"displayTimeUnit\": \"ms\"}" << std::endl;
+  stream->flags(flags);
+  stream->precision(precision);
+}
+
+
+}
@@ -0,0 +1,147 @@
+/**
+* @file TraceSink.hpp
+* @brief The TraceSink class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_TRACESINK_HPP
+#define POROS_SRC_UTIL_TRACESINK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace poros
+{
+
+/**
+* @brief Records a timeline of the phases of partitioning (see TimeScope), to
+* be written in the Chrome trace event format and viewed with
+* `chrome://tracing` or Perfetto. Events may be recorded from multiple
+* threads.
+*/
+class TraceSink
+{
+  public:
+    /**
+    * @brief The tag of an event not inside a level or recursion node.
+    */
+    static constexpr long const NO_TAG = -1;
+
+    /**
+    * @brief A phase which took place on one thread.
+    */
+    struct event_struct
+    {
+      std::string name;
+      double start;
+      double duration;
+      size_t thread;
+      long level;
+      long firstPartition;
+      long lastPartition;
+    };
+
+    /**
+    * @brief Create an empty trace, starting now.
+    */
+    TraceSink();
+
+    /**
+    * @brief Deleted copy constructor.
+    *
+    * @param rhs The TraceSink to copy.
+    */
+    TraceSink(
+        TraceSink const & rhs) = delete;
+
+    /**
+    * @brief Deleted copy-assignment operator.
+    *
+    * @param rhs The TraceSink to copy.
+    *
+    * @return This TraceSink.
+    */
+    TraceSink & operator=(
+        TraceSink const & rhs) = delete;
+
+    /**
+    * @brief Get the time since the trace started.
+    *
+    * @return The time in seconds.
+    */
+    double now() const noexcept;
+
+    /**
+    * @brief Add an event which took place on the calling thread.
+    *
+    * @param name The name of the phase.
+    * @param start The time the phase started (see `now()`).
+    * @param duration The time the phase took in seconds.
+    * @param level The level of coarsening it took place at (or NO_TAG).
+    * @param firstPartition The first partition of the recursion node it took
+    * place in (or NO_TAG).
+    * @param lastPartition The last partition of the recursion node it took
+    * place in (or NO_TAG).
+    */
+    void record(
+        std::string const & name,
+        double start,
+        double duration,
+        long level,
+        long firstPartition,
+        long lastPartition);
+
+    /**
+    * @brief Get the events recorded so far, in the order they ended. Threads
+    * are numbered from 0 in the order they first recorded an event.
+    *
+    * @return The events.
+    */
+    std::vector<event_struct> events() const;
+
+    /**
+    * @brief Write the events as a Chrome trace (JSON).
+    *
+    * @param stream The stream to write to.
+    */
+    void write(
+        std::ostream * stream) const;
+
+  private:
+    std::chrono::steady_clock::time_point m_origin;
+    mutable std::mutex m_lock;
+    std::vector<event_struct> m_events;
+    std::map<std::thread::id, size_t> m_threads;
+};
+
+}
+
+#endif
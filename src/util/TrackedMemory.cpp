@@ -0,0 +1,137 @@
+/**
+* @file TrackedMemory.cpp
+* @brief Implementation of the TrackedMemory class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-12
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "TrackedMemory.hpp"
+
+
+namespace poros
+{
+
+
+/******************************************************************************
+* CONSTRUCTORS / DESTRUCTOR ***************************************************
+******************************************************************************/
+
+TrackedMemory::TrackedMemory() noexcept :
+  m_keeper(nullptr),
+  m_bytes(0)
+{
+  // do nothing
+}
+
+
+TrackedMemory::TrackedMemory(
+    size_t const bytes) :
+  m_keeper(MemoryKeeper::current()),
+  m_bytes(0)
+{
+  add(bytes);
+}
+
+
+TrackedMemory::TrackedMemory(
+    TrackedMemory const & rhs) :
+  TrackedMemory(rhs.m_bytes)
+{
+  // do nothing
+}
+
+
+TrackedMemory::TrackedMemory(
+    TrackedMemory && rhs) noexcept :
+  m_keeper(std::move(rhs.m_keeper)),
+  m_bytes(rhs.m_bytes)
+{
+  rhs.m_bytes = 0;
+}
+
+
+TrackedMemory & TrackedMemory::operator=(
+    TrackedMemory const & rhs)
+{
+  if (this != &rhs) {
+    *this = TrackedMemory(rhs.m_bytes);
+  }
+
+  return *this;
+}
+
+
+TrackedMemory & TrackedMemory::operator=(
+    TrackedMemory && rhs) noexcept
+{
+  if (this != &rhs) {
+    release();
+    m_keeper = std::move(rhs.m_keeper);
+    m_bytes = rhs.m_bytes;
+    rhs.m_bytes = 0;
+  }
+
+  return *this;
+}
+
+
+TrackedMemory::~TrackedMemory()
+{
+  release();
+}
+
+
+/******************************************************************************
+* PUBLIC METHODS **************************************************************
+******************************************************************************/
+
+void TrackedMemory::add(
+    size_t const bytes) noexcept
+{
+  if (!m_keeper) {
+    m_keeper = MemoryKeeper::current();
+  }
+
+  if (m_keeper) {
+    m_keeper->reportAllocation(bytes);
+    m_bytes += bytes;
+  }
+}
+
+
+/******************************************************************************
+* PRIVATE METHODS *************************************************************
+******************************************************************************/
+
+void TrackedMemory::release() noexcept
+{
+  if (m_keeper && m_bytes > 0) {
+    m_keeper->reportRelease(m_bytes);
+  }
+  m_bytes = 0;
+  m_keeper.reset();
+}
+
+
+}
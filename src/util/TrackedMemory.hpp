@@ -0,0 +1,134 @@
+/**
+* @file TrackedMemory.hpp
+* @brief The TrackedMemory class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-12
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef POROS_SRC_UTIL_TRACKEDMEMORY_HPP
+#define POROS_SRC_UTIL_TRACKEDMEMORY_HPP
+
+#include "MemoryKeeper.hpp"
+
+#include <memory>
+
+namespace poros
+{
+
+/**
+* @brief A record of memory held by a container. On creation it reports its
+* bytes to the current memory keeper (if there is one), and it reports their
+* release when it is destroyed. Containers hold one alongside the arrays it
+* accounts for, so that the record shares their lifetime.
+*/
+class TrackedMemory
+{
+  public:
+    /**
+    * @brief Create an empty record.
+    */
+    TrackedMemory() noexcept;
+
+    /**
+    * @brief Create a record of the given number of bytes.
+    *
+    * @param bytes The number of bytes.
+    */
+    TrackedMemory(
+        size_t bytes);
+
+    /**
+    * @brief Create a new record of the same number of bytes.
+    *
+    * @param rhs The record to copy.
+    */
+    TrackedMemory(
+        TrackedMemory const & rhs);
+
+    /**
+    * @brief Take ownership of another record.
+    *
+    * @param rhs The record to move.
+    */
+    TrackedMemory(
+        TrackedMemory && rhs) noexcept;
+
+    /**
+    * @brief Replace this record with a new record of the same number of bytes
+    * as another.
+    *
+    * @param rhs The record to copy.
+    *
+    * @return This record.
+    */
+    TrackedMemory & operator=(
+        TrackedMemory const & rhs);
+
+    /**
+    * @brief Release this record, and take ownership of another.
+    *
+    * @param rhs The record to move.
+    *
+    * @return This record.
+    */
+    TrackedMemory & operator=(
+        TrackedMemory && rhs) noexcept;
+
+    /**
+    * @brief Destructor, which releases the bytes.
+    */
+    ~TrackedMemory();
+
+    /**
+    * @brief Add bytes to this record.
+    *
+    * @param bytes The number of bytes.
+    */
+    void add(
+        size_t bytes) noexcept;
+
+    /**
+    * @brief Get the number of bytes this record has reported (no bytes are
+    * reported if there was no current memory keeper).
+    *
+    * @return The number of bytes.
+    */
+    size_t bytes() const noexcept
+    {
+      return m_bytes;
+    }
+
+  private:
+    std::shared_ptr<MemoryKeeper> m_keeper;
+    size_t m_bytes;
+
+    /**
+    * @brief Release the bytes held by this record.
+    */
+    void release() noexcept;
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+/**
+* @file AllocationCounter_test.cpp
+* @brief Unit tests for the AllocationCounter class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-28
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/AllocationCounter.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <memory>
+
+namespace poros
+{
+
+UNITTEST(AllocationCounter, CountsNew)
+{
+  AllocationCounter::sample_struct const start = AllocationCounter::read();
+
+  std::unique_ptr<uint64_t[]> data(new uint64_t[100]);
+  data[0] = 1;
+
+  AllocationCounter::sample_struct const end = AllocationCounter::read();
+
+  if (AllocationCounter::isEnabled()) {
+    testEqual(end.count, start.count + 1);
+    testEqual(end.bytes, start.bytes + 100*sizeof(uint64_t));
+  } else {
+    testEqual(end.count, start.count);
+    testEqual(end.bytes, start.bytes);
+  }
+}
+
+UNITTEST(AllocationCounter, Report)
+{
+  AllocationCounter::sample_struct const start = AllocationCounter::read();
+  AllocationCounter::reportAllocation(16);
+  AllocationCounter::sample_struct const end = AllocationCounter::read();
+
+  testEqual(end.count, start.count + 1);
+  testEqual(end.bytes, start.bytes + 16);
+}
+
+}
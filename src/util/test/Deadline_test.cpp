@@ -0,0 +1,93 @@
+/**
+* @file Deadline_test.cpp
+* @brief Unit tests for the Deadline class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-29
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/Deadline.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <limits>
+#include <thread>
+
+
+namespace poros
+{
+
+
+UNITTEST(Deadline, Unset)
+{
+  Deadline deadline;
+  testFalse(deadline.isSet());
+  testFalse(deadline.hasPassed());
+  testEqual(deadline.remaining(), 0.0);
+
+  deadline.restart(0.0);
+  testFalse(deadline.isSet());
+  testFalse(deadline.hasPassed());
+}
+
+UNITTEST(Deadline, Passes)
+{
+  Deadline deadline;
+  deadline.restart(0.01);
+  testTrue(deadline.isSet());
+  testGreater(deadline.remaining(), 0.0);
+  testLessOrEqual(deadline.remaining(), 0.01);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  testTrue(deadline.hasPassed());
+  testLess(deadline.remaining(), 0.0);
+  testGreaterOrEqual(deadline.elapsed(), 0.01);
+}
+
+UNITTEST(Deadline, Restart)
+{
+  Deadline deadline;
+  deadline.restart(1e-9);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  testTrue(deadline.hasPassed());
+
+  deadline.restart(3600.0);
+  testFalse(deadline.hasPassed());
+  testLess(deadline.elapsed(), 3600.0);
+}
+
+UNITTEST(Deadline, Unbounded)
+{
+  Deadline deadline;
+  deadline.restart(std::numeric_limits<double>::infinity());
+  testTrue(deadline.isSet());
+  testFalse(deadline.hasPassed());
+  testGreater(deadline.remaining(), 1e9);
+
+  deadline.restart(1e300);
+  testTrue(deadline.isSet());
+  testFalse(deadline.hasPassed());
+  testGreater(deadline.remaining(), 1e9);
+}
+
+}
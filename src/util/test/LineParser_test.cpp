@@ -0,0 +1,108 @@
+/**
+* @file LineParser_test.cpp
+* @brief Unit tests for the LineParser class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-24
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/LineParser.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <cmath>
+#include <string>
+
+
+namespace poros
+{
+
+
+UNITTEST(LineParser, ParseUnsigned)
+{
+  std::string const line("12  7\tx 3y");
+  char const * pos = line.data();
+  char const * const end = line.data() + line.size();
+
+  unsigned int value;
+  testTrue(LineParser::parseUnsigned(&pos, end, &value));
+  testEqual(value, 12u);
+  testTrue(LineParser::parseUnsigned(&pos, end, &value));
+  testEqual(value, 7u);
+  testFalse(LineParser::parseUnsigned(&pos, end, &value));
+
+  // position is unchanged on failure
+  testEqual(*pos, 'x');
+  ++pos;
+  pos = LineParser::skipSpace(pos, end);
+  testFalse(LineParser::parseUnsigned(&pos, end, &value));
+}
+
+
+UNITTEST(LineParser, ParseReal)
+{
+  std::string const line("-1.5 2e3 .25 +4.E-2 7 1.5x");
+  char const * pos = line.data();
+  char const * const end = line.data() + line.size();
+
+  double value;
+  testTrue(LineParser::parseReal(&pos, end, &value));
+  testEqual(value, -1.5);
+  testTrue(LineParser::parseReal(&pos, end, &value));
+  testEqual(value, 2000.0);
+  testTrue(LineParser::parseReal(&pos, end, &value));
+  testEqual(value, 0.25);
+  testTrue(LineParser::parseReal(&pos, end, &value));
+  testLess(std::fabs(value - 0.04), 1e-12);
+  testTrue(LineParser::parseReal(&pos, end, &value));
+  testEqual(value, 7.0);
+  testFalse(LineParser::parseReal(&pos, end, &value));
+}
+
+
+UNITTEST(LineParser, Split)
+{
+  std::string text;
+  for (int i = 0; i < 300000; ++i) {
+    text += std::to_string(i) + "\n";
+  }
+  char const * const begin = text.data();
+  char const * const end = text.data() + text.size();
+
+  std::vector<LineParser::range_type> const chunks = \
+      LineParser::split(begin, end);
+  testGreater(chunks.size(), 0u);
+  testEqual(chunks.front().first, begin);
+  testEqual(chunks.back().second, end);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    if (i > 0) {
+      testEqual(chunks[i].first, chunks[i-1].second);
+      testEqual(*(chunks[i].first-1), '\n');
+    }
+  }
+
+  testEqual(LineParser::countTokens(begin, \
+      LineParser::findLineEnd(begin, end)), 1u);
+}
+
+
+}
@@ -0,0 +1,134 @@
+/**
+* @file MemoryKeeper_test.cpp
+* @brief Unit tests for the MemoryKeeper, MemoryScope, and TrackedMemory classes.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-19
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/MemoryKeeper.hpp"
+#include "util/MemoryScope.hpp"
+#include "util/TrackedMemory.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <utility>
+
+namespace poros
+{
+
+
+UNITTEST(MemoryKeeper, ReportAllocation)
+{
+  MemoryKeeper keeper;
+
+  keeper.setPhase(MemoryKeeper::COARSENING);
+  keeper.reportAllocation(100);
+  keeper.reportAllocation(50);
+  keeper.reportRelease(120);
+
+  keeper.setPhase(MemoryKeeper::REFINEMENT);
+  keeper.reportAllocation(40);
+
+  testEqual(keeper.getLiveBytes(), 70u);
+  testEqual(keeper.getPeakBytes(MemoryKeeper::COARSENING), 150u);
+  testEqual(keeper.getPeakBytes(MemoryKeeper::REFINEMENT), 70u);
+  testEqual(keeper.getPeakBytes(MemoryKeeper::TOTAL), 150u);
+
+  std::vector<MemoryKeeper::usage_struct> const usage = keeper.usage();
+  testEqual(usage.size(), \
+      static_cast<size_t>(MemoryKeeper::NUM_MEMORY_CATEGORIES));
+  testEqual(usage[MemoryKeeper::TOTAL].allocated, 190u);
+  testEqual(usage[MemoryKeeper::COARSENING].allocated, 150u);
+  testEqual(usage[MemoryKeeper::REFINEMENT].allocated, 40u);
+  testEqual(usage[MemoryKeeper::EXTRACTION].allocated, 0u);
+}
+
+
+UNITTEST(MemoryKeeper, SetPhaseInvalid)
+{
+  MemoryKeeper keeper;
+
+  bool thrown = false;
+  try {
+    keeper.setPhase(MemoryKeeper::NUM_MEMORY_CATEGORIES);
+  } catch (std::runtime_error const &) {
+    thrown = true;
+  }
+  testTrue(thrown);
+}
+
+
+UNITTEST(MemoryScope, Nested)
+{
+  std::shared_ptr<MemoryKeeper> keeper(new MemoryKeeper);
+
+  testEqual(MemoryKeeper::current().get(), static_cast<MemoryKeeper*>(nullptr));
+  {
+    MemoryScope outer(keeper, MemoryKeeper::TOTAL);
+    testEqual(MemoryKeeper::current().get(), keeper.get());
+    {
+      MemoryScope inner(MemoryKeeper::EXTRACTION);
+      testEqual(keeper->getPhase(), \
+          static_cast<uint32_t>(MemoryKeeper::EXTRACTION));
+    }
+    testEqual(keeper->getPhase(), static_cast<uint32_t>(MemoryKeeper::TOTAL));
+  }
+  testEqual(MemoryKeeper::current().get(), static_cast<MemoryKeeper*>(nullptr));
+}
+
+
+UNITTEST(TrackedMemory, Lifetime)
+{
+  std::shared_ptr<MemoryKeeper> keeper(new MemoryKeeper);
+  MemoryScope scope(keeper, MemoryKeeper::COARSENING);
+
+  {
+    TrackedMemory a(64);
+    a.add(16);
+    testEqual(keeper->getLiveBytes(), 80u);
+
+    TrackedMemory b(a);
+    testEqual(keeper->getLiveBytes(), 160u);
+
+    TrackedMemory c(std::move(b));
+    testEqual(keeper->getLiveBytes(), 160u);
+    testEqual(c.bytes(), 80u);
+
+    c = TrackedMemory(8);
+    testEqual(keeper->getLiveBytes(), 88u);
+  }
+
+  testEqual(keeper->getLiveBytes(), 0u);
+  testEqual(keeper->getPeakBytes(MemoryKeeper::COARSENING), 168u);
+}
+
+
+UNITTEST(TrackedMemory, NoKeeper)
+{
+  TrackedMemory memory(128);
+  testEqual(memory.bytes(), 0u);
+}
+
+
+}
@@ -0,0 +1,89 @@
+/**
+* @file MemoryMappedFile_test.cpp
+* @brief Unit tests for the MemoryMappedFile class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/MemoryMappedFile.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace poros
+{
+
+
+UNITTEST(MemoryMappedFile, Read)
+{
+  std::string const filename("MemoryMappedFile_test.txt");
+  std::string const contents("some contents\n");
+  {
+    std::ofstream stream(filename);
+    stream << contents;
+  }
+
+  {
+    MemoryMappedFile file(filename);
+    testEqual(file.size(), contents.size());
+    testEqual(std::string(file.data(), file.size()), contents);
+  }
+
+  std::remove(filename.c_str());
+}
+
+
+UNITTEST(MemoryMappedFile, ReadEmpty)
+{
+  std::string const filename("MemoryMappedFile_empty.txt");
+  {
+    std::ofstream stream(filename);
+  }
+
+  {
+    MemoryMappedFile file(filename);
+    testEqual(file.size(), 0u);
+  }
+
+  std::remove(filename.c_str());
+}
+
+
+UNITTEST(MemoryMappedFile, Missing)
+{
+  bool thrown = false;
+  try {
+    MemoryMappedFile file("MemoryMappedFile_missing.txt");
+  } catch (std::runtime_error const &) {
+    thrown = true;
+  }
+  testTrue(thrown);
+}
+
+
+}
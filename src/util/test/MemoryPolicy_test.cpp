@@ -0,0 +1,73 @@
+/**
+* @file MemoryPolicy_test.cpp
+* @brief Unit tests for the MemoryPolicy class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-10-20
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/MemoryPolicy.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <cstdint>
+
+namespace poros
+{
+
+
+UNITTEST(MemoryPolicy, AllocateSmall)
+{
+  sl::Array<uint32_t> array = MemoryPolicy::allocate<uint32_t>(100, 7);
+
+  testEqual(array.size(), 100u);
+  for (uint32_t const value : array) {
+    testEqual(value, 7u);
+  }
+}
+
+
+UNITTEST(MemoryPolicy, AllocateLarge)
+{
+  size_t const size = 3*MemoryPolicy::MIN_HUGE_PAGE_BYTES/sizeof(uint32_t) + 5;
+  sl::Array<uint32_t> array = MemoryPolicy::allocate<uint32_t>(size);
+
+  testEqual(array.size(), size);
+  for (size_t i = 0; i < size; ++i) {
+    array[i] = static_cast<uint32_t>(i);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    testEqual(array[i], static_cast<uint32_t>(i));
+  }
+}
+
+
+UNITTEST(MemoryPolicy, AdviseNull)
+{
+  // must not fail on memory it cannot advise
+  MemoryPolicy::adviseHugePages(nullptr, MemoryPolicy::MIN_HUGE_PAGE_BYTES);
+  MemoryPolicy::prepare(nullptr, 0);
+}
+
+
+}
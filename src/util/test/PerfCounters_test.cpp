@@ -0,0 +1,72 @@
+/**
+* @file PerfCounters_test.cpp
+* @brief Unit tests for the PerfCounters class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-25
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/PerfCounters.hpp"
+#include "solidutils/UnitTest.hpp"
+
+#include <string>
+
+namespace poros
+{
+
+UNITTEST(PerfCounters, Names)
+{
+  testEqual(PerfCounters::name(PerfCounters::CYCLES), \
+      std::string("cycles"));
+  testEqual(PerfCounters::name(PerfCounters::BRANCH_MISSES), \
+      std::string("branch_misses"));
+}
+
+UNITTEST(PerfCounters, ReadIncreases)
+{
+  PerfCounters const & counters = PerfCounters::local();
+
+  PerfCounters::sample_type const start = counters.read();
+
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 1000000; ++i) {
+    sum += i*i;
+  }
+
+  PerfCounters::sample_type const end = counters.read();
+
+  // counters which could not be opened always read as zero
+  for (uint32_t i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+    if (counters.isAvailable(i)) {
+      testGreaterOrEqual(end[i], start[i]) << PerfCounters::name(i);
+    } else {
+      testEqual(end[i], 0u);
+    }
+  }
+  if (counters.isAvailable(PerfCounters::INSTRUCTIONS)) {
+    testGreater(end[PerfCounters::INSTRUCTIONS], \
+        start[PerfCounters::INSTRUCTIONS]);
+  }
+}
+
+}
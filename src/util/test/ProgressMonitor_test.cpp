@@ -0,0 +1,128 @@
+/**
+* @file ProgressMonitor_test.cpp
+* @brief Unit tests for the ProgressMonitor class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-30
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/ProgressMonitor.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace poros
+{
+
+
+namespace
+{
+
+struct record_struct
+{
+  std::vector<poros_progress_struct> reports;
+  size_t cancelAfter;
+};
+
+int recordProgress(
+    poros_progress_struct const * const progress,
+    void * const data)
+{
+  record_struct * const record = static_cast<record_struct*>(data);
+  record->reports.emplace_back(*progress);
+  return record->reports.size() >= record->cancelAfter;
+}
+
+}
+
+
+UNITTEST(ProgressMonitor, Disabled)
+{
+  ProgressMonitor monitor(nullptr, nullptr);
+  testFalse(monitor.isEnabled());
+
+  // nothing is called, and so nothing is cancelled
+  monitor.report(COARSENING_PHASE, 1);
+  monitor.reportTrial(10);
+}
+
+
+UNITTEST(ProgressMonitor, Report)
+{
+  record_struct record{{}, 100};
+  ProgressMonitor monitor(recordProgress, &record);
+  testTrue(monitor.isEnabled());
+
+  monitor.startTrial(0);
+  monitor.setDepth(2);
+  monitor.report(COARSENING_PHASE, 3);
+  monitor.report(REFINEMENT_PHASE, 0);
+  monitor.reportTrial(42);
+  monitor.startTrial(1);
+  monitor.report(INITIAL_PARTITIONING_PHASE, 5);
+
+  testEqual(record.reports.size(), 4u);
+
+  testEqual(record.reports[0].phase, static_cast<int>(COARSENING_PHASE));
+  testEqual(record.reports[0].trial, 0);
+  testEqual(record.reports[0].depth, 2);
+  testEqual(record.reports[0].level, 3);
+  testEqual(record.reports[0].hasBestCut, 0);
+
+  testEqual(record.reports[2].phase, static_cast<int>(PARTITIONING_PHASE));
+  testEqual(record.reports[2].depth, 0);
+  testEqual(record.reports[2].hasBestCut, 1);
+  testEqual(record.reports[2].bestCut, 42u);
+
+  // the best cut is kept for later trials
+  testEqual(record.reports[3].trial, 1);
+  testEqual(record.reports[3].level, 5);
+  testEqual(record.reports[3].hasBestCut, 1);
+  testEqual(record.reports[3].bestCut, 42u);
+
+  monitor.clear();
+  monitor.report(COARSENING_PHASE, 1);
+  testEqual(record.reports.back().hasBestCut, 0);
+}
+
+
+UNITTEST(ProgressMonitor, Cancel)
+{
+  record_struct record{{}, 2};
+  ProgressMonitor monitor(recordProgress, &record);
+
+  monitor.report(COARSENING_PHASE, 1);
+
+  bool cancelled = false;
+  try {
+    monitor.report(COARSENING_PHASE, 2);
+  } catch (std::runtime_error const &) {
+    cancelled = true;
+  }
+  testTrue(cancelled);
+}
+
+}
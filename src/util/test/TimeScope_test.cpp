@@ -0,0 +1,228 @@
+/**
+* @file TimeScope_test.cpp
+* @brief Unit tests for the TimeScope class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-21
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/TimeKeeper.hpp"
+#include "util/TimeScope.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace poros
+{
+
+
+UNITTEST(TimeScope, BuildsTree)
+{
+  std::shared_ptr<TimeKeeper> keeper(new TimeKeeper);
+  keeper->enableTree(true);
+
+  {
+    TimeScope root(keeper);
+    for (size_t level = 0; level < 2; ++level) {
+      TimeScope levelScope("Level", level);
+      TimeScope phaseScope(TimeKeeper::COARSENING);
+    }
+    TimeScope nodeScope("Partitions", 0, 3);
+    {
+      TimeScope levelScope("Level", 0);
+    }
+    {
+      TimeScope levelScope("Level", 0);
+    }
+  }
+
+  testEqual(TimeKeeper::current(), static_cast<TimeKeeper*>(nullptr));
+
+  std::vector<TimeKeeper::node_struct> const tree = keeper->tree();
+  testEqual(tree.size(), 7u);
+
+  testEqual(tree[0].name, std::string("Total"));
+  testEqual(tree[0].calls, 1u);
+  testEqual(tree[1].name, std::string("Level 0"));
+  testEqual(tree[1].parent, 0u);
+  testEqual(tree[2].name, std::string("Coarsening"));
+  testEqual(tree[2].parent, 1u);
+  testEqual(tree[3].name, std::string("Level 1"));
+  testEqual(tree[4].parent, 3u);
+  testEqual(tree[5].name, std::string("Partitions 0-3"));
+  testEqual(tree[6].name, std::string("Level 0"));
+  testEqual(tree[6].parent, 5u);
+  testEqual(tree[6].calls, 2u);
+
+  for (TimeKeeper::node_struct const & node : tree) {
+    testGreaterOrEqual(tree[node.parent].seconds, node.seconds);
+  }
+
+  std::ostringstream stream;
+  keeper->writeTree(&stream);
+  testTrue(stream.str().find("\n    Level 0:") != std::string::npos);
+}
+
+
+UNITTEST(TimeScope, Disabled)
+{
+  std::shared_ptr<TimeKeeper> keeper(new TimeKeeper);
+
+  {
+    TimeScope root(keeper);
+    TimeScope levelScope("Level", 0);
+    TimeScope phaseScope(TimeKeeper::REFINEMENT);
+  }
+
+  std::vector<TimeKeeper::node_struct> const tree = keeper->tree();
+  testEqual(tree.size(), 1u);
+  testEqual(tree[0].calls, 0u);
+}
+
+
+UNITTEST(TimeScope, Traces)
+{
+  std::shared_ptr<TimeKeeper> keeper(new TimeKeeper);
+  keeper->enableTrace(true);
+
+  {
+    TimeScope root(keeper);
+    {
+      TimeScope levelScope("Level", 0);
+      TimeScope phaseScope(TimeKeeper::AGGREGATION);
+    }
+    TimeScope nodeScope("Partitions", 0, 3);
+    TimeScope levelScope("Level", 2);
+    TimeScope phaseScope(TimeKeeper::REFINEMENT);
+  }
+
+  // the tree is not recorded along with the trace
+  testEqual(keeper->tree().size(), 1u);
+
+  // events are in the order they end
+  std::vector<TraceSink::event_struct> const events = \
+      keeper->trace()->events();
+  testEqual(events.size(), 6u);
+
+  testEqual(events[0].name, std::string("Aggregation"));
+  testEqual(events[0].level, 0);
+  testEqual(events[0].firstPartition, TraceSink::NO_TAG);
+  testEqual(events[1].name, std::string("Level 0"));
+  testEqual(events[1].level, 0);
+
+  testEqual(events[2].name, std::string("Refinement"));
+  testEqual(events[2].level, 2);
+  testEqual(events[2].firstPartition, 0);
+  testEqual(events[2].lastPartition, 3);
+  testEqual(events[4].name, std::string("Partitions 0-3"));
+  testEqual(events[4].level, TraceSink::NO_TAG);
+  testEqual(events[4].lastPartition, 3);
+
+  testEqual(events[5].name, std::string("Total"));
+  testEqual(events[5].firstPartition, TraceSink::NO_TAG);
+  for (TraceSink::event_struct const & event : events) {
+    testLessOrEqual(event.start + event.duration, \
+        events[5].start + events[5].duration);
+    testEqual(event.thread, 0u);
+  }
+}
+
+
+UNITTEST(TimeScope, ContinueOnThreads)
+{
+  std::shared_ptr<TimeKeeper> keeper(new TimeKeeper);
+  keeper->enableTree(true);
+
+  {
+    TimeScope root(keeper);
+    TimeScope nodeScope("Partitions", 0, 7);
+    TimeKeeper * const current = TimeKeeper::current();
+    size_t const node = TimeKeeper::currentNode();
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (int i = 0; i < 64; ++i) {
+      TimeScope task(current, node);
+      TimeScope levelScope("Level", static_cast<size_t>(i % 4));
+      TimeScope phaseScope(TimeKeeper::REFINEMENT);
+    }
+  }
+
+  std::vector<TimeKeeper::node_struct> const tree = keeper->tree();
+  testEqual(tree.size(), 10u);
+  for (size_t node = 2; node < tree.size(); ++node) {
+    testEqual(tree[node].calls, 16u);
+  }
+}
+
+
+
+UNITTEST(TimeScope, CountsAllocations)
+{
+  std::shared_ptr<TimeKeeper> keeper(new TimeKeeper);
+
+  std::vector<std::unique_ptr<uint32_t[]>> data;
+  data.reserve(3);
+  {
+    TimeScope root(keeper);
+    data.emplace_back(new uint32_t[4]);
+    {
+      TimeScope phaseScope(TimeKeeper::REFINEMENT);
+      data.emplace_back(new uint32_t[8]);
+      {
+        // nested scopes of the same category count allocations once
+        TimeScope nestedScope(TimeKeeper::REFINEMENT);
+        data.emplace_back(new uint32_t[16]);
+      }
+    }
+  }
+
+  std::vector<std::pair<std::string, AllocationCounter::sample_struct>> const \
+      allocations = keeper->allocations();
+  testEqual(allocations.size(), \
+      static_cast<size_t>(TimeKeeper::NUM_TIME_CATEGORIES));
+
+  AllocationCounter::sample_struct const total = \
+      allocations[TimeKeeper::TOTAL].second;
+  AllocationCounter::sample_struct const refinement = \
+      allocations[TimeKeeper::REFINEMENT].second;
+  AllocationCounter::sample_struct const coarsening = \
+      allocations[TimeKeeper::COARSENING].second;
+  if (AllocationCounter::isEnabled()) {
+    testEqual(total.count, 3u);
+    testEqual(total.bytes, 28*sizeof(uint32_t));
+    testEqual(refinement.count, 2u);
+    testEqual(refinement.bytes, 24*sizeof(uint32_t));
+  } else {
+    testEqual(total.count, 0u);
+    testEqual(refinement.count, 0u);
+  }
+  testEqual(coarsening.count, 0u);
+}
+
+}
@@ -0,0 +1,86 @@
+/**
+* @file TraceSink_test.cpp
+* @brief Unit tests for the TraceSink class.
+* @author Dominique LaSalle <dominique@solidlake.com>
+* Copyright 2018
+* @version 1
+* @date 2018-11-26
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/TraceSink.hpp"
+
+#include "solidutils/UnitTest.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace poros
+{
+
+
+UNITTEST(TraceSink, NumbersThreads)
+{
+  TraceSink trace;
+
+  trace.record("Coarsening", 0.0, 1.0, 0, 0, 1);
+  std::thread other([&trace]() {
+    trace.record("Refinement", 0.5, 0.25, TraceSink::NO_TAG, \
+        TraceSink::NO_TAG, TraceSink::NO_TAG);
+  });
+  other.join();
+  trace.record("Projection", 1.0, 0.5, 1, 0, 1);
+
+  std::vector<TraceSink::event_struct> const events = trace.events();
+  testEqual(events.size(), 3u);
+  testEqual(events[0].thread, 0u);
+  testEqual(events[1].thread, 1u);
+  testEqual(events[2].thread, 0u);
+  testEqual(events[1].name, std::string("Refinement"));
+}
+
+
+UNITTEST(TraceSink, WritesChromeTrace)
+{
+  TraceSink trace;
+  testGreaterOrEqual(trace.now(), 0.0);
+
+  trace.record("Level 1", 0.001, 0.002, 1, 4, 7);
+  trace.record("Total", 0.0, 0.004, TraceSink::NO_TAG, TraceSink::NO_TAG, \
+      TraceSink::NO_TAG);
+
+  std::ostringstream stream;
+  trace.write(&stream);
+  std::string const json = stream.str();
+
+  testEqual(json.find("{\"traceEvents\": ["), 0u);
+  testTrue(json.find("{\"name\": \"Level 1\", \"cat\": \"poros\", " \
+      "\"ph\": \"X\", \"ts\": 1000.000, \"dur\": 2000.000, \"pid\": 0, " \
+      "\"tid\": 0, \"args\": {\"level\": 1, \"partitions\": \"4-7\"}}") != \
+      std::string::npos) << json;
+  testTrue(json.find("\"name\": \"Total\"") != std::string::npos);
+  testTrue(json.find("\"args\": {}}") != std::string::npos);
+}
+
+
+}